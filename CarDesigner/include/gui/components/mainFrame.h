@@ -117,6 +117,8 @@ public:
 	inline QuasiStatic::Inputs GetQuasiStaticInputs() const { return quasiStaticInputs; }
 	inline bool GetUseRackTravel() const { return useRackTravel; }
 	inline void SetUseRackTravel(bool useRackTravel) { this->useRackTravel = useRackTravel; }
+	inline bool GetParallelCorners() const { return parallelCorners; }
+	inline void SetParallelCorners(bool parallelCorners) { this->parallelCorners = parallelCorners; }
 
 	bool JobsPending() const;
 
@@ -199,6 +201,7 @@ private:
 	Kinematics::Inputs kinematicInputs;
 	QuasiStatic::Inputs quasiStaticInputs;
 	bool useRackTravel;// if false, we use steering wheel angle
+	bool parallelCorners;// if true, the corners of each car are solved on separate threads
 	bool lastAnalysisWasKinematic;
 	
 	bool useOrthoView;
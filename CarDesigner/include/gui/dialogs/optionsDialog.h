@@ -91,6 +91,7 @@ private:
 	wxTextCtrl *centerOfRotationY;
 	wxTextCtrl *centerOfRotationZ;
 	wxTextCtrl *simultaneousThreads;
+	wxCheckBox *parallelCorners;
 
 	// DEBUG page
 	wxPanel *debuggerPage;
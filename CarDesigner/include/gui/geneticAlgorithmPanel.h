@@ -40,7 +40,7 @@ public:
 	~GeneticAlgorithmPanel();
 
 	void UpdateInformation();
-	void IncrementStatusBars();
+	void IncrementStatusBars(const unsigned int &count);
 
 private:
 	// The optimization object that we represent
@@ -82,6 +82,8 @@ private:
 	wxGauge *generationProgress;
 	wxGauge *overallProgress;
 
+	wxStaticText *cacheHitRate;
+
 	wxTextCtrl *populationSize;
 	wxTextCtrl *generationLimit;
 	wxTextCtrl *elitismFraction;
@@ -51,7 +51,7 @@ public:
 	void HaltOptimization();
 
 	// Decrements outstanding analysis counter
-	void MarkAnalysisComplete();
+	void MarkAnalysisComplete(const unsigned int &count);
 
 	// Performs the post-optimization tasks, such as updating the interface and
 	// updating the optimized car to match the best fit genome
@@ -131,7 +131,7 @@ public:
 	double GetDataValue(int associatedCarIndex, int point, PlotID id) const;
 
 	// Decrements the number of pending jobs for this object
-	void MarkAnalysisComplete();
+	void MarkAnalysisComplete(const unsigned int &count);
 
 	// For retrieving the strings associated with the plots and their units
 	wxString GetPlotName(PlotID id) const;
@@ -183,10 +183,6 @@ private:
 
 	std::vector<GuiCar*> associatedCars;
 
-	// Array of working cars to use for the analyses
-	Car **workingCarArray;
-	int numberOfWorkingCars;
-
 	// This array holds the values against which the data can be plotted
 	// (user gets to choose what the X axis should be)
 	double *axisValuesPitch;//		[rad]
@@ -207,6 +203,11 @@ private:
 	// The flags indicating what plots are active
 	bool plotActive[NumberOfPlots];
 
+	// Only the outputs required for the active plots are computed; activating
+	// a plot that needs other outputs triggers a new analysis
+	KinematicOutputs::OutputMask analyzedMask;
+	KinematicOutputs::OutputMask GetRequiredOutputMask() const;
+
 	// Plot display objects
 	bool generateTitleFromFileName;
 	wxString title;
@@ -2517,7 +2517,8 @@ void MainFrame::ThreadCompleteEvent(wxCommandEvent &event)
 		if (event.GetExtraLong() >= (long)openObjectList.GetCount())
 			break;
 
-		static_cast<Iteration*>(openObjectList[event.GetExtraLong()])->MarkAnalysisComplete();
+		static_cast<Iteration*>(openObjectList[event.GetExtraLong()])->MarkAnalysisComplete(
+			wxPtrToUInt(event.GetClientData()));
 		break;
 
 	case ThreadJob::CommandThreadKinematicsGA:
@@ -2526,7 +2527,8 @@ void MainFrame::ThreadCompleteEvent(wxCommandEvent &event)
 		if (event.GetExtraLong() >= (long)openObjectList.GetCount())
 			break;
 
-		static_cast<GeneticOptimization*>(openObjectList[event.GetExtraLong()])->MarkAnalysisComplete();
+		static_cast<GeneticOptimization*>(openObjectList[event.GetExtraLong()])->MarkAnalysisComplete(
+			wxPtrToUInt(event.GetClientData()));
 		break;
 
 	case ThreadJob::CommandThreadGeneticOptimization:
@@ -2876,6 +2878,7 @@ void MainFrame::ReadConfiguration()
 	kinematicInputs.firstRotation = (Vector::Axis)configurationFile->Read(
 		_T("/Kinematics/FirstRotation"), 0l);
 	configurationFile->Read(_T("/Kinematics/UseRackTravel"), &useRackTravel, true);
+	configurationFile->Read(_T("/Kinematics/ParallelCorners"), &parallelCorners, false);
 
 	// Read DEBUGGING configuration from file
 	Debugger::GetInstance().SetDebugLevel(Debugger::DebugLevel(configurationFile->Read(_T("/Debugging/DebugLevel"), 1l)));
@@ -2969,6 +2972,7 @@ void MainFrame::WriteConfiguration()
 	configurationFile->Write(_T("/Kinematics/CenterOfRotationZ"), kinematicInputs.centerOfRotation.z);
 	configurationFile->Write(_T("/Kinematics/FirstRotation"), (int)kinematicInputs.firstRotation);
 	configurationFile->Write(_T("/Kinematics/UseRackTravel"), useRackTravel);
+	configurationFile->Write(_T("/Kinematics/ParallelCorners"), parallelCorners);
 
 	// Write DEBUGGING configuration to file
 	configurationFile->Write(_T("/Debugging/DebugLevel"), (int)Debugger::GetInstance().GetDebugLevel());
@@ -545,10 +545,16 @@ void OptionsDialog::CreateControls()
 		wxALIGN_CENTER_VERTICAL | wxALL, 5);
 	numberOfThreadsSizer->Add(simultaneousThreads, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
+	// Create the parallel corners checkbox
+	parallelCorners = new wxCheckBox(kinematicsPage, wxID_ANY,
+		_T("Solve each corner on a separate thread (faster updates while editing)"));
+	parallelCorners->SetValue(mainFrame.GetParallelCorners());
+
 	// Add the sizers to the MainSizer
 	kinematicsSizer->Add(corSizer, 0, wxALIGN_CENTER_HORIZONTAL);
 	kinematicsSizer->Add(radioOptionsSizer, 0, wxALIGN_CENTER_HORIZONTAL);
 	kinematicsSizer->Add(numberOfThreadsSizer, 0, wxALIGN_CENTER_HORIZONTAL);
+	kinematicsSizer->Add(parallelCorners, 0, wxALIGN_CENTER_HORIZONTAL | wxALL, 5);
 
 	// Set the kinematics page's sizer
 	kinematicsPage->SetSizerAndFit(kinematicsTopSizer);
@@ -690,6 +696,8 @@ void OptionsDialog::OKClickEvent(wxCommandEvent& WXUNUSED(event))
 			"Warning!  Specified number of threads is not valid (must be a number greater than zero) - using previous value of "
 			 << mainFrame.GetNumberOfThreads() << Debugger::PriorityHigh;
 
+	mainFrame.SetParallelCorners(parallelCorners->GetValue());
+
 	// Update the default units for the converter object
 	// NOTE:  This section MUST come after the center of rotation is updated in order for
 	// the units label on the center of rotation input to have been correct
@@ -341,6 +341,11 @@ void GeneticAlgorithmPanel::CreateControls()
 	progressSizer->Add(overallProgressLabel, 0, wxALIGN_LEFT | wxALIGN_CENTER_VERTICAL);
 	progressSizer->Add(overallProgress, 0, wxEXPAND);
 
+	wxStaticText *cacheHitRateLabel = new wxStaticText(this, wxID_ANY, _T("Cache Hit Rate"));
+	cacheHitRate = new wxStaticText(this, wxID_ANY, _T("-"));
+	progressSizer->Add(cacheHitRateLabel, 0, wxALIGN_LEFT | wxALIGN_CENTER_VERTICAL);
+	progressSizer->Add(cacheHitRate, 0, wxALIGN_LEFT | wxALIGN_CENTER_VERTICAL);
+
 	// Assign the top level sizer to the dialog
 	SetSizer(topSizer);
 }
@@ -965,6 +970,8 @@ void GeneticAlgorithmPanel::ResetStatusBars()
 	// Set the progress values to zero
 	generationProgress->SetValue(0);
 	overallProgress->SetValue(0);
+
+	cacheHitRate->SetLabel(_T("-"));
 }
 
 //==========================================================================
@@ -972,11 +979,11 @@ void GeneticAlgorithmPanel::ResetStatusBars()
 // Function:		IncrementStatusBars
 //
 // Description:		Increments the level of completion of both status bars.
-//					Status bars are normalized so that every time this is
-//					called, the progress should be increased by one.
+//					Status bars are normalized so that the progress is
+//					increased by one for each completed analysis.
 //
 // Input Arguments:
-//		None
+//		count	= const unsigned int& number of analyses completed
 //
 // Output Arguments:
 //		None
@@ -985,15 +992,20 @@ void GeneticAlgorithmPanel::ResetStatusBars()
 //		None
 //
 //==========================================================================
-void GeneticAlgorithmPanel::IncrementStatusBars()
+void GeneticAlgorithmPanel::IncrementStatusBars(const unsigned int &count)
 {
 	// If the generation progress bar is already full, reset it to zero
 	if (generationProgress->GetValue() == generationProgress->GetRange())
 		generationProgress->SetValue(0);
 
-	// Add one to the status of both status bars
-	generationProgress->SetValue(generationProgress->GetValue() + 1);
-	overallProgress->SetValue(overallProgress->GetValue() + 1);
+	// Add the completed analyses to the status of both status bars
+	generationProgress->SetValue(generationProgress->GetValue() + count);
+	overallProgress->SetValue(overallProgress->GetValue() + count);
+
+	// Analyses taken from the cache are included in the count, so this is a
+	// convenient time to update the hit rate, too
+	cacheHitRate->SetLabel(wxString::Format("%0.1f%%",
+		optimization.GetAlgorithm().GetCacheHitRate() * 100.0));
 }
 
 //==========================================================================
@@ -190,10 +190,12 @@ bool GeneticOptimization::PerformSaveToFile()
 // Class:			GeneticOptimization
 // Function:		MarkAnalysisComplete
 //
-// Description:		Decrements the counter of outstanding analyses.
+// Description:		Updates the progress display.  Called once per completed
+//					job (the algorithm itself is notified directly by the
+//					worker threads).
 //
 // Input Arguments:
-//		None
+//		count	= const unsigned int& number of analyses completed by the job
 //
 // Output Arguments:
 //		None
@@ -202,14 +204,11 @@ bool GeneticOptimization::PerformSaveToFile()
 //		None
 //
 //==========================================================================
-void GeneticOptimization::MarkAnalysisComplete()
+void GeneticOptimization::MarkAnalysisComplete(const unsigned int &count)
 {
-	// Tell the algorithm that we've completed an analysis
-	geneticAlgorithm->MarkAnalysisComplete();
-
-	// Also tell the panel that we've completed an analysis - this is what
+	// Tell the panel that we've completed the analyses - this is what
 	// makes the status bars fill in
-	gaPanel->IncrementStatusBars();
+	gaPanel->IncrementStatusBars(count);
 }
 
 //==========================================================================
@@ -251,6 +251,7 @@ void GuiCar::UpdateData()
 
 	// Re-run the kinematics to update the car's position
 	KinematicsData *data = new KinematicsData(originalCar, workingCar, inputs, &outputs.kinematicOutputs);
+	data->parallelCorners = mainFrame.GetParallelCorners();
 	ThreadJob job(ThreadJob::CommandThreadKinematicsNormal, data, name, index);
 	mainFrame.AddJob(job);
 }
@@ -35,7 +35,7 @@
 #include "vUtilities/debugger.h"
 #include "vUtilities/unitConverter.h"
 #include "vSolver/threads/threadJob.h"
-#include "vSolver/threads/kinematicsData.h"
+#include "vSolver/threads/kinematicsBatchData.h"
 #include "vCar/car.h"
 #include "gui/components/mainFrame.h"
 #include "gui/components/mainTree.h"
@@ -68,6 +68,7 @@ Iteration::Iteration(MainFrame &mainFrame, wxString pathAndFileName)
 	int i;
 	for (i = 0; i < NumberOfPlots; i++)
 		plotActive[i] = false;
+	analyzedMask = 0;
 
 	// Initialize the pointers to the X-axis data
 	axisValuesPitch = NULL;
@@ -84,10 +85,6 @@ Iteration::Iteration(MainFrame &mainFrame, wxString pathAndFileName)
 	secondAnalysisPending = false;
 	pendingAnalysisCount = 0;
 
-	// Initialize the working car variables
-	workingCarArray = NULL;
-	numberOfWorkingCars = 0;
-
 	// Create the renderer
 	plotPanel = new PlotPanel(dynamic_cast<wxWindow*>(&mainFrame));
 	notebookTab = dynamic_cast<wxWindow*>(plotPanel);
@@ -134,15 +131,6 @@ Iteration::~Iteration()
 
 	delete [] axisValuesRackTravel;
 	axisValuesRackTravel = NULL;
-
-	int i;
-	for (i = 0; i < numberOfWorkingCars; i++)
-	{
-		delete workingCarArray[i];
-		workingCarArray[i] = NULL;
-	}
-	delete [] workingCarArray;
-	workingCarArray = NULL;
 }
 
 //==========================================================================
@@ -301,6 +289,7 @@ void Iteration::UpdateData()
 	// Reset the flags controlling access to this method
 	analysesDisplayed = false;
 	secondAnalysisPending = false;
+	analyzedMask = GetRequiredOutputMask();
 
 	// Make sure we have no more analyses pending
 	while (pendingAnalysisCount > 0)
@@ -363,21 +352,11 @@ void Iteration::UpdateData()
 	// FIXME:  Check return value to ensure no errors!
 	pendingAnalysisCount = associatedCars.size() * totalPoints;
 
-	// Make sure the working cars are initialized
-	if (pendingAnalysisCount != (unsigned int)numberOfWorkingCars)
-	{
-		int i;
-		for (i = 0; i < numberOfWorkingCars; i++)
-		{
-			delete workingCarArray[i];
-			workingCarArray[i] = NULL;
-		}
-		delete [] workingCarArray;
-		numberOfWorkingCars = pendingAnalysisCount;
-		workingCarArray = new Car*[numberOfWorkingCars];
-		for (i = 0; i < numberOfWorkingCars; i++)
-			workingCarArray[i] = new Car();
-	}
+	// Analyses are sent to the worker threads in contiguous batches (which
+	// may span more than one car) to reduce queue and event overhead
+	unsigned int batchSize = KinematicsBatchData::ComputeBatchSize(
+		pendingAnalysisCount, mainFrame.GetNumberOfThreads());
+	KinematicsBatchData *data = NULL;
 
 	// Go through car-by-car
 	unsigned int currentCar, currentPoint;
@@ -414,16 +393,28 @@ void Iteration::UpdateData()
 			kinematicInputs.firstRotation = mainFrame.GetInputs().firstRotation;
 			kinematicInputs.centerOfRotation = mainFrame.GetInputs().centerOfRotation;
 
-			// Run The analysis
+			// Add the analysis to the current batch
 			KinematicOutputs *newOutputs = new KinematicOutputs;
-			KinematicsData *data = new KinematicsData(&associatedCars[currentCar]->GetOriginalCar(),
-				workingCarArray[currentCar * numberOfPoints + currentPoint], kinematicInputs, newOutputs);
-			ThreadJob job(ThreadJob::CommandThreadKinematicsIteration, data,
-				associatedCars[currentCar]->GetCleanName() + _T(":") + name, index);
-			mainFrame.AddJob(job);
+			if (!data)
+			{
+				data = new KinematicsBatchData;
+				data->warmStart = true;// Consecutive points are close together
+				data->outputMask = analyzedMask;
+			}
+			data->Add(&associatedCars[currentCar]->GetOriginalCar(), kinematicInputs, newOutputs);
 
 			// Add the outputs to the iteration's list
 			currentList->Add(newOutputs);
+
+			// Run the analyses once the batch is full (or when this is the last point)
+			if (data->GetCount() == batchSize || (currentCar == associatedCars.size() - 1
+				&& currentPoint == totalPoints - 1))
+			{
+				ThreadJob job(ThreadJob::CommandThreadKinematicsIteration, data,
+					associatedCars[currentCar]->GetCleanName() + _T(":") + name, index);
+				mainFrame.AddJob(job);
+				data = NULL;
+			}
 		}
 	}
 }
@@ -1001,6 +992,41 @@ void Iteration::SetActivePlot(PlotID plotID, const bool &active)
 
 	// Sets the "this object has changed" flag
 	SetModified();
+
+	// If the outputs for this plot were skipped, we need to re-analyze
+	if (active && plotID < KinematicOutputs::NumberOfOutputScalars &&
+		(KinematicOutputs::GetOutputMask((KinematicOutputs::OutputsComplete)plotID) & ~analyzedMask) != 0)
+		UpdateData();
+}
+
+//==========================================================================
+// Class:			Iteration
+// Function:		GetRequiredOutputMask
+//
+// Description:		Returns the kinematic output groups required by the
+//					active plots.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		KinematicOutputs::OutputMask
+//
+//==========================================================================
+KinematicOutputs::OutputMask Iteration::GetRequiredOutputMask() const
+{
+	KinematicOutputs::OutputMask mask(0);
+	int i;
+	for (i = 0; i < KinematicOutputs::NumberOfOutputScalars; i++)
+	{
+		if (plotActive[i])
+			mask |= KinematicOutputs::GetOutputMask((KinematicOutputs::OutputsComplete)i);
+	}
+
+	return mask;
 }
 
 //==========================================================================
@@ -1485,11 +1511,11 @@ void Iteration::SetAutoAssociate(bool autoAssociate)
 // Class:			Iteration
 // Function:		MarkAnalysisComplete
 //
-// Description:		To be called after one of this object's kinematics analyses
+// Description:		To be called after one of this object's kinematics jobs
 //					completes.
 //
 // Input Arguments:
-//		None
+//		count	= const unsigned int& number of analyses completed by the job
 //
 // Output Arguments:
 //		None
@@ -1498,11 +1524,11 @@ void Iteration::SetAutoAssociate(bool autoAssociate)
 //		None
 //
 //==========================================================================
-void Iteration::MarkAnalysisComplete()
+void Iteration::MarkAnalysisComplete(const unsigned int &count)
 {
-	assert(pendingAnalysisCount > 0);
+	assert(pendingAnalysisCount >= count);
 
-	pendingAnalysisCount--;
+	pendingAnalysisCount -= count;
 	if (pendingAnalysisCount == 0)
 		UpdateDisplay();
 }
\ No newline at end of file
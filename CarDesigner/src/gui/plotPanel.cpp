@@ -2975,19 +2975,11 @@ void PlotPanel::ApplyFilter(const FilterParameters &parameters, Dataset2D &data)
 
 	Filter *filter = GetFilter(parameters, factor / data.GetAverageDeltaX(), data.GetYData(0));
 
-	unsigned int i;
-	for (i = 0; i < data.GetNumberOfPoints(); i++)
-		data.GetYPointer()[i] = filter->Apply(data.GetYData(i));
-
 	// For phaseless filter, re-apply the same filter backwards
 	if (parameters.phaseless)
-	{
-		data.Reverse();
-		filter->Initialize(data.GetYData(0));
-		for (i = 0; i < data.GetNumberOfPoints(); i++)
-			data.GetYPointer()[i] = filter->Apply(data.GetYData(i));
-		data.Reverse();
-	}
+		filter->ApplyZeroPhase(data.GetYPointer(), data.GetYPointer(), data.GetNumberOfPoints());
+	else
+		filter->Apply(data.GetYPointer(), data.GetYPointer(), data.GetNumberOfPoints());
 
 	delete filter;
 }
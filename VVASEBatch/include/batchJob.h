@@ -0,0 +1,172 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  batchJob.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class declaration for the BatchJob class.  This reads a job
+//				 specification (an INI-style file) and runs it without a GUI or event loop.
+//				 The specification looks like this (angles in degrees, distances in inches):
+//
+//				 [Job]
+//				 Type=Sweep					; or Optimization or QuasiStatic
+//				 Output=results.txt			; relative paths are relative to the job file
+//				 Threads=0					; zero to use one thread per CPU
+//
+//				 [Cars]						; any number of entries; names are arbitrary
+//				 Car1=first.car
+//				 Car2=second.car
+//
+//				 [Kinematics]				; same keys as the GUI configuration file
+//				 CenterOfRotationX=0
+//				 CenterOfRotationY=0
+//				 CenterOfRotationZ=0
+//				 FirstRotation=0				; 0 for roll first, 1 for pitch first
+//
+//				 [Sweep]					; equivalent to an Iteration
+//				 NumberOfPoints=50
+//				 StartPitch=0
+//				 EndPitch=0
+//				 StartRoll=0
+//				 EndRoll=0
+//				 StartHeave=-1
+//				 EndHeave=1
+//				 StartRackTravel=0
+//				 EndRackTravel=0
+//				 WarmStart=1				; start each point from the previous points
+//
+//				 [QuasiStatic]				; g-g diagram for each car
+//				 Layout=Grid				; or Polar
+//				 MaximumG=1.5
+//				 Divisions=100				; points along each axis (grid) or number of rings (polar)
+//				 AngularDivisions=72		; points in each ring (polar only)
+//				 RackTravel=0
+//
+//				 [Optimization]				; optimizes the first car listed under [Cars]
+//				 GeneticAlgorithm=goals.ga
+//				 ResultCar=optimized.car
+//				 CacheSize=64				; [MB] for previously evaluated genomes, zero to disable
+//				 Islands=1					; sub-populations that breed independently
+//				 MigrationInterval=10		; generations between migrations (zero for none)
+//				 MigrationCount=1			; citizens sent to the next island in each migration
+//				 Seed=0						; non-zero for repeatable results
+//				 SteadyState=0				; non-zero to breed each child as soon as an evaluation completes
+//				 TournamentSize=2			; citizens competing in each steady-state or multi-objective selection
+//				 MultiObjective=0			; non-zero to keep a Pareto front across the goals (NSGA-II)
+//				 SurrogateFraction=1.0		; fraction of new genomes analyzed after surrogate screening
+//				 RefinementIterations=0		; continuous refinement of the best citizen (zero for none)
+// History:
+
+#ifndef BATCH_JOB_H_
+#define BATCH_JOB_H_
+
+// Standard C++ headers
+#include <vector>
+#include <fstream>
+
+// wxWidgets headers
+#include <wx/wx.h>
+
+// VVASE headers
+#include "vSolver/physics/kinematics.h"
+#include "vSolver/threads/jobQueue.h"
+
+// VVASE forward declarations
+class WorkerThread;
+class Car;
+
+class BatchJob
+{
+public:
+	BatchJob();
+	~BatchJob();
+
+	// Reads the job specification
+	bool Read(const wxString &fileName);
+
+	// Runs the job (returns after all results have been written)
+	bool Run();
+
+	// Overrides the number of threads given in the job specification
+	void SetNumberOfThreads(const unsigned int &numberOfThreads) { this->numberOfThreads = numberOfThreads; }
+
+	// Measures the rate at which jobs can be pushed through the job queue, or
+	// through the original (single lock) queue as a baseline
+	static double BenchmarkQueue(const bool &baseline,
+		const unsigned int &numberOfThreads, const unsigned int &jobCount);
+
+	// Measures the rate at which the sweep described by the job specification
+	// can be solved on a single thread
+	bool BenchmarkSweep(const bool &warmStart, double &pointsPerSecond,
+		double &iterationsPerPoint) const;
+
+	enum JobType
+	{
+		TypeSweep,
+		TypeOptimization,
+		TypeQuasiStatic
+	};
+
+private:
+	JobType type;
+
+	wxString outputFileName;
+	std::vector<wxString> carFileNames;
+	unsigned int numberOfThreads;
+
+	// Sweep parameters
+	Kinematics::Inputs startInputs;
+	Kinematics::Inputs endInputs;
+	unsigned int numberOfPoints;
+	bool warmStart;
+
+	// Quasi-static parameters
+	bool polarLayout;
+	double maximumG;// [G]
+	unsigned int divisions;
+	unsigned int angularDivisions;
+	double rackTravel;// [in]
+
+	// Optimization parameters
+	wxString gaFileName;
+	wxString resultCarFileName;
+	unsigned int cacheSize;// [MB]
+	unsigned int islands;
+	unsigned int migrationInterval;
+	unsigned int migrationCount;
+	unsigned int seed;
+	bool steadyState;
+	unsigned int tournamentSize;
+	bool multiObjective;
+	double surrogateFraction;
+	unsigned int refinementIterations;
+
+	// The thread pool (no event handler - completion is signaled through
+	// the batch data)
+	JobQueue *queue;
+	std::vector<WorkerThread*> threads;
+
+	static void StartThreads(JobQueue &queue, const unsigned int &numberOfThreads,
+		std::vector<WorkerThread*> &threads);
+	static void StopThreads(JobQueue &queue, std::vector<WorkerThread*> &threads);
+	static unsigned int ResolveNumberOfThreads(const unsigned int &numberOfThreads);
+
+	void ComputeSweepInputs(std::vector<Kinematics::Inputs> &inputs) const;
+	bool RunSweep(std::ofstream &outFile);
+	bool RunOptimization(std::ofstream &outFile);
+	bool RunQuasiStatic(std::ofstream &outFile);
+
+	void WriteSweepHeader(std::ofstream &outFile, const wxString &carFileName) const;
+	void WriteSweepRow(std::ofstream &outFile, const Kinematics::Inputs &inputs,
+		const KinematicOutputs &outputs) const;
+
+	static wxString ResolvePath(const wxString &path, const wxString &jobFileName);
+};
+
+#endif// BATCH_JOB_H_
@@ -0,0 +1,43 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  batchOptimization.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class declaration for the BatchOptimization class.  This
+//				 runs a kinematics GA and streams the progress of each generation to a
+//				 file.
+// History:
+
+#ifndef BATCH_OPTIMIZATION_H_
+#define BATCH_OPTIMIZATION_H_
+
+// Standard C++ headers
+#include <fstream>
+
+// VVASE headers
+#include "vSolver/optimization/kinematicsGA.h"
+
+class BatchOptimization : public KinematicsGA
+{
+public:
+	BatchOptimization(JobQueue &queue, std::ofstream &outFile);
+
+	// Writes the weighted error for each goal of each non-dominated citizen
+	// (multi-objective mode only)
+	void WriteParetoFront();
+
+private:
+	std::ofstream &outFile;
+
+	// Writes the fitness summary for each generation
+	void PerformAdditionalActions();
+};
+
+#endif// BATCH_OPTIMIZATION_H_
@@ -0,0 +1,53 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  lockedJobQueue.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class declaration for the LockedJobQueue class.  This is
+//				 the original JobQueue (all producers and consumers share one lock and
+//				 one std::multimap), kept as the baseline for the queue benchmark.  It
+//				 has the same interface as JobQueue so the same benchmark code can be
+//				 used for both.
+// History:
+
+#ifndef LOCKED_JOB_QUEUE_H_
+#define LOCKED_JOB_QUEUE_H_
+
+// Standard C++ headers
+#include <map>
+
+// wxWidgets headers
+#include <wx/thread.h>
+
+// VVASE headers
+#include "vSolver/threads/jobQueue.h"
+#include "vSolver/threads/threadJob.h"
+
+class LockedJobQueue
+{
+public:
+	void AddJob(const ThreadJob& job, const JobQueue::JobPriority& priority = JobQueue::PriorityNormal);
+
+	// All threads share the same multimap, so there is nothing to attach to
+	unsigned int AttachWorker() { return 0; }
+	void DetachWorker(const unsigned int &/*worker*/) {}
+
+	ThreadJob Pop(const unsigned int &worker);
+
+private:
+	// Use of a multimap allow prioritization - lower keys come first, jobs with equal keys are appended
+	std::multimap<JobQueue::JobPriority, ThreadJob> jobs;
+
+	// Thread protection objects
+	wxMutex mutexQueue;
+	wxSemaphore queueCount;
+};
+
+#endif// LOCKED_JOB_QUEUE_H_
@@ -0,0 +1,1052 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  batchJob.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class definition for the BatchJob class.  This reads a job
+//				 specification (an INI-style file) and runs it without a GUI or event loop.
+// History:
+
+// Standard C++ headers
+#include <sstream>
+
+// wxWidgets headers
+#include <wx/fileconf.h>
+#include <wx/filename.h>
+#include <wx/stopwatch.h>
+
+// Local headers
+#include "batchJob.h"
+#include "batchOptimization.h"
+#include "lockedJobQueue.h"
+
+// VVASE headers
+#include "vCar/car.h"
+#include "vSolver/threads/workerThread.h"
+#include "vSolver/threads/threadJob.h"
+#include "vSolver/threads/kinematicsBatchData.h"
+#include "vSolver/threads/inverseSemaphore.h"
+#include "vSolver/physics/quasiStaticSweep.h"
+#include "vUtilities/unitConverter.h"
+#include "vUtilities/debugger.h"
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		BatchJob
+//
+// Description:		Constructor for the BatchJob class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+BatchJob::BatchJob()
+{
+	type = TypeSweep;
+	numberOfThreads = 0;
+	numberOfPoints = 0;
+	warmStart = true;
+	polarLayout = false;
+	maximumG = 0.0;
+	divisions = 0;
+	angularDivisions = 0;
+	rackTravel = 0.0;
+	cacheSize = 64;
+	islands = 1;
+	migrationInterval = 10;
+	migrationCount = 1;
+	seed = 0;
+	steadyState = false;
+	tournamentSize = 2;
+	multiObjective = false;
+	surrogateFraction = 1.0;
+	refinementIterations = 0;
+	queue = NULL;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		~BatchJob
+//
+// Description:		Destructor for the BatchJob class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+BatchJob::~BatchJob()
+{
+	if (queue)
+		StopThreads(*queue, threads);
+
+	delete queue;
+	queue = NULL;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		Read
+//
+// Description:		Reads the job specification from file.  See batchJob.h
+//					for a description of the format.
+//
+// Input Arguments:
+//		fileName	= const wxString& specifying the job file
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//==========================================================================
+bool BatchJob::Read(const wxString &fileName)
+{
+	if (!wxFileExists(fileName))
+	{
+		Debugger::GetInstance() << "ERROR:  Could not find job file '" << fileName << "'" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	wxFileConfig config(wxEmptyString, wxEmptyString, fileName, wxEmptyString, wxCONFIG_USE_LOCAL_FILE);
+
+	// Read JOB section
+	wxString typeString;
+	config.Read(_T("/Job/Type"), &typeString, _T("Sweep"));
+	if (typeString.CmpNoCase(_T("Sweep")) == 0)
+		type = TypeSweep;
+	else if (typeString.CmpNoCase(_T("Optimization")) == 0)
+		type = TypeOptimization;
+	else if (typeString.CmpNoCase(_T("QuasiStatic")) == 0)
+		type = TypeQuasiStatic;
+	else
+	{
+		Debugger::GetInstance() << "ERROR:  Unrecognized job type '" << typeString << "'" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	if (!config.Read(_T("/Job/Output"), &outputFileName) || outputFileName.IsEmpty())
+	{
+		Debugger::GetInstance() << "ERROR:  No output file specified" << Debugger::PriorityHigh;
+		return false;
+	}
+	outputFileName = ResolvePath(outputFileName, fileName);
+
+	long tempLong = 0;
+	config.Read(_T("/Job/Threads"), &tempLong, 0l);
+	if (tempLong > 0)
+		numberOfThreads = tempLong;
+
+	// Read CARS section (entries are kept in the order they appear in the file)
+	carFileNames.clear();
+	config.SetPath(_T("/Cars"));
+	wxString entry;
+	long cookie;
+	bool moreEntries = config.GetFirstEntry(entry, cookie);
+	while (moreEntries)
+	{
+		carFileNames.push_back(ResolvePath(config.Read(entry, wxEmptyString), fileName));
+		moreEntries = config.GetNextEntry(entry, cookie);
+	}
+	config.SetPath(_T("/"));
+
+	if (carFileNames.size() == 0)
+	{
+		Debugger::GetInstance() << "ERROR:  No cars specified" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	// Read KINEMATICS configuration (same keys as the application's configuration file)
+	Kinematics::Inputs inputs;
+	inputs.pitch = 0.0;
+	inputs.roll = 0.0;
+	inputs.heave = 0.0;
+	inputs.rackTravel = 0.0;
+	inputs.tireDeflections.leftFront = 0.0;
+	inputs.tireDeflections.rightFront = 0.0;
+	inputs.tireDeflections.leftRear = 0.0;
+	inputs.tireDeflections.rightRear = 0.0;
+
+	double tempDouble = 0.0;
+	config.Read(_T("/Kinematics/CenterOfRotationX"), &tempDouble);
+	inputs.centerOfRotation.x = tempDouble;
+	tempDouble = 0.0;
+	config.Read(_T("/Kinematics/CenterOfRotationY"), &tempDouble);
+	inputs.centerOfRotation.y = tempDouble;
+	tempDouble = 0.0;
+	config.Read(_T("/Kinematics/CenterOfRotationZ"), &tempDouble);
+	inputs.centerOfRotation.z = tempDouble;
+	inputs.firstRotation = (Vector::Axis)config.Read(_T("/Kinematics/FirstRotation"), 0l);
+
+	startInputs = inputs;
+	endInputs = inputs;
+
+	if (type == TypeSweep)
+	{
+		// Read SWEEP section
+		config.Read(_T("/Sweep/NumberOfPoints"), &tempLong, 50l);
+		if (tempLong < 2)
+		{
+			Debugger::GetInstance() << "ERROR:  Number of points must be at least 2" << Debugger::PriorityHigh;
+			return false;
+		}
+		numberOfPoints = tempLong;
+
+		startInputs.pitch = UnitConverter::DEG_TO_RAD(config.ReadDouble(_T("/Sweep/StartPitch"), 0.0));
+		endInputs.pitch = UnitConverter::DEG_TO_RAD(config.ReadDouble(_T("/Sweep/EndPitch"), 0.0));
+		startInputs.roll = UnitConverter::DEG_TO_RAD(config.ReadDouble(_T("/Sweep/StartRoll"), 0.0));
+		endInputs.roll = UnitConverter::DEG_TO_RAD(config.ReadDouble(_T("/Sweep/EndRoll"), 0.0));
+		startInputs.heave = config.ReadDouble(_T("/Sweep/StartHeave"), 0.0);
+		endInputs.heave = config.ReadDouble(_T("/Sweep/EndHeave"), 0.0);
+		startInputs.rackTravel = config.ReadDouble(_T("/Sweep/StartRackTravel"), 0.0);
+		endInputs.rackTravel = config.ReadDouble(_T("/Sweep/EndRackTravel"), 0.0);
+		config.Read(_T("/Sweep/WarmStart"), &warmStart, true);
+	}
+	else if (type == TypeQuasiStatic)
+	{
+		// Read QUASISTATIC section
+		wxString layoutString;
+		config.Read(_T("/QuasiStatic/Layout"), &layoutString, _T("Grid"));
+		if (layoutString.CmpNoCase(_T("Grid")) == 0)
+			polarLayout = false;
+		else if (layoutString.CmpNoCase(_T("Polar")) == 0)
+			polarLayout = true;
+		else
+		{
+			Debugger::GetInstance() << "ERROR:  Unrecognized layout '" << layoutString << "'" << Debugger::PriorityHigh;
+			return false;
+		}
+
+		maximumG = config.ReadDouble(_T("/QuasiStatic/MaximumG"), 1.5);
+		config.Read(_T("/QuasiStatic/Divisions"), &tempLong, 20l);
+		if (tempLong < 1 || (!polarLayout && tempLong < 2))
+		{
+			Debugger::GetInstance() << "ERROR:  Too few divisions" << Debugger::PriorityHigh;
+			return false;
+		}
+		divisions = tempLong;
+
+		config.Read(_T("/QuasiStatic/AngularDivisions"), &tempLong, 36l);
+		if (polarLayout && tempLong < 1)
+		{
+			Debugger::GetInstance() << "ERROR:  Too few angular divisions" << Debugger::PriorityHigh;
+			return false;
+		}
+		angularDivisions = tempLong;
+
+		rackTravel = config.ReadDouble(_T("/QuasiStatic/RackTravel"), 0.0);
+	}
+	else
+	{
+		// Read OPTIMIZATION section
+		if (!config.Read(_T("/Optimization/GeneticAlgorithm"), &gaFileName) || gaFileName.IsEmpty())
+		{
+			Debugger::GetInstance() << "ERROR:  No genetic algorithm file specified" << Debugger::PriorityHigh;
+			return false;
+		}
+		gaFileName = ResolvePath(gaFileName, fileName);
+
+		if (config.Read(_T("/Optimization/ResultCar"), &resultCarFileName) && !resultCarFileName.IsEmpty())
+			resultCarFileName = ResolvePath(resultCarFileName, fileName);
+
+		config.Read(_T("/Optimization/CacheSize"), &tempLong, 64l);
+		if (tempLong < 0)
+		{
+			Debugger::GetInstance() << "ERROR:  Cache size must not be negative" << Debugger::PriorityHigh;
+			return false;
+		}
+		cacheSize = tempLong;
+
+		config.Read(_T("/Optimization/Islands"), &tempLong, 1l);
+		if (tempLong < 1)
+		{
+			Debugger::GetInstance() << "ERROR:  Number of islands must be at least one" << Debugger::PriorityHigh;
+			return false;
+		}
+		islands = tempLong;
+
+		config.Read(_T("/Optimization/MigrationInterval"), &tempLong, 10l);
+		if (tempLong < 0)
+		{
+			Debugger::GetInstance() << "ERROR:  Migration interval must not be negative" << Debugger::PriorityHigh;
+			return false;
+		}
+		migrationInterval = tempLong;
+
+		config.Read(_T("/Optimization/MigrationCount"), &tempLong, 1l);
+		if (tempLong < 0)
+		{
+			Debugger::GetInstance() << "ERROR:  Migration count must not be negative" << Debugger::PriorityHigh;
+			return false;
+		}
+		migrationCount = tempLong;
+
+		config.Read(_T("/Optimization/Seed"), &tempLong, 0l);
+		seed = (unsigned int)tempLong;
+
+		config.Read(_T("/Optimization/SteadyState"), &tempLong, 0l);
+		steadyState = tempLong != 0;
+
+		config.Read(_T("/Optimization/TournamentSize"), &tempLong, 2l);
+		if (tempLong < 1)
+		{
+			Debugger::GetInstance() << "ERROR:  Tournament size must be at least one" << Debugger::PriorityHigh;
+			return false;
+		}
+		tournamentSize = tempLong;
+
+		config.Read(_T("/Optimization/MultiObjective"), &tempLong, 0l);
+		multiObjective = tempLong != 0;
+
+		config.Read(_T("/Optimization/SurrogateFraction"), &surrogateFraction, 1.0);
+		if (surrogateFraction <= 0.0 || surrogateFraction > 1.0)
+		{
+			Debugger::GetInstance() << "ERROR:  Surrogate fraction must be greater than zero and no more than one" << Debugger::PriorityHigh;
+			return false;
+		}
+
+		config.Read(_T("/Optimization/RefinementIterations"), &tempLong, 0l);
+		if (tempLong < 0)
+		{
+			Debugger::GetInstance() << "ERROR:  Refinement iterations must not be negative" << Debugger::PriorityHigh;
+			return false;
+		}
+		refinementIterations = tempLong;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		Run
+//
+// Description:		Runs the job.  Blocks until all results have been written.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//==========================================================================
+bool BatchJob::Run()
+{
+	std::ofstream outFile(outputFileName.mb_str(), std::ios::out);
+	if (!outFile.is_open() || !outFile.good())
+	{
+		Debugger::GetInstance() << "ERROR:  Could not open '" << outputFileName << "' for output" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	numberOfThreads = ResolveNumberOfThreads(numberOfThreads);
+	queue = new JobQueue(NULL);
+	StartThreads(*queue, numberOfThreads, threads);
+
+	bool success;
+	if (type == TypeSweep)
+		success = RunSweep(outFile);
+	else if (type == TypeQuasiStatic)
+		success = RunQuasiStatic(outFile);
+	else
+		success = RunOptimization(outFile);
+
+	StopThreads(*queue, threads);
+	delete queue;
+	queue = NULL;
+
+	outFile.close();
+
+	return success;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		ComputeSweepInputs
+//
+// Description:		Determines the inputs for each point in the sweep (same as
+//					Iteration::UpdateData()).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		inputs	= std::vector<Kinematics::Inputs>&, one entry per point
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BatchJob::ComputeSweepInputs(std::vector<Kinematics::Inputs> &inputs) const
+{
+	inputs.assign(numberOfPoints, startInputs);
+	unsigned int i;
+	for (i = 0; i < numberOfPoints; i++)
+	{
+		inputs[i].pitch = startInputs.pitch + (endInputs.pitch - startInputs.pitch) * i / (numberOfPoints - 1);
+		inputs[i].roll = startInputs.roll + (endInputs.roll - startInputs.roll) * i / (numberOfPoints - 1);
+		inputs[i].heave = startInputs.heave + (endInputs.heave - startInputs.heave) * i / (numberOfPoints - 1);
+		inputs[i].rackTravel = startInputs.rackTravel
+			+ (endInputs.rackTravel - startInputs.rackTravel) * i / (numberOfPoints - 1);
+	}
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		RunSweep
+//
+// Description:		Solves the kinematics for each car over the specified
+//					range (equivalent to an Iteration).  Each car's results
+//					are written as soon as they are available.
+//
+// Input Arguments:
+//		outFile	= std::ofstream& to which results are written
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if every car was analyzed
+//
+//==========================================================================
+bool BatchJob::RunSweep(std::ofstream &outFile)
+{
+	std::vector<Kinematics::Inputs> inputs;
+	ComputeSweepInputs(inputs);
+	unsigned int i;
+
+	std::vector<KinematicOutputs> outputs(numberOfPoints);
+	const unsigned int batchSize(KinematicsBatchData::ComputeBatchSize(numberOfPoints, numberOfThreads));
+	InverseSemaphore completion;
+	bool success(true);
+
+	// Cars are loaded and analyzed one at a time to keep memory use independent
+	// of the number of cars
+	Car car;
+	unsigned int currentCar;
+	int jobIndex;
+	for (currentCar = 0; currentCar < carFileNames.size(); currentCar++)
+	{
+		if (!car.LoadCarFromFile(carFileNames[currentCar]))
+		{
+			Debugger::GetInstance() << "ERROR:  Could not read car from '"
+				<< carFileNames[currentCar] << "'" << Debugger::PriorityHigh;
+			success = false;
+			continue;
+		}
+
+		completion.Set((numberOfPoints + batchSize - 1) / batchSize);
+
+		jobIndex = currentCar;
+		KinematicsBatchData *data(NULL);
+		for (i = 0; i < numberOfPoints; i++)
+		{
+			if (!data)
+			{
+				data = new KinematicsBatchData;
+				data->completion = &completion;
+				data->warmStart = warmStart;
+			}
+			data->Add(&car, inputs[i], &outputs[i]);
+
+			if (data->GetCount() == batchSize || i == numberOfPoints - 1)
+			{
+				ThreadJob job(ThreadJob::CommandThreadKinematicsIteration, data,
+					carFileNames[currentCar], jobIndex);
+				queue->AddJob(job);
+				data = NULL;
+			}
+		}
+
+		completion.Wait();
+
+		WriteSweepHeader(outFile, carFileNames[currentCar]);
+		for (i = 0; i < numberOfPoints; i++)
+			WriteSweepRow(outFile, inputs[i], outputs[i]);
+		outFile << std::endl;
+
+		Debugger::GetInstance() << "Completed " << carFileNames[currentCar] << Debugger::PriorityVeryHigh;
+	}
+
+	return success;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		RunQuasiStatic
+//
+// Description:		Solves the quasi-static state of each car over the
+//					specified range of accelerations (a g-g diagram).
+//
+// Input Arguments:
+//		outFile	= std::ofstream& to which results are written
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if every car was analyzed
+//
+//==========================================================================
+bool BatchJob::RunQuasiStatic(std::ofstream &outFile)
+{
+	QuasiStaticSweep sweep;
+	if (polarLayout)
+		sweep.SetPolar(maximumG, divisions, angularDivisions);
+	else
+		sweep.SetGrid(-maximumG, maximumG, divisions, -maximumG, maximumG, divisions);
+
+	UnitConverter &converter(UnitConverter::GetInstance());
+	bool success(true);
+	Car car;
+	unsigned int currentCar, i;
+	for (currentCar = 0; currentCar < carFileNames.size(); currentCar++)
+	{
+		if (!car.LoadCarFromFile(carFileNames[currentCar]))
+		{
+			Debugger::GetInstance() << "ERROR:  Could not read car from '"
+				<< carFileNames[currentCar] << "'" << Debugger::PriorityHigh;
+			success = false;
+			continue;
+		}
+
+		sweep.Solve(*queue, numberOfThreads, car, startInputs, rackTravel);
+
+		outFile << "Car:\t" << carFileNames[currentCar].mb_str() << std::endl;
+		outFile << "Gx [G]\tGy [G]"
+			<< "\tRoll [" << converter.GetUnitType(UnitConverter::UnitTypeAngle).mb_str() << "]"
+			<< "\tPitch [" << converter.GetUnitType(UnitConverter::UnitTypeAngle).mb_str() << "]"
+			<< "\tHeave [" << converter.GetUnitType(UnitConverter::UnitTypeDistance).mb_str() << "]"
+			<< "\tLF Load [" << converter.GetUnitType(UnitConverter::UnitTypeForce).mb_str() << "]"
+			<< "\tRF Load [" << converter.GetUnitType(UnitConverter::UnitTypeForce).mb_str() << "]"
+			<< "\tLR Load [" << converter.GetUnitType(UnitConverter::UnitTypeForce).mb_str() << "]"
+			<< "\tRR Load [" << converter.GetUnitType(UnitConverter::UnitTypeForce).mb_str() << "]" << std::endl;
+
+		for (i = 0; i < sweep.GetCount(); i++)
+			outFile << sweep.gx[i] << "\t" << sweep.gy[i]
+				<< "\t" << converter.ConvertAngleOutput(sweep.roll[i])
+				<< "\t" << converter.ConvertAngleOutput(sweep.pitch[i])
+				<< "\t" << converter.ConvertDistanceOutput(sweep.heave[i])
+				<< "\t" << converter.ConvertOutput(sweep.leftFrontLoad[i], UnitConverter::UnitTypeForce)
+				<< "\t" << converter.ConvertOutput(sweep.rightFrontLoad[i], UnitConverter::UnitTypeForce)
+				<< "\t" << converter.ConvertOutput(sweep.leftRearLoad[i], UnitConverter::UnitTypeForce)
+				<< "\t" << converter.ConvertOutput(sweep.rightRearLoad[i], UnitConverter::UnitTypeForce) << "\n";
+		outFile << std::endl;
+
+		Debugger::GetInstance() << "Completed " << carFileNames[currentCar] << Debugger::PriorityVeryHigh;
+	}
+
+	return success;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		RunOptimization
+//
+// Description:		Runs the genetic algorithm against the first car and
+//					writes the fitness of each generation.  The best car is
+//					saved if a result file was specified.
+//
+// Input Arguments:
+//		outFile	= std::ofstream& to which results are written
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//==========================================================================
+bool BatchJob::RunOptimization(std::ofstream &outFile)
+{
+	// Keep anything that follows the car data (the GUI's appearance options) so
+	// that it can be copied to the result file
+	Car targetCar;
+	std::ifstream optionsFile;
+	int fileVersion;
+	if (!targetCar.LoadCarFromFile(carFileNames[0], &optionsFile, &fileVersion))
+	{
+		Debugger::GetInstance() << "ERROR:  Could not read car from '"
+			<< carFileNames[0] << "'" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	std::ostringstream trailingData;
+	if (optionsFile.is_open() && optionsFile.good())
+	{
+		trailingData << optionsFile.rdbuf();
+		optionsFile.close();
+	}
+
+	BatchOptimization optimization(*queue, outFile);
+	if (!optimization.Read(gaFileName))
+	{
+		Debugger::GetInstance() << "ERROR:  Could not read genetic algorithm from '"
+			<< gaFileName << "'" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	if (optimization.GetGeneCount() == 0 || optimization.GetGoalCount() == 0)
+	{
+		Debugger::GetInstance() << "ERROR:  Genetic algorithm must have at least one gene and one goal"
+			<< Debugger::PriorityHigh;
+		return false;
+	}
+
+	optimization.SetNumberOfThreads(numberOfThreads);
+	optimization.SetCacheMemoryLimit((size_t)cacheSize * 1024 * 1024);
+	optimization.SetIslands(islands, migrationInterval, migrationCount);
+	optimization.SetRandomSeed(seed);
+	optimization.SetSteadyState(steadyState, tournamentSize);
+	optimization.SetMultiObjective(multiObjective);
+	optimization.SetSurrogateFraction(surrogateFraction);
+	optimization.SetRefinementIterations(refinementIterations);
+	optimization.SetUp(targetCar);
+
+	outFile << "Generation\tAverage Fitness\tBest Fitness" << std::endl;
+
+	wxStopWatch timer;
+	if (!optimization.PerformOptimization())
+		return false;
+	Debugger::GetInstance() << "Elapsed Time: " << timer.Time() << " msec" << Debugger::PriorityVeryHigh;
+	Debugger::GetInstance() << "Cache Hit Rate: " << optimization.GetCacheHitRate() * 100.0
+		<< "%" << Debugger::PriorityVeryHigh;
+
+	optimization.WriteParetoFront();
+
+	if (resultCarFileName.IsEmpty())
+		return true;
+
+	Car result;
+	optimization.UpdateResultingCar(result);
+
+	std::ofstream resultFile;
+	if (!result.SaveCarToFile(resultCarFileName, &resultFile))
+	{
+		Debugger::GetInstance() << "ERROR:  Could not write car to '"
+			<< resultCarFileName << "'" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	if (resultFile.is_open() && resultFile.good())
+	{
+		resultFile << trailingData.str();
+		resultFile.close();
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		WriteSweepHeader
+//
+// Description:		Writes the column headings for one car's sweep results.
+//
+// Input Arguments:
+//		outFile		= std::ofstream& to write to
+//		carFileName	= const wxString& identifying the car
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BatchJob::WriteSweepHeader(std::ofstream &outFile, const wxString &carFileName) const
+{
+	UnitConverter &converter(UnitConverter::GetInstance());
+
+	outFile << "Car:\t" << carFileName.mb_str() << std::endl;
+
+	outFile << "Pitch [" << converter.GetUnitType(UnitConverter::UnitTypeAngle).mb_str() << "]"
+		<< "\tRoll [" << converter.GetUnitType(UnitConverter::UnitTypeAngle).mb_str() << "]"
+		<< "\tHeave [" << converter.GetUnitType(UnitConverter::UnitTypeDistance).mb_str() << "]"
+		<< "\tRack Travel [" << converter.GetUnitType(UnitConverter::UnitTypeDistance).mb_str() << "]";
+
+	int i;
+	for (i = 0; i < KinematicOutputs::NumberOfOutputScalars; i++)
+		outFile << "\t" << KinematicOutputs::GetOutputName((KinematicOutputs::OutputsComplete)i).mb_str()
+			<< " [" << converter.GetUnitType(KinematicOutputs::GetOutputUnitType(
+			(KinematicOutputs::OutputsComplete)i)).mb_str() << "]";
+
+	outFile << std::endl;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		WriteSweepRow
+//
+// Description:		Writes the results for one point in a sweep.
+//
+// Input Arguments:
+//		outFile	= std::ofstream& to write to
+//		inputs	= const Kinematics::Inputs& at which the outputs were computed
+//		outputs	= const KinematicOutputs& to write
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BatchJob::WriteSweepRow(std::ofstream &outFile, const Kinematics::Inputs &inputs,
+	const KinematicOutputs &outputs) const
+{
+	UnitConverter &converter(UnitConverter::GetInstance());
+
+	outFile << converter.ConvertAngleOutput(inputs.pitch)
+		<< "\t" << converter.ConvertAngleOutput(inputs.roll)
+		<< "\t" << converter.ConvertDistanceOutput(inputs.heave)
+		<< "\t" << converter.ConvertDistanceOutput(inputs.rackTravel);
+
+	int i;
+	for (i = 0; i < KinematicOutputs::NumberOfOutputScalars; i++)
+		outFile << "\t" << converter.ConvertOutput(
+			outputs.GetOutputValue((KinematicOutputs::OutputsComplete)i),
+			KinematicOutputs::GetOutputUnitType((KinematicOutputs::OutputsComplete)i));
+
+	outFile << "\n";
+}
+
+//==========================================================================
+// Class:			QueueBenchmarkThread
+// Function:		QueueBenchmarkThread
+//
+// Description:		Pulls empty jobs from a queue (either the job queue or the
+//					baseline) until it is told to exit.  For use by
+//					BatchJob::BenchmarkQueue() only.
+//
+// Input Arguments:
+//		queue	= Queue& from which jobs are pulled
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template <class Queue>
+class QueueBenchmarkThread : public wxThread
+{
+public:
+	QueueBenchmarkThread(Queue &queue) : wxThread(wxTHREAD_JOINABLE), queue(queue)
+	{
+		wxThread::Create();
+	}
+
+protected:
+	ExitCode Entry()
+	{
+		const unsigned int worker(queue.AttachWorker());
+		while (queue.Pop(worker).command != ThreadJob::CommandThreadExit)
+		{
+		}
+
+		queue.DetachWorker(worker);
+		return NULL;
+	}
+
+private:
+	Queue &queue;
+};
+
+//==========================================================================
+// Class:			None
+// Function:		MeasureQueueThroughput
+//
+// Description:		Pushes empty jobs (spread over the priorities) through the
+//					queue from the calling thread, while the specified number
+//					of threads pull them, and measures the throughput.
+//
+// Input Arguments:
+//		queue			= Queue& to measure (must be empty)
+//		numberOfThreads	= const unsigned int& number of threads pulling jobs
+//		jobCount		= const unsigned int& number of jobs to push
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double, jobs per second
+//
+//==========================================================================
+template <class Queue>
+static double MeasureQueueThroughput(Queue &queue, const unsigned int &numberOfThreads,
+	const unsigned int &jobCount)
+{
+	std::vector<QueueBenchmarkThread<Queue>*> threads;
+	unsigned int i;
+	for (i = 0; i < numberOfThreads; i++)
+	{
+		threads.push_back(new QueueBenchmarkThread<Queue>(queue));
+		threads.back()->Run();
+	}
+
+	wxStopWatch timer;
+	for (i = 0; i < jobCount; i++)
+		queue.AddJob(ThreadJob(ThreadJob::CommandThreadNull), (JobQueue::JobPriority)(i % JobQueue::PriorityIdle));
+
+	// The exit jobs have the lowest priority, so they are taken after all of the others
+	for (i = 0; i < threads.size(); i++)
+		queue.AddJob(ThreadJob(ThreadJob::CommandThreadExit), JobQueue::PriorityIdle);
+
+	for (i = 0; i < threads.size(); i++)
+	{
+		threads[i]->Wait();
+		delete threads[i];
+	}
+
+	long elapsed(timer.Time());
+	if (elapsed < 1)
+		elapsed = 1;
+
+	return jobCount * 1000.0 / elapsed;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		BenchmarkQueue
+//
+// Description:		Measures the rate at which empty jobs can be pushed
+//					through the job queue or through the baseline (the
+//					original queue, with a single lock and a std::multimap).
+//
+// Input Arguments:
+//		baseline		= const bool&, true to measure the baseline queue
+//		numberOfThreads	= const unsigned int& number of threads pulling jobs
+//						  (zero for one per CPU)
+//		jobCount		= const unsigned int& number of jobs to push
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double, jobs per second
+//
+//==========================================================================
+double BatchJob::BenchmarkQueue(const bool &baseline,
+	const unsigned int &numberOfThreads, const unsigned int &jobCount)
+{
+	if (baseline)
+	{
+		LockedJobQueue queue;
+		return MeasureQueueThroughput(queue, ResolveNumberOfThreads(numberOfThreads), jobCount);
+	}
+
+	JobQueue queue(NULL);
+	return MeasureQueueThroughput(queue, ResolveNumberOfThreads(numberOfThreads), jobCount);
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		BenchmarkSweep
+//
+// Description:		Solves the sweep for each car on the calling thread (no
+//					queue overhead) and measures the throughput.  The sweep is
+//					repeated until enough time has elapsed for a reliable
+//					measurement.
+//
+// Input Arguments:
+//		warmStart	= const bool& indicating whether or not each point should be
+//					  started from the previous points
+//
+// Output Arguments:
+//		pointsPerSecond		= double&
+//		iterationsPerPoint	= double&, contact patch iterations (summed over the
+//							  corners) per point
+//
+// Return Value:
+//		bool, true if every car was analyzed
+//
+//==========================================================================
+bool BatchJob::BenchmarkSweep(const bool &warmStart, double &pointsPerSecond,
+	double &iterationsPerPoint) const
+{
+	if (type != TypeSweep)
+	{
+		Debugger::GetInstance() << "ERROR:  Sweep benchmark requires a sweep job" << Debugger::PriorityHigh;
+		return false;
+	}
+
+	std::vector<Kinematics::Inputs> inputs;
+	std::vector<KinematicOutputs> outputs;
+	ComputeSweepInputs(inputs);
+
+	Kinematics kinematics;
+	kinematics.SetWarmStart(warmStart);
+
+	const long minimumTime(1000);// [msec]
+	long elapsed(0);
+	unsigned long points(0), iterations(0);
+	Car car;
+	unsigned int currentCar;
+	for (currentCar = 0; currentCar < carFileNames.size(); currentCar++)
+	{
+		if (!car.LoadCarFromFile(carFileNames[currentCar]))
+		{
+			Debugger::GetInstance() << "ERROR:  Could not read car from '"
+				<< carFileNames[currentCar] << "'" << Debugger::PriorityHigh;
+			return false;
+		}
+
+		wxStopWatch timer;
+		do
+		{
+			kinematics.SolveSweep(car, inputs, outputs);
+			points += inputs.size();
+			iterations += kinematics.GetIterationCount();
+		} while (timer.Time() < minimumTime);
+		elapsed += timer.Time();
+	}
+
+	pointsPerSecond = points * 1000.0 / elapsed;
+	iterationsPerPoint = (double)iterations / points;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		StartThreads
+//
+// Description:		Creates the worker threads.  The threads are joinable so
+//					that they can be waited on before the queue is destroyed.
+//
+// Input Arguments:
+//		queue			= JobQueue& from which the threads pull jobs
+//		numberOfThreads	= const unsigned int& number of threads to create
+//
+// Output Arguments:
+//		threads			= std::vector<WorkerThread*>& containing the new threads
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BatchJob::StartThreads(JobQueue &queue, const unsigned int &numberOfThreads,
+	std::vector<WorkerThread*> &threads)
+{
+	unsigned int i;
+	for (i = 0; i < numberOfThreads; i++)
+	{
+		WorkerThread *newThread = new WorkerThread(&queue, i, wxTHREAD_JOINABLE);
+		newThread->Run();
+		threads.push_back(newThread);
+	}
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		StopThreads
+//
+// Description:		Tells each worker thread to exit, and waits for them all
+//					to finish.
+//
+// Input Arguments:
+//		queue	= JobQueue& from which the threads pull jobs
+//		threads	= std::vector<WorkerThread*>& to stop
+//
+// Output Arguments:
+//		threads	= std::vector<WorkerThread*>& (empty on return)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BatchJob::StopThreads(JobQueue &queue, std::vector<WorkerThread*> &threads)
+{
+	unsigned int i;
+	for (i = 0; i < threads.size(); i++)
+		queue.AddJob(ThreadJob(ThreadJob::CommandThreadExit), JobQueue::PriorityVeryHigh);
+
+	for (i = 0; i < threads.size(); i++)
+	{
+		threads[i]->Wait();
+		delete threads[i];
+	}
+
+	threads.clear();
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		ResolveNumberOfThreads
+//
+// Description:		Converts a requested number of threads (zero for one per
+//					CPU) into an actual number of threads.
+//
+// Input Arguments:
+//		numberOfThreads	= const unsigned int& requested number of threads
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, at least one
+//
+//==========================================================================
+unsigned int BatchJob::ResolveNumberOfThreads(const unsigned int &numberOfThreads)
+{
+	if (numberOfThreads > 0)
+		return numberOfThreads;
+
+	int cpuCount = wxThread::GetCPUCount();
+	if (cpuCount < 1)
+		return 1;
+
+	return cpuCount;
+}
+
+//==========================================================================
+// Class:			BatchJob
+// Function:		ResolvePath
+//
+// Description:		Interprets relative paths as relative to the directory
+//					containing the job file.
+//
+// Input Arguments:
+//		path		= const wxString& as given in the job file
+//		jobFileName	= const wxString& path to the job file
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString containing the resolved path
+//
+//==========================================================================
+wxString BatchJob::ResolvePath(const wxString &path, const wxString &jobFileName)
+{
+	wxFileName fileName(path);
+	if (fileName.IsAbsolute())
+		return path;
+
+	fileName.MakeAbsolute(wxFileName(jobFileName).GetPath());
+	return fileName.GetFullPath();
+}
@@ -0,0 +1,159 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  batchMain.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Entry point for vvase-batch, the headless batch analysis tool.  Runs
+//				 a job specification (see batchJob.h) using all available cores,
+//				 without a display or an event loop.
+// History:
+
+// Standard C++ headers
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+// wxWidgets headers
+#include <wx/init.h>
+
+// Local headers
+#include "batchJob.h"
+
+// VVASE headers
+#include "vUtilities/debugLog.h"
+#include "vUtilities/debugger.h"
+
+//==========================================================================
+// Class:			None
+// Function:		PrintUsage
+//
+// Description:		Prints the command line usage.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+static void PrintUsage()
+{
+	std::cout << "Usage:  vvase-batch [--threads <count>] <job file>" << std::endl;
+	std::cout << "        vvase-batch --benchmark-queue [--threads <count>] [--jobs <count>]" << std::endl;
+	std::cout << "        vvase-batch --benchmark-sweep <job file>" << std::endl;
+	std::cout << std::endl;
+	std::cout << "  --threads <count>   Number of worker threads (default is one per CPU)" << std::endl;
+	std::cout << "  --benchmark-queue   Compare job queue throughput with the original single-lock queue" << std::endl;
+	std::cout << "  --jobs <count>      Number of jobs to push through the queue for the benchmark" << std::endl;
+	std::cout << "  --benchmark-sweep   Compare sweep throughput with and without warm start (single thread)" << std::endl;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		main
+//
+// Description:		Application entry point.
+//
+// Input Arguments:
+//		argc	= int, number of arguments
+//		argv	= char*[], arguments
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, zero for success
+//
+//==========================================================================
+int main(int argc, char *argv[])
+{
+	wxInitializer initializer(argc, argv);
+	if (!initializer.IsOk())
+	{
+		std::cerr << "Failed to initialize wxWidgets" << std::endl;
+		return 1;
+	}
+
+	unsigned int numberOfThreads(0), jobCount(100000);
+	bool benchmarkQueue(false), benchmarkSweep(false);
+	wxString jobFileName;
+
+	int i;
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+			numberOfThreads = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+			jobCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--benchmark-queue") == 0)
+			benchmarkQueue = true;
+		else if (strcmp(argv[i], "--benchmark-sweep") == 0)
+			benchmarkSweep = true;
+		else if (argv[i][0] != '-' && jobFileName.IsEmpty())
+			jobFileName = wxString(argv[i]);
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	int returnValue(0);
+	if (benchmarkQueue)
+	{
+		std::cout << "Single lock (original):  " << BatchJob::BenchmarkQueue(true, numberOfThreads, jobCount)
+			<< " jobs/sec" << std::endl;
+		std::cout << "Work stealing:           " << BatchJob::BenchmarkQueue(false, numberOfThreads, jobCount)
+			<< " jobs/sec" << std::endl;
+	}
+	else if (jobFileName.IsEmpty())
+	{
+		PrintUsage();
+		returnValue = 1;
+	}
+	else
+	{
+		BatchJob job;
+		double pointsPerSecond, iterationsPerPoint;
+		if (!job.Read(jobFileName))
+			returnValue = 1;
+		else if (benchmarkSweep)
+		{
+			if (!job.BenchmarkSweep(false, pointsPerSecond, iterationsPerPoint))
+				returnValue = 1;
+			else
+			{
+				std::cout << "Cold start:  " << pointsPerSecond << " points/sec, "
+					<< iterationsPerPoint << " iterations/point" << std::endl;
+				if (!job.BenchmarkSweep(true, pointsPerSecond, iterationsPerPoint))
+					returnValue = 1;
+				else
+					std::cout << "Warm start:  " << pointsPerSecond << " points/sec, "
+						<< iterationsPerPoint << " iterations/point" << std::endl;
+			}
+		}
+		else
+		{
+			if (numberOfThreads > 0)
+				job.SetNumberOfThreads(numberOfThreads);
+
+			if (!job.Run())
+				returnValue = 1;
+		}
+	}
+
+	DebugLog::Kill();
+	Debugger::Kill();
+
+	return returnValue;
+}
@@ -0,0 +1,115 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  batchOptimization.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class definition for the BatchOptimization class.  This
+//				 runs a kinematics GA and streams the progress of each generation to a
+//				 file.
+// History:
+
+// Local headers
+#include "batchOptimization.h"
+
+//==========================================================================
+// Class:			BatchOptimization
+// Function:		BatchOptimization
+//
+// Description:		Constructor for the BatchOptimization class.
+//
+// Input Arguments:
+//		queue	= JobQueue& to which analyses are sent
+//		outFile	= std::ofstream& to which the results are written
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+BatchOptimization::BatchOptimization(JobQueue &queue, std::ofstream &outFile)
+	: KinematicsGA(queue), outFile(outFile)
+{
+}
+
+//==========================================================================
+// Class:			BatchOptimization
+// Function:		PerformAdditionalActions
+//
+// Description:		Writes the average and best fitness of the generation that
+//					was just completed.  The file is flushed so progress can
+//					be monitored while the optimization is running.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BatchOptimization::PerformAdditionalActions()
+{
+	double averageFitness = 0.0;
+	int i;
+	for (i = 0; i < populationSize; i++)
+		averageFitness += GetFitnesses(currentGeneration)[i];
+	averageFitness /= (double)populationSize;
+
+	outFile << currentGeneration + 1 << "\t" << averageFitness << "\t"
+		<< GetBestFitness(currentGeneration) << std::endl;
+
+	KinematicsGA::PerformAdditionalActions();
+}
+
+//==========================================================================
+// Class:			BatchOptimization
+// Function:		WriteParetoFront
+//
+// Description:		Writes the objectives (the weighted error for each goal)
+//					and the fitness of each citizen in the Pareto front of the
+//					final generation.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BatchOptimization::WriteParetoFront()
+{
+	wxMutexLocker lock(gsaMutex);
+	if (!multiObjective || currentGeneration < 0)
+		return;
+
+	outFile << std::endl << "Pareto Front (weighted error for each goal)" << std::endl;
+	outFile << "Citizen\tFitness";
+
+	int i, j;
+	for (i = 0; i < numberOfObjectives; i++)
+		outFile << "\t" << KinematicOutputs::GetOutputName(GetGoal(i).output).mb_str();
+	outFile << std::endl;
+
+	const double *objectives(GetObjectives(currentGeneration));
+	for (i = 0; i < paretoFrontSize; i++)
+	{
+		outFile << i + 1 << "\t" << GetFitnesses(currentGeneration)[i];
+		for (j = 0; j < numberOfObjectives; j++)
+			outFile << "\t" << objectives[i * numberOfObjectives + j];
+		outFile << std::endl;
+	}
+}
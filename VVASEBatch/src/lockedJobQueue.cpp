@@ -0,0 +1,86 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  lockedJobQueue.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class definition for the LockedJobQueue class.  This is
+//				 the original JobQueue (all producers and consumers share one lock and
+//				 one std::multimap), kept as the baseline for the queue benchmark.
+// History:
+
+// Local headers
+#include "lockedJobQueue.h"
+
+// VVASE headers
+#include "vUtilities/debugLog.h"
+
+//==========================================================================
+// Class:			LockedJobQueue
+// Function:		AddJob
+//
+// Description:		Adds a job to the queue
+//
+// Input Arguments:
+//		job			= const ThreadJob& to be added to the queue
+//		priority	= const JobQueue::JobPriority& of the new job
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LockedJobQueue::AddJob(const ThreadJob& job, const JobQueue::JobPriority& priority)
+{
+	wxMutexLocker lock(mutexQueue);
+	DebugLog::GetInstance()->Log(_T("LockedJobQueue::AddJob (locker)"));
+
+	jobs.insert(std::pair<JobQueue::JobPriority, ThreadJob>(priority, job));
+
+	queueCount.Post();
+}
+
+//==========================================================================
+// Class:			LockedJobQueue
+// Function:		Pop
+//
+// Description:		Pulls the next job from the queue.  Prioritization happens
+//					in the std::map object, so prioritization is not seen
+//					in this function.
+//
+// Input Arguments:
+//		worker	= const unsigned int& (unused)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ThreadJob to be executed
+//
+//==========================================================================
+ThreadJob LockedJobQueue::Pop(const unsigned int &/*worker*/)
+{
+	ThreadJob nextJob;
+
+	queueCount.Wait();
+
+	wxMutexLocker lock(mutexQueue);
+	DebugLog::GetInstance()->Log(_T("LockedJobQueue::Pop (lock)"));
+
+	// Get the first job from the queue (prioritization occurs automatically)
+	nextJob = jobs.begin()->second;
+
+	jobs.erase(jobs.begin());
+
+	DebugLog::GetInstance()->Log(_T("LockedJobQueue::Pop (unlock)"));
+
+	return nextJob;
+}
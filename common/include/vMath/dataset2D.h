@@ -43,7 +43,7 @@ public:
 
 	unsigned int GetNumberOfPoints() const { return numberOfPoints; }
 	unsigned int GetNumberOfZoomedPoints(const double &min, const double &max) const;
-	double *GetXPointer() { return xData; }
+	double *GetXPointer() { xOrder = XOrderUnknown; return xData; }
 	double *GetYPointer() { return yData; }
 	const double *GetXPointer() const { return xData; }
 	const double *GetYPointer() const { return yData; }
@@ -117,6 +117,22 @@ private:
 	unsigned int numberOfPoints;
 	double *xData, *yData;
 
+	// Whether or not the x-data is non-decreasing, so that it can be searched with
+	// a binary search.  Determined when first required; any non-const access to
+	// the x-data resets it.
+	enum XOrder
+	{
+		XOrderUnknown,
+		XOrderIncreasing,
+		XOrderUnordered
+	};
+
+	mutable XOrder xOrder;
+
+	bool XIsIncreasing() const;
+	bool InterpolateAt(const unsigned int &i, const double &x, double &y, bool *exactValue = NULL) const;
+	bool GetYAtFrom(const double &x, double &y, unsigned int &start) const;
+
 	static void GetOverlappingOnSameTimebase(const Dataset2D &d1,
 		const Dataset2D &d2, Dataset2D &d1Out, Dataset2D &d2Out);
 };
@@ -20,6 +20,8 @@
 #include <queue>
 #include <stack>
 #include <string>
+#include <vector>
+#include <list>
 
 // Local headers
 #include "vUtilities/managedList.h"
@@ -48,17 +50,95 @@ private:
 
 	std::queue<wxString> outputQueue;
 
+	// Dataset expressions are compiled into a program (one instruction per term
+	// in the output queue).  During evaluation, consecutive element-wise
+	// instructions are collected into kernels which make a single pass over the data.
+	enum OpCode
+	{
+		OpConstant,
+		OpDataset,
+		OpNegate,
+		OpAdd,// Binary operations from here...
+		OpSubtract,
+		OpMultiply,
+		OpDivide,
+		OpModulo,
+		OpPower,// ...to here
+		OpLog,
+		OpLog10,
+		OpExp,
+		OpAbs,
+		OpSin,
+		OpCos,
+		OpTan,
+		OpArcSin,
+		OpArcCos,
+		OpArcTan,
+		OpIntegral,
+		OpDerivative,
+		OpFFT
+	};
+
+	struct Instruction
+	{
+		Instruction(const OpCode &code, const double &value = 0.0,
+			const unsigned int &index = 0) : code(code), value(value), index(index) {}
+
+		OpCode code;
+		double value;// For OpConstant
+		unsigned int index;// For OpDataset (set ID in the program, source in a kernel)
+	};
+
+	std::vector<Instruction> program;
+
+	// Operand on the evaluation stack; either a number or a kernel which computes
+	// y-values on the x-values of timebase
+	struct Term
+	{
+		Term(const double &value = 0.0) : value(value), timebase(NULL), set(NULL), depth(0) {}
+
+		double value;
+		const Dataset2D *timebase;// NULL for numbers
+		const Dataset2D *set;// Non-NULL if the kernel only reads this dataset
+		std::vector<Instruction> code;
+		std::vector<const double*> sources;
+		unsigned int depth;// Number of blocks required to execute the kernel
+	};
+
+	static const unsigned int blockSize;
+
 	wxString ParseExpression(const wxString &expression);
 	wxString ParseNext(const wxString &expression, bool &lastWasOperator,
 		unsigned int &advance, std::stack<wxString> &operatorStack);
 	wxString EvaluateExpression(Dataset2D &results);
+
+	wxString CompileExpression();
+	wxString CompileFunction(const wxString &function, std::vector<bool> &isNumber);
+	wxString CompileOperator(const wxString &operation, std::vector<bool> &isNumber);
+	wxString CompileNumber(const wxString &number, std::vector<bool> &isNumber);
+	wxString CompileDataset(const wxString &dataset, std::vector<bool> &isNumber);
+
+	static bool GetFunctionCode(const wxString &function, OpCode &code);
+	static OpCode GetOperatorCode(const wxString &operation);
+	static bool IsBinaryOperation(const OpCode &code);
+
+	Term MakeSetTerm(const unsigned int &i) const;
+	static Term MakeSetTerm(const Dataset2D &set);
+
+	void ApplyFunction(const OpCode &code, Term &term, std::list<Dataset2D> &temporaries) const;
+	void ApplyOperation(const OpCode &code, Term &left, const Term &right,
+		std::list<Dataset2D> &temporaries) const;
+
+	static bool SameTimebase(const Dataset2D &a, const Dataset2D &b);
+	const Dataset2D& Evaluate(const Term &term, std::list<Dataset2D> &temporaries) const;
+	void ExecuteKernel(const Term &term, double *y) const;
+	static void ComputeBlock(const OpCode &code, double *left,
+		const double *right, const unsigned int &size);
 	std::string EvaluateExpression(std::string &results);
 
 	void ProcessOperator(std::stack<wxString> &operatorStack, const wxString &s);
 	void ProcessCloseParenthese(std::stack<wxString> &operatorStack);
 
-	Dataset2D GetSetFromList(const unsigned int &i) const;
-
 	static bool NextIsNumber(const wxString &s, unsigned int *stop = NULL, const bool &lastWasOperator = true);
 	static bool NextIsDataset(const wxString &s, unsigned int *stop = NULL, const bool &lastWasOperator = true);
 	static bool NextIsFunction(const wxString &s, unsigned int *stop = NULL);
@@ -77,32 +157,10 @@ private:
 
 	void PushToStack(const double &value, std::stack<double> &doubleStack,
 		std::stack<bool> &useDoubleStack) const;
-	void PushToStack(const Dataset2D &dataset, std::stack<Dataset2D> &setStack,
-		std::stack<bool> &useDoubleStack) const;
-	bool PopFromStack(std::stack<double> &doubleStack, std::stack<Dataset2D> &setStack,
-		std::stack<bool> &useDoubleStack, double &value, Dataset2D &dataset) const;
-
-	Dataset2D ApplyFunction(const wxString &function, const Dataset2D &set) const;
-	double ApplyFunction(const wxString &function, const double &value) const;
-	Dataset2D ApplyOperation(const wxString &operation, const Dataset2D &first, const Dataset2D &second) const;
-	Dataset2D ApplyOperation(const wxString &operation, const Dataset2D &first, const double &second) const;
-	Dataset2D ApplyOperation(const wxString &operation, const double &first, const Dataset2D &second) const;
 	double ApplyOperation(const wxString &operation, const double &first, const double &second) const;
 
-	bool FunctionRequiresDataset(const wxString &function) const;
-
-	bool EvaluateNext(const wxString &next, std::stack<double> &doubleStack,
-		std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const;
-	bool EvaluateFunction(const wxString &function, std::stack<double> &doubleStack,
-		std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const;
-	bool EvaluateOperator(const wxString &operation, std::stack<double> &doubleStack,
-		std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const;
-	bool EvaluateUnaryOperator(const wxString &operation, std::stack<double> &doubleStack,
-		std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const;
 	bool EvaluateNumber(const wxString &number, std::stack<double> &doubleStack,
 		std::stack<bool> &useDoubleStack, wxString &errorString) const;
-	bool EvaluateDataset(const wxString &dataset, std::stack<Dataset2D> &setStack,
-		std::stack<bool> &useDoubleStack, wxString &errorString) const;
 
 	void PushToStack(const wxString &s, std::stack<wxString> &stringStack,
 		std::stack<bool> &useDoubleStack) const;
@@ -0,0 +1,600 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  fixedMatrix.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains class declaration and definition for the FixedMatrix class
+//				 template.  Unlike Matrix, the dimensions are known at compile time and
+//				 the elements are stored inline, so temporaries never allocate memory.
+//				 Intended for the small systems solved inside iterative loops.
+// History:
+
+#ifndef FIXED_MATRIX_H_
+#define FIXED_MATRIX_H_
+
+// Standard C++ headers
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+// Local headers
+#include "vMath/matrix.h"
+
+template<unsigned int R, unsigned int C>
+class FixedMatrix
+{
+public:
+	static constexpr unsigned int rows = R;
+	static constexpr unsigned int columns = C;
+
+	// Constructors (elements are initialized to zero)
+	FixedMatrix();
+	explicit FixedMatrix(const Matrix &m);
+
+	// Conversion to a (heap-allocated) Matrix
+	Matrix ToMatrix() const;
+
+	void Zero();
+
+	inline unsigned int GetNumberOfRows() const { return R; }
+	inline unsigned int GetNumberOfColumns() const { return C; }
+
+	// Operators
+	inline double &operator () (const unsigned int &row, const unsigned int &column)
+	{ assert(row < R && column < C); return elements[row][column]; }
+	inline const double &operator () (const unsigned int &row, const unsigned int &column) const
+	{ assert(row < R && column < C); return elements[row][column]; }
+
+	FixedMatrix& operator += (const FixedMatrix &m);
+	FixedMatrix& operator -= (const FixedMatrix &m);
+	FixedMatrix& operator *= (const double &n);
+	FixedMatrix& operator /= (const double &n);
+	const FixedMatrix operator + (const FixedMatrix &m) const;
+	const FixedMatrix operator - (const FixedMatrix &m) const;
+	const FixedMatrix operator * (const double &n) const;
+	const FixedMatrix operator / (const double &n) const;
+
+	template<unsigned int K>
+	const FixedMatrix<R, K> operator * (const FixedMatrix<C, K> &m) const;
+
+	FixedMatrix<C, R> GetTranspose() const;
+
+	// x = A \ b (least-squares solution when R > C)
+	template<unsigned int K>
+	bool LeftDivide(const FixedMatrix<R, K> &b, FixedMatrix<C, K> &x) const;
+
+	// Sum of the absolute values of the elements (same as Matrix::GetNorm())
+	double GetNorm() const;
+
+private:
+	double elements[R][C];
+};
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		FixedMatrix
+//
+// Description:		Constructor for the FixedMatrix class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+FixedMatrix<R, C>::FixedMatrix()
+{
+	Zero();
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		FixedMatrix
+//
+// Description:		Constructor for the FixedMatrix class.  Copies the
+//					elements of a Matrix with the same dimensions.
+//
+// Input Arguments:
+//		m	= const Matrix& to copy
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+FixedMatrix<R, C>::FixedMatrix(const Matrix &m)
+{
+	assert(m.GetNumberOfRows() == R && m.GetNumberOfColumns() == C);
+
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			elements[i][j] = m(i, j);
+	}
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		ToMatrix
+//
+// Description:		Returns a Matrix containing the same elements.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Matrix
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+Matrix FixedMatrix<R, C>::ToMatrix() const
+{
+	Matrix m(R, C);
+
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			m(i, j) = elements[i][j];
+	}
+
+	return m;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		Zero
+//
+// Description:		Sets all elements to zero.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+void FixedMatrix<R, C>::Zero()
+{
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			elements[i][j] = 0.0;
+	}
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator +=
+//
+// Description:		Addition assignment operator for the FixedMatrix class.
+//
+// Input Arguments:
+//		m	= const FixedMatrix& to add
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FixedMatrix& reference to this
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+FixedMatrix<R, C>& FixedMatrix<R, C>::operator += (const FixedMatrix &m)
+{
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			elements[i][j] += m.elements[i][j];
+	}
+
+	return *this;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator -=
+//
+// Description:		Subtraction assignment operator for the FixedMatrix class.
+//
+// Input Arguments:
+//		m	= const FixedMatrix& to subtract
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FixedMatrix& reference to this
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+FixedMatrix<R, C>& FixedMatrix<R, C>::operator -= (const FixedMatrix &m)
+{
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			elements[i][j] -= m.elements[i][j];
+	}
+
+	return *this;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator *=
+//
+// Description:		Scalar multiplication assignment operator for the
+//					FixedMatrix class.
+//
+// Input Arguments:
+//		n	= const double& to multiply by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FixedMatrix& reference to this
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+FixedMatrix<R, C>& FixedMatrix<R, C>::operator *= (const double &n)
+{
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			elements[i][j] *= n;
+	}
+
+	return *this;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator /=
+//
+// Description:		Scalar division assignment operator for the FixedMatrix
+//					class.
+//
+// Input Arguments:
+//		n	= const double& to divide by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FixedMatrix& reference to this
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+FixedMatrix<R, C>& FixedMatrix<R, C>::operator /= (const double &n)
+{
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			elements[i][j] /= n;
+	}
+
+	return *this;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator +
+//
+// Description:		Addition operator for the FixedMatrix class.
+//
+// Input Arguments:
+//		m	= const FixedMatrix& to add
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const FixedMatrix, the sum
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+const FixedMatrix<R, C> FixedMatrix<R, C>::operator + (const FixedMatrix &m) const
+{
+	FixedMatrix<R, C> result(*this);
+	result += m;
+	return result;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator -
+//
+// Description:		Subtraction operator for the FixedMatrix class.
+//
+// Input Arguments:
+//		m	= const FixedMatrix& to subtract
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const FixedMatrix, the difference
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+const FixedMatrix<R, C> FixedMatrix<R, C>::operator - (const FixedMatrix &m) const
+{
+	FixedMatrix<R, C> result(*this);
+	result -= m;
+	return result;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator *
+//
+// Description:		Scalar multiplication operator for the FixedMatrix class.
+//
+// Input Arguments:
+//		n	= const double& to multiply by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const FixedMatrix, the product
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+const FixedMatrix<R, C> FixedMatrix<R, C>::operator * (const double &n) const
+{
+	FixedMatrix<R, C> result(*this);
+	result *= n;
+	return result;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator /
+//
+// Description:		Scalar division operator for the FixedMatrix class.
+//
+// Input Arguments:
+//		n	= const double& to divide by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const FixedMatrix, the quotient
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+const FixedMatrix<R, C> FixedMatrix<R, C>::operator / (const double &n) const
+{
+	FixedMatrix<R, C> result(*this);
+	result /= n;
+	return result;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		operator *
+//
+// Description:		Matrix multiplication operator for the FixedMatrix class.
+//					The dimensions are checked at compile time.
+//
+// Input Arguments:
+//		m	= const FixedMatrix<C, K>& to multiply by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const FixedMatrix<R, K>, the product
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+template<unsigned int K>
+const FixedMatrix<R, K> FixedMatrix<R, C>::operator * (const FixedMatrix<C, K> &m) const
+{
+	FixedMatrix<R, K> result;
+
+	unsigned int i, j, k;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < K; j++)
+		{
+			for (k = 0; k < C; k++)
+				result(i, j) += elements[i][k] * m(k, j);
+		}
+	}
+
+	return result;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		GetTranspose
+//
+// Description:		Returns the transpose of this matrix.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FixedMatrix<C, R>
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+FixedMatrix<C, R> FixedMatrix<R, C>::GetTranspose() const
+{
+	FixedMatrix<C, R> transpose;
+
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			transpose(j, i) = elements[i][j];
+	}
+
+	return transpose;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		LeftDivide
+//
+// Description:		Performs division from the left (solves Ax = b for x,
+//					where this matrix is A).  Uses Householder QR
+//					factorization, so for over-determined systems the
+//					result is the least-squares solution.  Unlike
+//					Matrix::LeftDivide() (which uses SVD), rank-deficient
+//					systems are reported as failures.
+//
+// Input Arguments:
+//		b	= const FixedMatrix<R, K>&
+//
+// Output Arguments:
+//		x	= FixedMatrix<C, K>&
+//
+// Return Value:
+//		bool, true for success, false if this matrix is (nearly) rank-deficient
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+template<unsigned int K>
+bool FixedMatrix<R, C>::LeftDivide(const FixedMatrix<R, K> &b, FixedMatrix<C, K> &x) const
+{
+	static_assert(R >= C, "FixedMatrix::LeftDivide requires at least as many rows as columns");
+
+	FixedMatrix<R, C> a(*this);
+	FixedMatrix<R, K> y(b);
+	double diagonal[C];
+
+	double largest(0.0);
+	unsigned int i, j, k;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+		{
+			if (fabs(elements[i][j]) > largest)
+				largest = fabs(elements[i][j]);
+		}
+	}
+	const double tolerance(std::numeric_limits<double>::epsilon() * R * largest);
+
+	double norm, vNormSquared, s;
+	for (k = 0; k < C; k++)
+	{
+		norm = 0.0;
+		for (i = k; i < R; i++)
+			norm += a(i, k) * a(i, k);
+		norm = sqrt(norm);
+
+		if (norm <= tolerance)
+			return false;
+
+		// Reflect column k onto the diagonal; the reflection vector is stored in place
+		diagonal[k] = a(k, k) > 0.0 ? -norm : norm;
+		a(k, k) -= diagonal[k];
+
+		vNormSquared = 0.0;
+		for (i = k; i < R; i++)
+			vNormSquared += a(i, k) * a(i, k);
+
+		for (j = k + 1; j < C; j++)
+		{
+			s = 0.0;
+			for (i = k; i < R; i++)
+				s += a(i, k) * a(i, j);
+			s *= 2.0 / vNormSquared;
+			for (i = k; i < R; i++)
+				a(i, j) -= s * a(i, k);
+		}
+
+		for (j = 0; j < K; j++)
+		{
+			s = 0.0;
+			for (i = k; i < R; i++)
+				s += a(i, k) * y(i, j);
+			s *= 2.0 / vNormSquared;
+			for (i = k; i < R; i++)
+				y(i, j) -= s * a(i, k);
+		}
+	}
+
+	// Back substitution
+	for (j = 0; j < K; j++)
+	{
+		for (k = C; k > 0; k--)
+		{
+			s = y(k - 1, j);
+			for (i = k; i < C; i++)
+				s -= a(k - 1, i) * x(i, j);
+			x(k - 1, j) = s / diagonal[k - 1];
+		}
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			FixedMatrix
+// Function:		GetNorm
+//
+// Description:		Returns the sum of the absolute values of the elements.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+template<unsigned int R, unsigned int C>
+double FixedMatrix<R, C>::GetNorm() const
+{
+	double norm(0.0);
+
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		for (j = 0; j < C; j++)
+			norm += fabs(elements[i][j]);
+	}
+
+	return norm;
+}
+
+#endif// FIXED_MATRIX_H_
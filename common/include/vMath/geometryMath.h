@@ -40,8 +40,29 @@ public:
 		Vector point;
 	};
 
+	// Structure-of-arrays types for solving several independent problems at
+	// once (each array element is one lane)
+	static const unsigned int laneCount = 4;
+
+	struct SphereLanes
+	{
+		double x[laneCount];
+		double y[laneCount];
+		double z[laneCount];
+		double radius[laneCount];
+	};
+
+	struct VectorLanes
+	{
+		double x[laneCount];
+		double y[laneCount];
+		double z[laneCount];
+	};
+
 	static bool FindThreeSpheresIntersection(const Sphere& s1, const Sphere& s2,
 		const Sphere& s3, Vector *intersections);
+	static void FindThreeSpheresIntersections(const SphereLanes& s1, const SphereLanes& s2,
+		const SphereLanes& s3, VectorLanes *intersections, bool *solved);
 	static bool FindCircleSphereIntersection(const Circle &c, const Sphere &s,
 		Vector *intersections);
 	static Plane FindSphereSphereIntersectionPlane(const Sphere &s1,
@@ -21,8 +21,12 @@
 #include <set>
 #include <vector>
 
+// wxWidgets headers
+#include <wx/thread.h>
+
 // Local forward declarations
 class Dataset2D;
+class FFTPlan;
 
 class FastFourierTransform
 {
@@ -40,9 +44,9 @@ public:
 	};
 
 	/// Computes FFT of the specified dataset with default options.
-	/*! By default, the sample is chopped so the size is equal to the next-
-		lowest power of two.  No averaging is used.  A Hann window is applied,
-		and the data is mean-subtracted.
+	/*! By default, the whole sample is used (any length is allowed, although
+		powers of two are fastest).  No averaging is used.  A Hann window is
+		applied, and the data is mean-subtracted.
 
 		\param[in] data	for which FFT should be computed
 
@@ -52,7 +56,8 @@ public:
 
 	/// Computes FFT of the specified dataset with specified options.
 	/*! Averaging is determined based on the length of the signal, the
-		specified window size and overlap.
+		specified window size and overlap.  When there are many averages,
+		the segments are split among one thread per CPU.
 
 		\param[in] data			for which FFT should be computed
 		\param[in] window		to be applied
@@ -70,7 +75,7 @@ public:
 	/// Computes the Frequency Response Function for the specified signals.
 	/*! Determines the frequency-dependent relationship between the specified signals.
 		Overlap is computed based on the specified number of averages and the length of
-		the signal.
+		the signal.  As with ComputeFFT, the averages may be computed in parallel.
 
 		\param[in] input			signal time history
 		\param[in] output			signal time history
@@ -174,12 +179,6 @@ private:
 	*/
 	static void ApplyExponentialWindow(Dataset2D &data);
 
-	static void DoBitReversal(Dataset2D &set);
-	static void DoFFT(Dataset2D &temp);
-
-	static void ZeroDataset(Dataset2D &data);
-	static Dataset2D GenerateConstantDataset(const double &xValue, const double &yValue, const unsigned int &size);
-
 	/// Computes the cross-power spectrum of two FFTs.
 	/*! To be applied to raw (complex) FFT data.
 
@@ -227,15 +226,79 @@ private:
 	static Dataset2D ChopSample(const Dataset2D &data, const unsigned int &sample,
 		const unsigned int &windowSize, const double &overlap);
 
-	/// Adds the specified data to the average.
-	/*! Also initializes \a average if it has not been initialized previously.
-		To be applied to frequency-formatted datasets (not raw complex FFT data).
+	/// Describes the overlapped segments of a signal (or pair of signals) to be averaged.
+	struct Segments
+	{
+		const double *input;///< Signal (y-data) from which the segments are taken
+		const double *output;///< Second signal for cross-spectra (FRF), or NULL for amplitude only
+		unsigned int windowSize;///< Number of points in each segment
+		unsigned int step;///< Number of points between the starts of adjacent segments
+		std::vector<double> window;///< Window coefficients (windowSize long)
+		const FFTPlan *plan;///< Plan for real transforms of windowSize points
+	};
+
+	/// Sums of the spectra of a block of segments.
+	/*! Only the non-negative frequencies (bins 0 through windowSize / 2) are
+		stored; the spectra of real signals are symmetric.
+	*/
+	struct SpectrumSums
+	{
+		std::vector<double> amplitude;///< Sum of input amplitudes (unscaled)
+		std::vector<double> crossReal;///< Sum of cross power (output times conjugate of input)
+		std::vector<double> crossImaginary;
+		std::vector<double> power;///< Sum of input power
+	};
+
+	/// Returns the coefficients of the specified window.
+	/*!
+		\param[in] window	to be generated
+		\param[in] size		number of points in the window
+
+		\return Window coefficients
+	*/
+	static std::vector<double> GenerateWindow(const FFTWindow &window, const unsigned int &size);
+
+	/// Transforms the specified segments and adds their spectra to the sums.
+	/*! All working memory is allocated once per call, not once per segment.
 
-		\param[in,out] average	signal time history
-		\param[in] data			frequency-formatted data to add to the average
-		\param[in] count		total number of averages
+		\param[in] segments	to be transformed
+		\param[in] first		first segment
+		\param[in] last			one past the last segment
+		\param[out] sums		spectra of the segments (sized by this method)
 	*/
-	static void AddToAverage(Dataset2D &average, const Dataset2D &data, const unsigned int &count);
+	static void AccumulateSegments(const Segments &segments, const unsigned int &first,
+		const unsigned int &last, SpectrumSums &sums);
+
+	/// Splits the segments into contiguous blocks and accumulates each block in its own thread.
+	/*! The sums from each block are then added together in order, so the result
+		does not depend on the order in which the threads finish.
+
+		\param[in] segments	to be transformed
+		\param[in] count		number of segments
+		\param[out] sums		spectra of all of the segments
+	*/
+	static void AccumulateSegmentsInParallel(const Segments &segments,
+		const unsigned int &count, SpectrumSums &sums);
+
+	/// Below this number of points (summed over all segments), the segments are
+	/// transformed in the calling thread
+	static const unsigned int minimumParallelPoints;
+
+	class AveragingThread : public wxThread
+	{
+	public:
+		AveragingThread(const Segments &segments, const unsigned int &first,
+			const unsigned int &last, SpectrumSums &sums);
+
+	protected:
+		ExitCode Entry();
+
+	private:
+		const Segments &segments;
+		const unsigned int first;
+		const unsigned int last;
+		SpectrumSums &sums;
+	};
 
 	/// Computes the specified amplitude data to decibels.
 	/*!
@@ -326,6 +389,15 @@ private:
 	*/
 	static Dataset2D ComplexPower(const Dataset2D &a, const double &power);
 
+	/// Returns the number of points shared by adjacent windows.
+	/*!
+		\param[in] windowSize	number of points in each window
+		\param[in] overlap		in percent (0.0 to 1.0) between adjacent windows
+
+		\return The number of overlapping points (less than \a windowSize)
+	*/
+	static unsigned int ComputeOverlapPoints(const unsigned int &windowSize, const double &overlap);
+
 	static unsigned int ComputeRequiredOverlapPoints(const unsigned int &dataSize,
 		const unsigned int &windowSize, const unsigned int &averages);
 };
@@ -0,0 +1,118 @@
+/*===================================================================================
+                                    CarDesigner
+                           Copyright Kerry R. Loux 2011
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  fftPlan.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Precomputed tables for computing discrete Fourier transforms of a
+//				 specific length.  A plan is built once and reused for every
+//				 transform of that length (i.e. averaging).  The power-of-two plans
+//				 on which all other plans are built are cached.
+// History:
+
+#ifndef FFT_PLAN_H_
+#define FFT_PLAN_H_
+
+// Standard C++ headers
+#include <vector>
+#include <map>
+
+// wxWidgets headers
+#include <wx/thread.h>
+
+class FFTPlan
+{
+public:
+	/// Constructor.
+	/*! Complex powers of two are transformed directly (iterative radix-2);
+		other complex lengths are transformed with Bluestein's algorithm.
+		Real lengths that are even are computed with a complex transform of
+		half the length.  A plan may be used by several threads at once.
+
+		\param[in] size		number of points in the transform
+		\param[in] realInput	true for a plan for transforms of real signals
+	*/
+	FFTPlan(const unsigned int &size, const bool &realInput = false);
+	~FFTPlan();
+
+	unsigned int GetSize() const { return size; }
+
+	/// Returns the number of doubles of scratch memory required by the transforms.
+	unsigned int GetScratchSize() const { return scratchSize; }
+
+	/// Computes the (forward, unscaled) transform of complex data in place.
+	/*! To be used with complex plans.
+
+		\param[in,out] real			part of the data (size points long)
+		\param[in,out] imaginary	part of the data (size points long)
+		\param[in] scratch			GetScratchSize() doubles, or NULL to
+									allocate as required
+	*/
+	void Transform(double *real, double *imaginary, double *scratch = NULL) const;
+
+	/// Computes the (forward, unscaled) transform of real data.
+	/*! To be used with real plans.  The full (conjugate-symmetric) spectrum
+		is returned.
+
+		\param[in] input			signal (size points long; may be the
+									same array as \a real)
+		\param[out] real			part of the spectrum (size points long)
+		\param[out] imaginary		part of the spectrum (size points long)
+		\param[in] scratch			GetScratchSize() doubles, or NULL to
+									allocate as required
+	*/
+	void TransformReal(const double *input, double *real, double *imaginary, double *scratch = NULL) const;
+
+private:
+	// Plans may own their sub-plans, so they are not copied
+	FFTPlan(const FFTPlan &plan);
+	FFTPlan& operator=(const FFTPlan &plan);
+
+	/// Retrieves the specified complex power-of-two plan from the cache, creating it if necessary.
+	/*! There are at most a few dozen such plans, so the cache is never trimmed;
+		the returned plan remains valid for the life of the program.
+	*/
+	static const FFTPlan& GetPowerOfTwoPlan(const unsigned int &size);
+
+	static wxMutex cacheMutex;
+	static std::map<unsigned int, const FFTPlan*> cache;
+
+	unsigned int size;
+	bool realInput;
+	unsigned int scratchSize;
+
+	// For power-of-two complex transforms:  pairs of indices to swap, and the
+	// twiddle factors for each stage (stage with half-size h begins at h - 1)
+	std::vector<unsigned int> swaps;
+	std::vector<double> twiddleReal, twiddleImaginary;
+
+	// For Bluestein's algorithm:  the chirp, and the transform of its conjugate
+	// (on the power-of-two length of the sub-transform)
+	const FFTPlan *subPlan;
+	FFTPlan *ownedSubPlan;// Non-NULL when subPlan is not a cached power-of-two plan
+	std::vector<double> chirpReal, chirpImaginary;
+	std::vector<double> kernelReal, kernelImaginary;
+
+	// For even-length real transforms:  twiddle factors for separating the
+	// transform of the half-length complex sequence (subPlan)
+	std::vector<double> splitReal, splitImaginary;
+
+	void InitializePowerOfTwo();
+	void InitializeBluestein();
+	void InitializeReal();
+	void SetSubPlan(const unsigned int &subSize);
+
+	void DoPowerOfTwoFFT(double *real, double *imaginary) const;
+	void DoBluesteinFFT(double *real, double *imaginary, double *scratch) const;
+	void DoRealFFT(const double *input, double *real, double *imaginary, double *scratch) const;
+
+	static bool IsPowerOfTwo(const unsigned int &size);
+};
+
+#endif// FFT_PLAN_H_
@@ -20,11 +20,14 @@
 #include <vector>
 #include <string>
 
+// Local forward declarations
+class Complex;
+
 class Filter
 {
 public:
 	// Constructor
-	// NOTE:  Constructor MUST initialize the filter parameters a and b, and the input/output vectors y and u
+	// NOTE:  Constructor MUST initialize the filter sections and the state
 	Filter(const double &sampleRate);
 	Filter(const double &sampleRate, const std::vector<double> &numerator,
 		const std::vector<double> &denominator, const double &initialValue = 0.0);
@@ -39,11 +42,27 @@ public:
 	// Main method for filtering incoming data
 	double Apply(const double &u);
 
+	// Filters a block of n samples, continuing from the current state (equivalent to calling
+	// Apply() for each sample).  in and out may be the same array.
+	void Apply(const double *in, double *out, const unsigned int &n);
+
+	// Forward-backward (zero-phase) filtering of a block of n samples.  Each pass begins at
+	// steady state for its first sample, and the current state is not affected.  in and out
+	// may be the same array.
+	void ApplyZeroPhase(const double *in, double *out, const unsigned int &n) const;
+
+	// Filters channelCount channels of n samples each.  As with ApplyZeroPhase(), each channel
+	// begins at steady state for its first sample and the current state is not affected.  The
+	// channels are filtered side by side, so the arithmetic vectorizes across channels.  in and
+	// out may refer to the same arrays.
+	void ApplyToChannels(const double *const *in, double *const *out, const unsigned int &channelCount,
+		const unsigned int &n, const bool &zeroPhase = false) const;
+
 	// Returns latest raw data
-	double GetRawValue() const { return u[0]; }
+	double GetRawValue() const { return rawValue; }
 
 	// Returns latest filtered data
-	double GetFilteredValue() const { return y[0]; }
+	double GetFilteredValue() const { return filteredValue; }
 
 	// Assignment operator (avoids MSVC Warning C4512)
 	Filter& operator=(const Filter &f);
@@ -54,23 +73,52 @@ public:
 	double ComputeSteadyStateGain() const;
 
 private:
-	// Filter coefficients
-	double *a;
-	double *b;
-	double *y;
-	double *u;
+	// Second-order section:  (a[0] + a[1] z^-1 + a[2] z^-2) / (1 + b[0] z^-1 + b[1] z^-2)
+	struct Section
+	{
+		double a[3];
+		double b[2];
+	};
+
+	// Filter coefficients, factored into a cascade of second-order sections (high-order
+	// filters are poorly conditioned when evaluated directly)
+	std::vector<Section> sections;
 
-	unsigned int outSize;
-	unsigned int inSize;
+	// Two state variables for each section (transposed direct form II), and the state
+	// for a unit input at steady state
+	std::vector<double> state;
+	std::vector<double> unitState;
+
+	double rawValue;
+	double filteredValue;
 
 	const double sampleRate;// [Hz]
 
-	void AllocateArrays(const unsigned int &inSize, const unsigned int &outSize);
-	void ShiftArray(double *s, const unsigned int &size);
-	void DeleteArrays();
+	// Product of up to two linear factors:  (1 - r1 z^-1) (1 - r2 z^-1) = c[0] + c[1] z^-1 + c[2] z^-2
+	struct Factor
+	{
+		double c[3];
+		double rootReal;// Largest root (for pairing zeros with poles)
+		double rootImaginary;
+	};
+
+	// Number of channels filtered side by side, and number of samples of each
+	// channel copied into the working buffer at once
+	static const unsigned int channelLanes;
+	static const unsigned int channelBlockSize;
 
 	void GenerateCoefficients(const std::vector<double> &numerator, const std::vector<double> &denominator);
-	std::string AssembleZExpression(const std::vector<double>& coefficients, const unsigned int &highestPower) const;
+	void GenerateSections(const std::vector<Complex> &zeroRoots, const std::vector<Complex> &poleRoots, const double &gain);
+	void ComputeUnitState();
+
+	void FilterBlock(const double *in, double *out, const unsigned int &n, double *sectionState) const;
+	void FilterChannelGroup(const double *const *in, double *const *out, const unsigned int &channelCount,
+		const unsigned int &n, const bool &reverse) const;
+
+	static std::vector<Complex> FindRoots(const std::vector<double> &coefficients);
+	static double GetLeadingCoefficient(const std::vector<double> &coefficients);
+	static std::vector<Factor> GroupRoots(const std::vector<Complex> &roots);
+	static Factor MultiplyFactors(const Complex &root1, const Complex &root2);
 	static std::vector<std::pair<int, double> > CollectLikeTerms(std::vector<std::pair<int, double> > terms);
 	static std::vector<std::pair<int, double> > PadMissingTerms(std::vector<std::pair<int, double> > terms);
 };
@@ -18,9 +18,17 @@
 #ifndef GENETIC_ALGORITHM_H_
 #define GENETIC_ALGORITHM_H_
 
+// Standard C++ headers
+#include <random>
+#include <deque>
+#include <utility>
+
 // wxWidgets headers
 #include <wx/thread.h>
 
+// VVASE headers
+#include "vSolver/optimization/paretoRanking.h"
+
 class GeneticAlgorithm
 {
 public:
@@ -63,14 +71,78 @@ public:
 	inline void SetSortingMethod(SortingMethod sortingMethod) { wxMutexLocker lock(gsaMutex); this->sortingMethod = sortingMethod; };
 	inline SortingMethod GetSortingMethod() const { wxMutexLocker lock(gsaMutex); return sortingMethod; };
 
+	// By default, only the current and previous generations are stored (plus the best
+	// citizen from each generation); must be called prior to InitializeAlgorithm()
+	void SetKeepAllGenerations(bool keepAllGenerations);
+	inline bool GetKeepAllGenerations() const { wxMutexLocker lock(gsaMutex); return keepAllGenerations; };
+
+	// Island model - the population is divided into islands that breed independently
+	// (each with its own random number stream) and exchange their best citizens every
+	// migrationInterval generations (zero for no migration).  Each island breeds its
+	// next generation as soon as its own evaluations complete, so islands may run up to
+	// one generation ahead of the others (but never past a migration).
+	void SetIslands(int numberOfIslands, int migrationInterval = 10, int migrationCount = 1);
+	inline int GetNumberOfIslands() const { wxMutexLocker lock(gsaMutex); return numberOfIslands; };
+	inline int GetMigrationInterval() const { wxMutexLocker lock(gsaMutex); return migrationInterval; };
+	inline int GetMigrationCount() const { wxMutexLocker lock(gsaMutex); return migrationCount; };
+
+	// For a given seed, results are repeatable (zero to seed from the clock)
+	inline void SetRandomSeed(unsigned int randomSeed) { wxMutexLocker lock(gsaMutex); this->randomSeed = randomSeed; };
+	inline unsigned int GetRandomSeed() const { wxMutexLocker lock(gsaMutex); return randomSeed; };
+
+	// Steady-state mode - after the first generation, a child is bred as soon as each
+	// evaluation completes, and it replaces the loser of a tournament if it is more fit.
+	// Each "generation" is then populationSize evaluations.  Islands are not used, and
+	// results are repeatable only if evaluations complete in the order they are started.
+	void SetSteadyState(bool steadyState, int tournamentSize = 2);
+	inline bool GetSteadyState() const { wxMutexLocker lock(gsaMutex); return steadyState; };
+	inline int GetTournamentSize() const { wxMutexLocker lock(gsaMutex); return tournamentSize; };
+
+	// Multi-objective mode (NSGA-II) - each citizen is also evaluated against several
+	// objectives, and each generation is ranked by Pareto dominance and crowding distance
+	// instead of by fitness.  Parents compete with their children for survival, so
+	// elitism is implicit, and parents are chosen by tournament (tournamentSize).  Islands
+	// and steady-state mode are not used.  The fitness only determines the best citizen.
+	// Must be called prior to InitializeAlgorithm().
+	void SetMultiObjective(bool multiObjective);
+	inline bool GetMultiObjective() const { wxMutexLocker lock(gsaMutex); return multiObjective; };
+
+	// The non-dominated citizens are the first citizens of each generation
+	inline int GetParetoFrontSize() const { wxMutexLocker lock(gsaMutex); return paretoFrontSize; };
+
 protected:
 	// The fitness function (MUST be overridden)
 	virtual double DetermineFitness(const int *currentGenome) = 0;
 
+	// The objectives for multi-objective mode (minimized or maximized along with the
+	// fitness).  The default is a single objective equal to the fitness.
+	virtual int GetNumberOfObjectives() const { return 1; };
+	virtual void DetermineObjectives(const int *currentGenome, double *objectives);
+
 	// This function allows room for derived classes to take additional actions
 	// (report status, interrupt operation, etc.)
 	virtual void PerformAdditionalActions();
 
+	// Evaluation interface for steady-state mode.  The default implementation evaluates
+	// immediately using DetermineFitness(); derived classes may override these to have
+	// up to GetMaximumPendingEvaluations() children evaluated concurrently.  The genome
+	// passed to BeginEvaluation() remains valid until its slot is returned by
+	// WaitForEvaluation().
+	virtual unsigned int GetMaximumPendingEvaluations() const { return 1; };
+	virtual void BeginEvaluation(const unsigned int &slot, const int *genome);
+	virtual unsigned int WaitForEvaluation(double &fitness);
+
+	// Evaluation interface for the island model.  The default implementation evaluates
+	// the island immediately using DetermineFitness(); derived classes may override
+	// these to evaluate several islands concurrently.  WaitForIslandEvaluation() must
+	// fill the island's fitnesses for the generation passed to BeginIslandEvaluation().
+	// Derived classes that override SimulateGeneration() must override these, too, or
+	// return false from EvaluatesIslandsSeparately() to evaluate whole generations.
+	virtual bool EvaluatesIslandsSeparately() const { return true; };
+	virtual void BeginIslandEvaluation(const int &generation, const int &island,
+		const int &first, const int &size);
+	virtual int WaitForIslandEvaluation();
+
 	int currentGeneration;
 
 	int generationLimit;
@@ -82,29 +154,99 @@ protected:
 	int numberOfGenes;
 	int *numberOfPhenotypes;
 
-	// The genomes (first index:  generation, second index:  citizen, third index:  gene)
-	int ***genomes;
+	// Access to the genomes and fitnesses (only the current and previous generations
+	// are available unless all generations are kept)
+	inline int *GetGenome(const int &generation, const int &citizen) const
+	{ return genomes + (GetSlot(generation) * populationSize + citizen) * numberOfGenes; };
+	inline double *GetFitnesses(const int &generation) const
+	{ return fitnesses + GetSlot(generation) * populationSize; };
 
-	// The fitnesses (first index:  generation, second index:  citizen)
-	double **fitnesses;
+	// Multi-objective mode only (derived classes that override SimulateGeneration()
+	// must fill these, too)
+	bool multiObjective;
+	int numberOfObjectives;
+	int paretoFrontSize;
+	inline double *GetObjectives(const int &generation) const
+	{ return objectives + GetSlot(generation) * populationSize * numberOfObjectives; };
+
+	// Access to the best citizen from each (completed) generation
+	inline const int *GetBestGenome(const int &generation) const { return bestGenomes + generation * numberOfGenes; };
+	inline double GetBestFitness(const int &generation) const { return bestFitnesses[generation]; };
 
 	mutable wxMutex gsaMutex;
 
 private:
+	bool keepAllGenerations;
+
+	// Each generation occupies one contiguous block (populationSize * numberOfGenes genes
+	// for the genomes and populationSize values for the fitnesses)
+	int *genomes;
+	double *fitnesses;
+	double *objectives;// populationSize * numberOfObjectives values per generation
+	inline int GetSlot(const int &generation) const { return keepAllGenerations ? generation : generation % 2; };
+
+	// The best citizen from each generation (first index:  generation, second index:  gene)
+	int *bestGenomes;
+	double *bestFitnesses;
+	void RecordBestCitizen();
+
+	// Working arrays for sorting
+	int *sortOrder;
+	int *sortGenomes;
+
+	// Island model parameters and one random number generator per island
+	int numberOfIslands;
+	int migrationInterval;
+	int migrationCount;
+	unsigned int randomSeed;
+	int activeIslands;// may be fewer than numberOfIslands for small populations
+	std::mt19937 *generators;
+	inline int GetIslandStart(const int &island) const { return island * populationSize / activeIslands; };
+	static inline int RandomInteger(std::mt19937 &generator, const int &limit) { return (int)(generator() % (unsigned int)limit); };
+
 	void CreateFirstGeneration();
 
 	virtual void SimulateGeneration();
 
 	void Breed();
+	void BreedIsland(const int &generation, const int &island);
+	void MigrateCitizens();
+	inline bool IsMigrationGeneration(const int &generation) const
+	{ return activeIslands > 1 && migrationInterval > 0 && migrationCount > 0 && (generation + 1) % migrationInterval == 0; };
+
+	// Island model with each island evaluated separately
+	void PerformIslandOptimization();
+	std::deque<int> completedIslands;// From the default (immediate) evaluation
+
+	// Steady-state mode
+	bool steadyState;
+	int tournamentSize;
+	void PerformSteadyStateOptimization();
+	void StartSteadyStateGeneration();
+	int SelectByTournament(std::mt19937 &generator, const bool &mostFit) const;
+	void BreedChild(const int *father, const int *mother, int *child, std::mt19937 &generator) const;
+	inline bool IsMoreFit(const double &a, const double &b) const { return minimize ? a < b : a > b; };
+
+	// Results from the default (immediate) evaluation (first:  slot, second:  fitness)
+	std::deque<std::pair<unsigned int, double> > completedEvaluations;
+
+	// Multi-objective mode (each generation is stored in order of preference)
+	ParetoRanking paretoRanking;
+	void PerformMultiObjectiveOptimization();
+	void BreedMultiObjective();
+	void SelectSurvivors();
+	int SelectByCrowding(std::mt19937 &generator) const;
 
 	SortingMethod sortingMethod;
 
 	void SortByFitness();
+	void SortIsland(const int &generation, const int &island);
 
-	// The actual sorting algorithms
-	void SelectionSort(double *fitnessArray, int **genomeArray, const int arraySize);
-	void MergeSort(double *fitnessArray, int **genomeArray, const int arraySize);
-	void Quicksort(double *fitnessArray, int **genomeArray, const int arraySize);
+	// The actual sorting algorithms (the order array is sorted along with the fitnesses,
+	// and is then used to re-arrange the genomes)
+	void SelectionSort(double *fitnessArray, int *orderArray, const int arraySize);
+	void MergeSort(double *fitnessArray, int *orderArray, const int arraySize);
+	void Quicksort(double *fitnessArray, int *orderArray, const int arraySize);
 
 	bool minimize;
 
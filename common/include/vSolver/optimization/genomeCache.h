@@ -0,0 +1,80 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  genomeCache.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Memory-limited cache of the values computed for each genome, with
+//				 least-recently-used eviction.  Allows genetic algorithms to skip the
+//				 analysis of genomes that have already been evaluated (elite citizens,
+//				 duplicates in converged populations, etc.).
+// History:
+
+#ifndef GENOME_CACHE_H_
+#define GENOME_CACHE_H_
+
+// Standard C++ headers
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+class GenomeCache
+{
+public:
+	GenomeCache();
+
+	// Clears the cache and sizes it so that it uses no more than (approximately) memoryLimit bytes
+	void Initialize(const unsigned int &genomeLength, const unsigned int &valueCount,
+		const size_t &memoryLimit);
+	void Clear();
+
+	// Returns NULL if the genome is not in the cache
+	const double* Find(const int *genome);
+	void Insert(const int *genome, const double *values);
+
+	unsigned int GetCount() const { return (unsigned int)entries.size(); }
+	unsigned int GetCapacity() const { return capacity; }
+	unsigned int GetValueCount() const { return valueCount; }
+
+	unsigned long GetHits() const { return hits; }
+	unsigned long GetLookups() const { return lookups; }
+	double GetHitRate() const;
+
+	// Hash for genomes (may also be used to find duplicates outside of the cache)
+	struct GenomeHash
+	{
+		size_t operator()(const std::vector<int> &genome) const;
+	};
+
+private:
+	unsigned int genomeLength;
+	unsigned int valueCount;
+	unsigned int capacity;
+
+	unsigned long hits;
+	unsigned long lookups;
+
+	struct Entry
+	{
+		std::vector<int> genome;
+		std::vector<double> values;
+	};
+
+	// Most recently used entries are at the front
+	typedef std::list<Entry> EntryList;
+	EntryList entries;
+	std::unordered_map<std::vector<int>, EntryList::iterator, GenomeHash> index;
+
+	// Re-used for lookups to avoid allocating a key for every call
+	std::vector<int> key;
+	void SetKey(const int *genome);
+};
+
+#endif// GENOME_CACHE_H_
@@ -0,0 +1,296 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  kinematicsGA.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Genetic algorithm for optimizing suspension hardpoints against a list
+//				 of kinematic goals.  Analyses are distributed to the worker threads via
+//				 the job queue; this class has no dependence on the GUI.
+// History:
+
+#ifndef KINEMATICS_GA_H_
+#define KINEMATICS_GA_H_
+
+// Standard C++ headers
+#include <vector>
+
+// VVASE headers
+#include "vUtilities/managedList.h"
+#include "vCar/corner.h"
+#include "vMath/vector.h"
+#include "vSolver/physics/kinematicOutputs.h"
+#include "vSolver/physics/kinematics.h"
+#include "vSolver/optimization/geneticAlgorithm.h"
+#include "vSolver/optimization/genomeCache.h"
+#include "vSolver/optimization/surrogateModel.h"
+#include "vSolver/optimization/levenbergMarquardt.h"
+#include "vSolver/threads/inverseSemaphore.h"
+#include "vSolver/threads/completionQueue.h"
+#include "vUtilities/debugLog.h"
+
+// VVASE forward declarations
+class JobQueue;
+class Car;
+
+class KinematicsGA : public GeneticAlgorithm
+{
+public:
+	KinematicsGA(JobQueue &queue);
+	virtual ~KinematicsGA();
+
+	void SetUp(const Car &targetCar);
+
+	// For storing the information about the genes
+	struct Gene
+	{
+		Corner::Hardpoints hardpoint;
+		Corner::Hardpoints tiedTo;
+		Corner::Location location;
+		Vector::Axis direction;
+
+		double minimum;
+		double maximum;
+		int numberOfValues;
+	};
+
+	// The structure that represents our goals
+	struct Goal
+	{
+		KinematicOutputs::OutputsComplete output;
+
+		double desiredValue;
+
+		// The values used to compute the weight for this output
+		double expectedDeviation;
+		double importance;
+
+		// The conditions at which this goal is evaluated.  There are two sets of inputs
+		// here, so that a delta goal can be implemented (i.e. change in roll center height
+		// with ride).
+		Kinematics::Inputs beforeInputs;
+		Kinematics::Inputs afterInputs;
+	};
+
+	// For changing what is being optimized
+	void ClearAllGenes() { geneList.Clear(); }
+	void AddGene(const Corner::Hardpoints &hardpoint, const Corner::Hardpoints &tiedTo,
+		const Corner::Location &location, const Vector::Axis &direction, const double &minimum,
+		const double &maximum, const int &numberOfValues);
+	void RemoveGene(const int &index) { geneList.Remove(index); }
+	void UpdateGene(const int &index, const Corner::Hardpoints &hardpoint, const Corner::Hardpoints &tiedTo,
+		const Corner::Location &location, const Vector::Axis &direction, const double &minimum,
+		const double &maximum, const int &numberOfValues);
+	int GetGeneCount() const { return geneList.GetCount(); }
+	const Gene &GetGene(const int &index) const { return *(geneList[index]); }
+
+	// For creating the fitness function
+	void ClearAllGoals() { goalList.Clear(); }
+	void AddGoal(const KinematicOutputs::OutputsComplete &output, const double &desiredValue,
+		const double &expectedDeviation, const double &importance, const Kinematics::Inputs &beforeInputs,
+		const Kinematics::Inputs &afterInputs);
+	void RemoveGoal(const int &index) { goalList.Remove(index); }
+	void UpdateGoal(const int &index, const KinematicOutputs::OutputsComplete &beforeOutput, const double &desiredValue,
+		const double &expectedDeviation, const double &importance, const Kinematics::Inputs &beforeInputs,
+		const Kinematics::Inputs &afterInputs);
+	int GetGoalCount() const { return goalList.GetCount(); }
+	const Goal &GetGoal(const int &index) const { return *(goalList[index]); }
+
+	// File I/O
+	bool Write(wxString fileName);
+	bool Read(wxString fileName);
+
+	int GetNumberOfInputs() const { wxMutexLocker lock(gsaMutex); DebugLog::GetInstance()->Log(_T("KinematicsGA::GetNumberOfInputs()")); return inputList.GetCount(); }
+	bool OptimizationIsRunning() const {  wxMutexLocker lock(gsaMutex); DebugLog::GetInstance()->Log(_T("KinematicsGA::OptimizationIsRunning()")); return isRunning; }
+
+	// Number of threads servicing the job queue (used to size the batches)
+	void SetNumberOfThreads(const unsigned int &numberOfThreads) { wxMutexLocker lock(gsaMutex); this->numberOfThreads = numberOfThreads; }
+
+	void UpdateResultingCar(Car& result);
+
+	// Genomes that have already been evaluated are not re-analyzed (takes effect at SetUp())
+	void SetCacheMemoryLimit(const size_t &memoryLimit) { wxMutexLocker lock(cacheMutex); cacheMemoryLimit = memoryLimit; }// [bytes]
+	double GetCacheHitRate() const { wxMutexLocker lock(cacheMutex); return cache.GetHitRate(); }
+
+	// When less than one, a surrogate model fit to the evaluated genomes ranks each
+	// generation's new genomes, and only this fraction of them is analyzed (the rest
+	// are ranked behind every analyzed genome)
+	void SetSurrogateFraction(const double &fraction);
+	double GetSurrogateFraction() const { wxMutexLocker lock(gsaMutex); return surrogateFraction; }
+
+	// When non-zero, the best citizen of the final generation is refined with a
+	// continuous (Levenberg-Marquardt) optimization, free of the discrete phenotypes
+	void SetRefinementIterations(const unsigned int &iterations) { wxMutexLocker lock(gsaMutex); refinementIterations = iterations; }
+	unsigned int GetRefinementIterations() const { wxMutexLocker lock(gsaMutex); return refinementIterations; }
+
+protected:
+	JobQueue &queue;
+
+	// Mandatory override of fitness function
+	double DetermineFitness(const int *citizen);
+
+	// In multi-objective mode, each goal is an objective (the weighted error)
+	int GetNumberOfObjectives() const { return goalList.GetCount(); }
+	void DetermineObjectives(const int *citizen, double *objectives);
+
+	// Optional override to display results every step (derived classes that
+	// override this must call this version, too)
+	void PerformAdditionalActions();
+
+	// Information attached to each job sent to the queue
+	virtual unsigned int GetNumberOfThreads() const { return numberOfThreads; }
+	virtual wxString GetJobName() const { return wxEmptyString; }
+	virtual int GetJobIndex() const { return 0; }
+
+	bool isRunning;
+
+private:
+	// Optional override for determining fitnesses - overridden here to make use of threading
+	void SimulateGeneration();
+
+	// Overrides for steady-state mode - each child is one job, and children are
+	// collected in the order in which their analyses complete
+	unsigned int GetMaximumPendingEvaluations() const;
+	void BeginEvaluation(const unsigned int &slot, const int *genome);
+	unsigned int WaitForEvaluation(double &fitness);
+
+	CompletionQueue completionQueue;
+	std::vector<const int*> pendingGenomes;// Indexed by slot
+	std::vector<bool> pendingFromCache;// Indexed by slot
+
+	// Overrides for the island model - each island's analyses are started as soon as
+	// the island has been bred (each citizen uses the car with the same index), and
+	// islands are collected in the order in which their analyses complete
+	bool EvaluatesIslandsSeparately() const;
+	void BeginIslandEvaluation(const int &generation, const int &island,
+		const int &first, const int &size);
+	int WaitForIslandEvaluation();
+
+	struct IslandEvaluation
+	{
+		int generation;
+		int first;
+		int size;
+		unsigned int pendingJobs;
+		std::vector<bool> analyzed;// Indexed by citizen - first
+		std::vector<int> duplicateOf;// Indexed by citizen - first
+	};
+	std::vector<IslandEvaluation> islandEvaluations;// Indexed by island
+
+	unsigned int numberOfThreads;
+
+	// Array of cars with which the fitnesses are determined (one per citizen)
+	// and the outputs for each citizen at each input
+	Car **originalCarArray;
+	KinematicOutputs *kinematicOutputArray;
+	unsigned int numberOfCars;
+
+	// Original car to be optimized (only one needed for reference)
+	const Car *targetCar;
+
+	ManagedList<Gene> geneList;
+	ManagedList<Goal> goalList;
+
+	// The different input configurations to be run
+	ManagedList<Kinematics::Inputs> inputList;
+	void DetermineAllInputs();
+	unsigned int AddInput(const Kinematics::Inputs &inputs);
+
+	// Each goal resolved against inputList (built with the input list, so fitness
+	// evaluation does not need to compare inputs)
+	struct GoalPlanEntry
+	{
+		unsigned int beforeInput;
+		unsigned int afterInput;
+		KinematicOutputs::OutputsComplete output;
+
+		// Actual value = afterFactor * after value - beforeFactor * before value
+		// (the after value is not used for goals that are not deltas)
+		double afterFactor;
+		double beforeFactor;
+
+		double desiredValue;
+		double scale;// Importance / ExpectedDeviation
+	};
+	std::vector<GoalPlanEntry> goalPlan;
+
+	// Converts a genome (or continuous gene values) into a citizen
+	void SetCarGenome(int carIndex, const int *currentGenome);
+	void SetCarValues(int carIndex, const double *values);
+	double GetGeneValue(const unsigned int &gene, const int &phenotype) const;
+
+	// Analyzes the first carCount cars at every input and waits for the results
+	void AnalyzeCars(const unsigned int &carCount, const bool &reportProgress);
+
+	// Only the outputs required by the goals are computed
+	KinematicOutputs::OutputMask outputMask;
+
+	// The output values required to evaluate the goals (two per goal:  the value at
+	// the before inputs, then the value at the after inputs) for each citizen
+	double *goalValues;
+	unsigned int GetGoalValueCount() const { return 2 * goalList.GetCount(); }
+	void ExtractGoalValues(const unsigned int &carIndex, double *values) const;
+	double ComputeFitness(const double *values) const;
+	void ComputeFitnesses(const double *values, const unsigned int &count,
+		double *fitnesses) const;
+	void ComputeObjectives(const double *values, const unsigned int &count,
+		double *objectives) const;
+	double GetGoalError(const double *values, const unsigned int &goal) const;
+
+	// Previously computed goal values, keyed on genome (the statistics are
+	// read from other threads, so access is protected with cacheMutex)
+	GenomeCache cache;
+	size_t cacheMemoryLimit;
+	mutable wxMutex cacheMutex;
+
+	// Approximates the goal values from previously analyzed genomes
+	SurrogateModel surrogate;
+	double surrogateFraction;
+	static const unsigned int surrogateSampleLimit;
+	void GetSurrogateInputs(const int *genome, double *inputs) const;
+	std::vector<int> ScreenCandidates(const std::vector<int> &candidates);
+
+	// Continuous refinement of the best citizen (residuals are the goal errors)
+	class Refinement : public LevenbergMarquardt
+	{
+	public:
+		explicit Refinement(KinematicsGA &optimization) : optimization(optimization) {}
+
+	protected:
+		unsigned int GetResidualCount() const;
+		bool ComputeResiduals(const double *parameterSets,
+			const unsigned int &setCount, double *residuals);
+		double GetFiniteDifferenceStep(const unsigned int &parameter, const double &value) const;
+
+	private:
+		KinematicsGA &optimization;
+	};
+
+	unsigned int refinementIterations;
+	std::vector<double> refinedValues;// Empty unless refinement improved the best citizen
+	void RefineBestCitizen();
+
+	// Synchronization object allowing this thread to wait for analyses to be completed
+	InverseSemaphore inverseSemaphore;
+
+	// File header information
+	struct FileHeaderInfo
+	{
+		int fileVersion;
+	};
+
+	// Writes and reads the file header information for saved cars
+	void WriteFileHeader(std::ofstream *outFile);
+	FileHeaderInfo ReadFileHeader(std::ifstream *inFile);
+
+	// Our current file version
+	static const int currentFileVersion;
+};
+
+#endif// KINEMATICS_GA_H_
@@ -0,0 +1,62 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  levenbergMarquardt.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Base class for bounded, continuous least-squares optimization using
+//				 the Levenberg-Marquardt algorithm.  The Jacobian is computed by forward
+//				 differences, with every perturbed parameter set passed to the derived
+//				 class in a single call so that they may be evaluated concurrently.
+// History:
+
+#ifndef LEVENBERG_MARQUARDT_H_
+#define LEVENBERG_MARQUARDT_H_
+
+// Standard C++ headers
+#include <cstddef>
+
+class LevenbergMarquardt
+{
+public:
+	LevenbergMarquardt();
+	virtual ~LevenbergMarquardt();
+
+	void SetIterationLimit(const unsigned int &iterationLimit) { this->iterationLimit = iterationLimit; }
+	void SetTolerance(const double &tolerance) { this->tolerance = tolerance; }// Relative change in sum of squares
+
+	// Bounds may be NULL.  Returns false if the residuals could not be evaluated.
+	bool Optimize(double *parameters, const unsigned int &parameterCount,
+		const double *lower = NULL, const double *upper = NULL);
+
+	double GetSumOfSquares() const { return sumOfSquares; }
+	unsigned int GetIterations() const { return iterations; }
+
+protected:
+	virtual unsigned int GetResidualCount() const = 0;
+
+	// Evaluates the residuals for setCount parameter sets (stored one after another);
+	// residuals are returned in the same order
+	virtual bool ComputeResiduals(const double *parameterSets,
+		const unsigned int &setCount, double *residuals) = 0;
+
+	// Step used to compute the derivative with respect to the specified parameter
+	virtual double GetFiniteDifferenceStep(const unsigned int &parameter, const double &value) const;
+
+private:
+	unsigned int iterationLimit;
+	double tolerance;
+
+	double sumOfSquares;
+	unsigned int iterations;
+
+	static double GetSumOfSquares(const double *residuals, const unsigned int &count);
+};
+
+#endif// LEVENBERG_MARQUARDT_H_
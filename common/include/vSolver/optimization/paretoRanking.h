@@ -0,0 +1,99 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  paretoRanking.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Fast non-dominated sorting and crowding distance (as used by NSGA-II).
+//				 Ranks a set of points by Pareto dominance over several objectives, so
+//				 that trade-offs between the objectives can be explored in a single
+//				 optimization.
+// History:
+
+#ifndef PARETO_RANKING_H_
+#define PARETO_RANKING_H_
+
+// Standard C++ headers
+#include <vector>
+
+// wxWidgets headers
+#include <wx/thread.h>
+
+class ParetoRanking
+{
+public:
+	ParetoRanking();
+
+	// The pairwise comparisons are split among this many threads (the calling thread
+	// is one of them)
+	void SetNumberOfThreads(const unsigned int &numberOfThreads);
+
+	// Ranks count points with objectiveCount values each (row-major); all objectives
+	// are minimized.  The objectives must remain valid until Rank() returns.
+	void Rank(const double *objectives, const unsigned int &count,
+		const unsigned int &objectiveCount);
+
+	// Zero for the non-dominated front, one for the front behind it, etc.
+	unsigned int GetRank(const unsigned int &point) const { return ranks[point]; }
+	double GetCrowdingDistance(const unsigned int &point) const { return crowdingDistances[point]; }
+	unsigned int GetFrontSize(const unsigned int &rank) const { return fronts[rank].size(); }
+	unsigned int GetFrontCount() const { return fronts.size(); }
+
+	// Points in order of preference (increasing rank, then decreasing crowding distance)
+	const std::vector<unsigned int> &GetOrder() const { return order; }
+
+	static bool Dominates(const double *a, const double *b, const unsigned int &objectiveCount);
+
+private:
+	unsigned int numberOfThreads;
+
+	const double *objectives;
+	unsigned int count;
+	unsigned int objectiveCount;
+
+	// For each point, the number of points that dominate it and the points it dominates
+	std::vector<unsigned int> dominationCounts;
+	std::vector<std::vector<unsigned int> > dominatedPoints;
+
+	std::vector<unsigned int> ranks;
+	std::vector<std::vector<unsigned int> > fronts;
+
+	std::vector<double> crowdingDistances;
+
+	std::vector<unsigned int> order;
+
+	// The pairwise comparisons are split among the threads by point
+	void ComputeDominanceInParallel();
+	void ComputeDominance(const unsigned int &first, const unsigned int &last);
+
+	// The crowding distances only require sorting each front once per objective,
+	// which is much less work than the pairwise comparisons, so they are computed
+	// in the calling thread
+	void ComputeCrowding();
+	void SortFronts();
+
+	// Below this number of points, the work is done in the calling thread
+	static const unsigned int minimumParallelCount;
+
+	class RankingThread : public wxThread
+	{
+	public:
+		RankingThread(ParetoRanking &ranking, const unsigned int &first, const unsigned int &last);
+
+	protected:
+		ExitCode Entry();
+
+	private:
+		ParetoRanking &ranking;
+		const unsigned int first;
+		const unsigned int last;
+	};
+};
+
+#endif// PARETO_RANKING_H_
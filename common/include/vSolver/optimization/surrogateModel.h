@@ -0,0 +1,66 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  surrogateModel.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Radial basis function interpolant that approximates an expensive
+//				 function from previously evaluated samples.  Allows genetic algorithms
+//				 to rank candidates cheaply and analyze only the most promising ones.
+// History:
+
+#ifndef SURROGATE_MODEL_H_
+#define SURROGATE_MODEL_H_
+
+// Standard C++ headers
+#include <vector>
+
+class SurrogateModel
+{
+public:
+	SurrogateModel();
+
+	// Clears the model; once sampleLimit samples are stored, the oldest are replaced
+	void Initialize(const unsigned int &inputCount, const unsigned int &outputCount,
+		const unsigned int &sampleLimit);
+	void Clear();
+
+	// Samples with undefined outputs are ignored
+	void AddSample(const double *inputs, const double *outputs);
+
+	// Must be called after adding samples and before Predict()
+	bool Fit();
+	bool IsFit() const { return isFit; }
+
+	void Predict(const double *inputs, double *outputs) const;
+
+	unsigned int GetSampleCount() const { return sampleCount; }
+
+private:
+	unsigned int inputCount;
+	unsigned int outputCount;
+	unsigned int sampleLimit;
+	unsigned int sampleCount;
+	unsigned int nextSample;
+
+	// Row-major (one row per sample)
+	std::vector<double> sampleInputs;
+	std::vector<double> sampleOutputs;
+
+	// Determined by Fit() (one row of weights per sample)
+	std::vector<double> weights;
+	std::vector<double> outputMeans;
+	double width;
+	bool isFit;
+
+	double GetSquaredDistance(const double *a, const double *b) const;
+	double Kernel(const double &squaredDistance) const;
+};
+
+#endif// SURROGATE_MODEL_H_
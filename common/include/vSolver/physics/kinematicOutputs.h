@@ -24,6 +24,9 @@
 #ifndef KINEMATIC_OUTPUTS_H_
 #define KINEMATIC_OUTPUTS_H_
 
+// Standard C++ headers
+#include <cstddef>
+
 // wxWidgets headers
 #include <wx/thread.h>
 
@@ -41,8 +44,58 @@ class KinematicOutputs
 public:
 	KinematicOutputs();
 
+	// Groups of outputs that are computed together.  Update() skips the groups that
+	// are not included in the mask (those outputs are left undefined).
+	enum OutputGroup
+	{
+		GroupCaster				= 1 << 0,// Caster
+		GroupKPI				= 1 << 1,// KPI
+		GroupCasterTrail		= 1 << 2,// CasterTrail
+		GroupScrubRadius		= 1 << 3,// ScrubRadius
+		GroupSpindleLength		= 1 << 4,// SpindleLength
+		GroupCamberAndSteer		= 1 << 5,// Camber, Steer
+		GroupSpring				= 1 << 6,// Spring
+		GroupDamper				= 1 << 7,// Damper
+		GroupScrub				= 1 << 8,// Scrub
+		GroupAxlePlunge			= 1 << 9,// AxlePlunge
+		GroupInstantCenter		= 1 << 10,// InstantCenter, InstantAxisDirection
+		GroupInstallationRatios	= 1 << 11,// Spring-, Damper- and ARBInstallationRatio
+		GroupSwingArms			= 1 << 12,// Side- and FrontViewSwingArmLength, AntiBrake- and AntiDrivePitch
+		GroupNetSteer			= 1 << 13,// Front- and RearNetSteer
+		GroupNetScrub			= 1 << 14,// Front- and RearNetScrub
+		GroupARBTwist			= 1 << 15,// Front- and RearARBTwist
+		GroupRollCenters		= 1 << 16,// Front- and RearKinematicRC, roll axis directions
+		GroupPitchCenters		= 1 << 17,// Right- and LeftKinematicPC, pitch axis directions
+		GroupTrack				= 1 << 18,// Track outputs
+		GroupWheelbase			= 1 << 19,// Wheelbase outputs
+
+		GroupAll				= (1 << 20) - 1
+	};
+	typedef unsigned int OutputMask;
+
+	// Properties of the un-perturbed car (other than its suspension) that are used by
+	// the outputs, so a reference copy of the car only needs to include its suspension
+	struct CarProperties
+	{
+		bool frontHalfShafts;
+		bool rearHalfShafts;
+		bool frontBrakesInboard;
+		bool rearBrakesInboard;
+		bool frontWheelDrive;// Front or all wheel drive
+		bool rearWheelDrive;// Rear or all wheel drive
+		double percentFrontBraking;
+		double cgHeight;// [in]
+	};
+
+	static CarProperties GetCarProperties(const Car &car);
+
 	// Updates the kinematic variables associated with the current Suspension
-	void Update(const Car *original, const Suspension *current);
+	void Update(const Car *original, const Suspension *current, const OutputMask &mask = GroupAll);
+	void Update(const Suspension *original, const CarProperties &properties,
+		const Suspension *current, const OutputMask &mask = GroupAll);
+
+	// Sets every output to undefined (i.e. for points that could not be solved)
+	void InitializeAllOutputs();
 
 	// Enumeration for double outputs that get computed for every corner
 	enum CornerOutputsDouble
@@ -179,6 +232,11 @@ public:
 	// For accessing an output via the OutputsComplete list
 	double GetOutputValue(const OutputsComplete &output) const;
 
+	// For determining the groups required to compute an output (including the
+	// groups on which it depends)
+	static OutputMask GetOutputMask(const OutputsComplete &output);
+	static OutputMask AddDependencies(OutputMask mask);
+
 	// For determining unit type of the outputs
 	static UnitConverter::UnitType GetOutputUnitType(const OutputsComplete &output);
 
@@ -186,11 +244,28 @@ public:
 	static wxString GetOutputName(const OutputsComplete &output);
 
 private:
-	const Car *originalCar;
-	const Suspension *currentSuspension;
+	// Table mapping each OutputsComplete to the location of its value within the
+	// object, so GetOutputValue() is a single indexed load instead of a search
+	// through the output ranges.  The offsets come from offsetof(), so every data
+	// member must remain public (the class must be standard-layout).
+	class OutputOffsetTable
+	{
+	public:
+		OutputOffsetTable();
+
+		std::size_t offsets[NumberOfOutputScalars];// [bytes from start of object]
+
+	private:
+		void AddDoubles(const std::size_t &arrayOffset, const int &count, const int &start);
+		void AddVectors(const std::size_t &arrayOffset, const int &count, const int &start);
+	};
+
+	static const OutputOffsetTable &GetOutputOffsets();
 
 	// Updates the outputs associated with the associated corner
-	void UpdateCorner(const Corner *originalCorner, const Corner *currentCorner);
+	void UpdateCorner(const Corner *originalCorner, const Corner *currentCorner,
+		const Suspension *originalSuspension, const CarProperties &carProperties,
+		const Suspension *currentSuspension, const OutputMask &mask);
 
 	// For retrieving names of the outputs
 	static wxString GetCornerDoubleName(const CornerOutputsDouble &output);
@@ -204,12 +279,10 @@ private:
 	static UnitConverter::UnitType GetDoubleUnitType(const OutputsDouble &output);
 	static UnitConverter::UnitType GetVectorUnitType(const OutputsVector &output);
 
-	void InitializeAllOutputs();
-
 	void ComputeNetSteer();
 	void ComputeNetScrub();
-	void ComputeFrontARBTwist(const Car *original, const Suspension *current);
-	void ComputeRearARBTwist(const Car *original, const Suspension *current);
+	void ComputeFrontARBTwist(const Suspension *original, const Suspension *current);
+	void ComputeRearARBTwist(const Suspension *original, const Suspension *current);
 	void ComputeTrack(const Suspension *current);
 	void ComputeWheelbase(const Suspension *current);
 	void ComputeFrontRollCenter(const Suspension *current);
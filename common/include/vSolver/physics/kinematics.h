@@ -24,11 +24,15 @@
 #ifndef KINEMATICS_H_
 #define KINEMATICS_H_
 
+// Standard C++ headers
+#include <vector>
+
 // VVASE headers
 #include "vSolver/physics/kinematicOutputs.h"
 
 // VVASE forward declarations
 class Car;
+class CornerThread;
 
 class Kinematics
 {
@@ -72,7 +76,27 @@ public:
 	inline void SetInputs(const Inputs& inputs) { this->inputs = inputs; }
 	inline void SetTireDeflections(const WheelSet& deflections) { inputs.tireDeflections = deflections; }
 
+	// Solving the corners on separate threads reduces the time for a single solution
+	// (i.e. for interactive editing), but does not help when other threads are busy
+	inline void SetParallelCorners(const bool &parallelCorners) { this->parallelCorners = parallelCorners; }
+	inline bool GetParallelCorners() const { return parallelCorners; }
+
+	// When solving a sweep, each point can be started from the solution to the previous
+	// points (extrapolated along the sweep) instead of from the design position
+	inline void SetWarmStart(const bool &warmStart) { this->warmStart = warmStart; }
+	inline bool GetWarmStart() const { return warmStart; }
+
+	// Only the output groups in the mask are computed (see KinematicOutputs::OutputGroup)
+	inline void SetOutputMask(const KinematicOutputs::OutputMask &outputMask) { this->outputMask = outputMask; }
+	inline KinematicOutputs::OutputMask GetOutputMask() const { return outputMask; }
+
+	// Number of contact patch iterations (summed over the corners) performed by the
+	// last call to UpdateKinematics() or SolveSweep()
+	inline unsigned long GetIterationCount() const { return iterationCount; }
+
 	void UpdateKinematics(const Car* originalCar, Car* workingCar, wxString name);
+	void SolveSweep(const Car& originalCar, const std::vector<Inputs>& inputList,
+		std::vector<KinematicOutputs>& outputList);
 
 	inline KinematicOutputs GetOutputs() const { return outputs; }
 	inline double GetPitch() const { return inputs.pitch; }
@@ -85,16 +109,44 @@ public:
 	inline Inputs GetInputs() const { return inputs; }
 
 private:
-	Inputs inputs;
+	friend class CornerThread;
 
-	const Car *originalCar;
+	Inputs inputs;
+	bool parallelCorners;
+	bool warmStart;
+	KinematicOutputs::OutputMask outputMask;
+	unsigned long iterationCount;
+
+	// Un-perturbed suspension and car properties (for reference only)
+	const Suspension *originalSuspension;
+	KinematicOutputs::CarProperties carProperties;
 	Car *workingCar;
 	Suspension *localSuspension;
 
 	KinematicOutputs outputs;
 
-	bool SolveCorner(Corner &corner, const Corner &original,
-		const Vector &rotations, const Vector::Axis &secondRotation, const double& tireDeflection);
+	// Starting point for the contact patch iteration at each corner (right front,
+	// left front, right rear, left rear) when warm starting
+	struct CornerGuesses
+	{
+		double lowerBallJointZ[4];			// [in]
+		double branchTolerance[4];			// [in] solutions further than this from the guess are re-checked
+	};
+
+	bool SolveSuspension(Vector &rotations, Vector::Axis &secondRotation,
+		const CornerGuesses *guesses = NULL);
+	unsigned int SolveCorners(Corner* const *corners, const Corner* const *originalCorners,
+		const double *tireDeflections, const unsigned int &count, const Vector &rotations,
+		const Vector::Axis &secondRotation, const double *guesses, const double *branchTolerances,
+		bool *success);
+	unsigned int SolveCornersInParallel(Corner* const *corners, const Corner* const *originalCorners,
+		const double *tireDeflections, const Vector &rotations, const Vector::Axis &secondRotation,
+		const double *guesses, const double *branchTolerances, bool *success);
+	static double ComputeStepRatio(const Inputs &first, const Inputs &second, const Inputs &third);
+	void MoveChassisPoints(Corner &corner, const Vector &rotations,
+		const Vector::Axis &secondRotation, const bool &isAtFront) const;
+	bool SolveActuation(Corner &corner, const Corner &originalCorner, const bool &isAtFront);
+	static void UpdateContactPatch(Corner &corner, const Corner &originalCorner);
 
 	void UpdateOutputs();
 
@@ -105,6 +157,13 @@ private:
 	static bool SolveForPoint(const Corner::Hardpoints &target, const Corner::Hardpoints& reference1,
 		const Corner::Hardpoints& reference2, const Corner::Hardpoints& reference3,
 		const Corner& originalCorner, Corner& currentCorner);
+	static void SolveForPoints(const Corner::Hardpoints &target, const Corner::Hardpoints& reference1,
+		const Corner::Hardpoints& reference2, const Corner::Hardpoints& reference3,
+		const Corner* const *originalCorners, Corner* const *currentCorners, const unsigned int &count,
+		bool *solved);
+	static const Vector& ChooseIntersection(const Vector &center1, const Vector &center2,
+		const Vector &center3, const Vector &originalCenter1, const Vector &originalCenter2,
+		const Vector &originalCenter3, const Vector &original, const Vector *intersections);
 	static bool SolveForXY(const Corner::Hardpoints &target, const Corner::Hardpoints& reference1,
 		const Corner::Hardpoints& reference2, const Corner& originalCorner, Corner& currentCorner);
 	static bool SolveForContactPatch(const Vector &wheelCenter, const Vector &wheelPlaneNormal,
@@ -25,7 +25,7 @@
 class Car;
 class KinematicOutputs;
 class QuasiStaticOutputs;
-class Matrix;
+template<unsigned int R, unsigned int C> class FixedMatrix;
 class TireSet;
 
 class QuasiStatic
@@ -42,7 +42,7 @@ public:
 
 	Kinematics::Inputs Solve(const Car* originalCar, Car* workingCar,
 		const Kinematics::Inputs& kinematicsInputs, const Inputs& inputs,
-		QuasiStaticOutputs& outputs) const;
+		QuasiStaticOutputs& outputs, const QuasiStaticOutputs* initialGuess = NULL) const;
 
 private:
 	WheelSet ComputeWheelLoads(const Car* originalCar, const KinematicOutputs& outputs,
@@ -50,11 +50,14 @@ private:
 	WheelSet ComputePreLoad(const Car* workingCar) const;
 	WheelSet ComputeTireDeflections(const TireSet& tires, const WheelSet& wheelLoads) const;
 
-	Matrix BuildSystemMatrix(const Car* workingCar) const;
-	Matrix BuildRightHandMatrix(const Car* workingCar, const double& gx, const double& gy,
+	FixedMatrix<13, 4> BuildSystemMatrix(const Car* workingCar) const;
+	FixedMatrix<13, 1> BuildRightHandMatrix(const Car* workingCar, const double& gx, const double& gy,
 		const KinematicOutputs& outputs, const WheelSet& preLoad) const;
-	Matrix ComputeError(const Car* workingCar, const double& gx, const double& gy,
+	FixedMatrix<13, 1> ComputeError(const Car* workingCar, const double& gx, const double& gy,
 		const KinematicOutputs& outputs, const WheelSet& preLoad) const;
+	FixedMatrix<13, 3> ComputeJacobian(Kinematics& kinematics, const Car* originalCar, Car* workingCar,
+		const FixedMatrix<3, 1>& guess, const FixedMatrix<13, 1>& error, const Inputs& inputs,
+		const WheelSet& preLoad, const unsigned int& iteration) const;
 	static double ComputeDeltaWheelSets(const WheelSet& w1, const WheelSet& w2);
 };
 
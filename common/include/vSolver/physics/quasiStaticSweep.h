@@ -0,0 +1,78 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  quasiStaticSweep.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Quasi-static sweep object.  Solves the quasi-static vehicle attitude for
+//				 a set of accelerations (i.e. a g-g diagram), distributing the points
+//				 across the worker threads.
+// History:
+
+#ifndef QUASI_STATIC_SWEEP_H_
+#define QUASI_STATIC_SWEEP_H_
+
+// Standard C++ headers
+#include <vector>
+
+// Local headers
+#include "vSolver/physics/kinematics.h"
+
+// Local forward declarations
+class Car;
+class JobQueue;
+class QuasiStaticOutputs;
+
+class QuasiStaticSweep
+{
+public:
+	QuasiStaticSweep();
+
+	// Point definitions (each replaces any existing points) [G]
+	void SetGrid(const double &gxMin, const double &gxMax, const unsigned int &gxCount,
+		const double &gyMin, const double &gyMax, const unsigned int &gyCount);
+	void SetPolar(const double &maximumG, const unsigned int &radialCount,
+		const unsigned int &angularCount);
+	void SetPoints(const std::vector<double> &gx, const std::vector<double> &gy);
+
+	// Solves every point using the threads attached to the queue (returns once all
+	// points are solved)
+	void Solve(JobQueue &queue, const unsigned int &threadCount, const Car &originalCar,
+		const Kinematics::Inputs &kinematicsInputs, const double &rackTravel);
+
+	// Solves the points in [start, end) on the calling thread (used by the worker threads)
+	void SolveRange(const unsigned int &start, const unsigned int &end);
+
+	inline unsigned int GetCount() const { return gx.size(); }
+
+	// Results, one entry per point (in the order the points were defined; QNAN for
+	// points that could not be solved)
+	std::vector<double> gx;// [G]
+	std::vector<double> gy;// [G]
+	std::vector<double> roll;// [rad]
+	std::vector<double> pitch;// [rad]
+	std::vector<double> heave;// [in]
+	std::vector<double> leftFrontLoad;// [lbf]
+	std::vector<double> rightFrontLoad;// [lbf]
+	std::vector<double> leftRearLoad;// [lbf]
+	std::vector<double> rightRearLoad;// [lbf]
+
+private:
+	// Valid only during Solve()
+	const Car *originalCar;
+	Kinematics::Inputs kinematicsInputs;
+	double rackTravel;
+
+	void AllocateResults();
+	static bool IsSolved(const QuasiStaticOutputs &outputs);
+	unsigned int FindNearestSolved(const unsigned int &start, const unsigned int &end,
+		const unsigned int &point) const;
+};
+
+#endif// QUASI_STATIC_SWEEP_H_
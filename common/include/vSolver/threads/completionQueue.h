@@ -0,0 +1,47 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  completionQueue.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  This class is a synchronization object for multi-threaded applications.
+//				 Worker threads post a tag as each job completes, and the waiting thread
+//				 receives the tags in the order in which the jobs completed (unlike
+//				 InverseSemaphore, which only reports when all jobs are complete).
+// History:
+
+#ifndef COMPLETION_QUEUE_H_
+#define COMPLETION_QUEUE_H_
+
+// Standard C++ headers
+#include <deque>
+
+// wxWidgets headers
+#include <wx/thread.h>
+
+class CompletionQueue
+{
+public:
+	CompletionQueue();
+
+	void Post(const unsigned int &tag);
+
+	// Blocks until a tag is available
+	unsigned int Wait();
+
+	unsigned int GetCount();
+
+private:
+	wxMutex mutex;
+	wxCondition condition;
+
+	std::deque<unsigned int> tags;
+};
+
+#endif// COMPLETION_QUEUE_H_
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  cornerThread.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class declaration for the CornerThread class.  This is a
+//				 short-lived, joinable thread that solves one corner of the car on
+//				 behalf of a Kinematics object (see Kinematics::SetParallelCorners()).
+// History:
+
+#ifndef CORNER_THREAD_H_
+#define CORNER_THREAD_H_
+
+// wxWidgets headers
+#include <wx/thread.h>
+
+// VVASE headers
+#include "vCar/corner.h"
+#include "vMath/vector.h"
+
+// VVASE forward declarations
+class Kinematics;
+
+class CornerThread : public wxThread
+{
+public:
+	CornerThread(Kinematics &kinematics, Corner &corner, const Corner &originalCorner,
+		const double &tireDeflection, const Vector &rotations, const Vector::Axis &secondRotation,
+		const double *guess = NULL, const double *branchTolerance = NULL);
+
+	// Valid only after the thread has been waited on
+	bool GetSuccess() const { return success; }
+	unsigned int GetIterations() const { return iterations; }
+
+protected:
+	ExitCode Entry();
+
+private:
+	Kinematics &kinematics;
+
+	Corner &corner;
+	const Corner &originalCorner;
+	const double tireDeflection;
+	const Vector rotations;
+	const Vector::Axis secondRotation;
+	const double *guess;
+	const double *branchTolerance;
+
+	bool success;
+	unsigned int iterations;
+};
+
+#endif// CORNER_THREAD_H_
@@ -13,6 +13,9 @@
 // Description:  Contains the class declaration for the JOB_QUEUE class.  This queue
 //				 handles task priorities and is used to communicate from the GUI thread
 //				 to the worker threads (add tasks here to be completed by the workers).
+//				 Each worker thread owns a deque (with its own lock) for each priority;
+//				 jobs are handed to the workers' deques in turn, and worker threads
+//				 steal from other deques when their own is empty.
 // History:
 
 #ifndef JOB_QUEUE_H_
@@ -20,12 +23,13 @@
 
 // wxWidgets headers
 #include <wx/wx.h>
+#include <wx/atomic.h>
 
 // VVASE headers
 #include "vSolver/threads/threadJob.h"
 
 // Standard C++ headers
-#include <map>
+#include <deque>
 
 // wxWidgets forward declarations
 class wxEvtHandler;
@@ -41,17 +45,26 @@ public:
 		PriorityNormal,
 		PriorityLow,
 		PriorityVeryLow,
-		PriorityIdle
+		PriorityIdle,
+
+		NumberOfPriorities
 	};
 
 	JobQueue(wxEvtHandler *parent);
+	~JobQueue();
 
 	void AddJob(const ThreadJob& job, const JobPriority& priority = PriorityNormal);
 
-	ThreadJob Pop();
+	// Each worker thread attaches before pulling jobs (the returned index identifies
+	// its own deque) and detaches when it exits
+	unsigned int AttachWorker();
+	void DetachWorker(const unsigned int &worker);
+
+	ThreadJob Pop(const unsigned int &worker);
 
 	// Reports a message back to the main event handler
-	void Report(const ThreadJob::ThreadCommand& command, int threadId, int objectID = 0);
+	void Report(const ThreadJob::ThreadCommand& command, int threadId, int objectID = 0,
+		unsigned int count = 1);
 
 	size_t PendingJobs();
 
@@ -60,11 +73,42 @@ public:
 private:
     wxEvtHandler *parent;
 
-	// Use of a multimap allow prioritization - lower keys come first, jobs with equal keys are appended
-    std::multimap<JobPriority, ThreadJob> jobs;
+	// Jobs owned by one worker thread.  The owner and thieves both take the oldest job
+	// first, so jobs of equal priority in each deque are started in the order they
+	// were added.
+	struct WorkerDeque
+	{
+		WorkerDeque();
+
+		wxMutex mutex;
+		std::deque<ThreadJob> jobs[NumberOfPriorities];
+
+		// Jobs that have not been claimed by a thread (may be read without the lock)
+		wxAtomicInt unclaimed[NumberOfPriorities];
+
+		// Number of threads using this as their own deque (zero once the owner has
+		// exited; its jobs can still be stolen, and it is given to the next worker)
+		wxAtomicInt owners;
+	};
+
+	static const unsigned int maximumWorkers;
+
+	// Deques are never removed while the queue exists, so they may be read without
+	// locking registryMutex (only the first workerCount are valid)
+	WorkerDeque **workers;
+	wxAtomicInt workerCount;
+	wxMutex registryMutex;
+
+	// Deque to receive the next job (jobs are handed to the owned deques in turn)
+	wxAtomicInt nextWorker;
+
+	// Unclaimed jobs at each priority in all deques (so empty priorities are skipped)
+	wxAtomicInt pendingCount[NumberOfPriorities];
+
+	WorkerDeque *ClaimJob(const unsigned int &worker, JobPriority &priority);
+	static bool Claim(WorkerDeque &deque, const JobPriority &priority);
 
-	// Thread protection objects
-    wxMutex mutexQueue;
+	// Counts the unclaimed jobs in all deques
     wxSemaphore queueCount;
 };
 
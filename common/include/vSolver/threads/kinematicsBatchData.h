@@ -0,0 +1,84 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  kinematicsBatchData.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class declaration for the KinematicsBatchData class.  This
+//				 contains a contiguous slice of kinematics analyses to be completed by a
+//				 single job (and reported once, when the whole slice is done).
+// History:
+
+#ifndef KINEMATICS_BATCH_DATA_H_
+#define KINEMATICS_BATCH_DATA_H_
+
+// Standard C++ headers
+#include <vector>
+
+// wxWidgets headers
+#include <wx/wx.h>
+
+// VVASE headers
+#include "vSolver/threads/threadData.h"
+#include "vSolver/physics/kinematics.h"
+
+// VVASE forward declarations
+class Car;
+class InverseSemaphore;
+class CompletionQueue;
+
+class KinematicsBatchData : public ThreadData
+{
+public:
+	KinematicsBatchData();
+	~KinematicsBatchData();
+
+	// Adds one analysis to this batch
+	void Add(const Car *originalCar, const Kinematics::Inputs &kinematicInputs,
+		KinematicOutputs *output);
+	inline unsigned int GetCount() const { return inputs.size(); }
+
+	// Data required to perform kinematic analyses (for Iteration or GAObject objects).
+	// All three vectors are the same length; consecutive entries that share an
+	// original car are solved as one sweep.
+	std::vector<const Car*> originalCars;
+	std::vector<Kinematics::Inputs> inputs;
+	std::vector<KinematicOutputs*> outputs;
+
+	// Optional; posted by the worker thread once every analysis in the batch is
+	// complete (allows waiting for results without an event loop)
+	InverseSemaphore *completion;
+
+	// Optional; completionTag is posted by the worker thread once every analysis in
+	// the batch is complete (allows reacting to each batch as it finishes)
+	CompletionQueue *completionQueue;
+	unsigned int completionTag;
+
+	// Start each point of a sweep from the previous points (see Kinematics::SetWarmStart());
+	// worthwhile only when consecutive entries are close together (i.e. Iteration)
+	bool warmStart;
+
+	// Output groups to compute for every analysis in the batch (see KinematicOutputs::OutputGroup)
+	KinematicOutputs::OutputMask outputMask;
+
+	// Determines how many analyses to put in each batch so that the work is
+	// spread evenly across the available threads
+	static unsigned int ComputeBatchSize(const unsigned int &analysisCount,
+		const unsigned int &threadCount);
+
+	// Mandatory overload from ThreadData
+	bool OkForCommand(ThreadJob::ThreadCommand &command);
+
+private:
+	// Number of batches to create for each thread (more than one gives better
+	// load balancing when some analyses take longer than others)
+	static const unsigned int batchesPerThread;
+};
+
+#endif// KINEMATICS_BATCH_DATA_H_
@@ -34,12 +34,15 @@ public:
 		Kinematics::Inputs kinematicInputs, KinematicOutputs *output);
 	~KinematicsData();
 
-	// Data required to perform kinematic analyses (for GuiCar or Iteration objects)
+	// Data required to perform kinematic analyses (for GuiCar objects)
 	const Car *originalCar;
 	Car *workingCar;
 	Kinematics::Inputs kinematicInputs;
 	KinematicOutputs *output;
 
+	// Solve the corners on separate threads (see Kinematics::SetParallelCorners())
+	bool parallelCorners;
+
 	// Mandatory overload from ThreadData
 	bool OkForCommand(ThreadJob::ThreadCommand &Command);
 };
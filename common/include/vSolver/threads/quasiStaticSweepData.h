@@ -0,0 +1,47 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  quasiStaticSweepData.h
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class declaration for the QuasiStaticSweepData class.  This
+//				 identifies a contiguous range of points of a QuasiStaticSweep to be
+//				 solved by a single job.
+// History:
+
+#ifndef QUASI_STATIC_SWEEP_DATA_H_
+#define QUASI_STATIC_SWEEP_DATA_H_
+
+// VVASE headers
+#include "vSolver/threads/threadData.h"
+
+// VVASE forward declarations
+class QuasiStaticSweep;
+class InverseSemaphore;
+
+class QuasiStaticSweepData : public ThreadData
+{
+public:
+	QuasiStaticSweepData(QuasiStaticSweep *sweep, const unsigned int &start,
+		const unsigned int &end);
+	~QuasiStaticSweepData();
+
+	// The sweep and the range of points to solve ([start, end))
+	QuasiStaticSweep *sweep;
+	unsigned int start;
+	unsigned int end;
+
+	// Optional; posted by the worker thread once the range is solved
+	InverseSemaphore *completion;
+
+	// Mandatory overload from ThreadData
+	bool OkForCommand(ThreadJob::ThreadCommand &command);
+};
+
+#endif// QUASI_STATIC_SWEEP_DATA_H_
@@ -34,10 +34,12 @@ public:
 		CommandThreadExit = -1,
 		CommandThreadNull =  0,
 		CommandThreadStarted,
-		CommandThreadKinematicsNormal,
-		CommandThreadKinematicsIteration,
-		CommandThreadKinematicsGA,
-		CommandThreadGeneticOptimization
+		CommandThreadKinematicsNormal,// Uses KinematicsData
+		CommandThreadKinematicsIteration,// Uses KinematicsBatchData
+		CommandThreadKinematicsGA,// Uses KinematicsBatchData
+		CommandThreadGeneticOptimization,
+		CommandThreadQuasiStaticSweep,// Uses QuasiStaticSweepData
+		CommandThreadKinematicsRefinement// Uses KinematicsBatchData (no progress reported to the GUI)
 	};
 
 	ThreadJob();
@@ -19,6 +19,9 @@
 #ifndef WORKER_THREAD_H_
 #define WORKER_THREAD_H_
 
+// Standard C++ headers
+#include <vector>
+
 // wxWidgets headers
 #include <wx/thread.h>
 
@@ -27,23 +30,30 @@
 
 // VVASE forward declarations
 class JobQueue;
+class KinematicsBatchData;
 
 class WorkerThread : public wxThread
 {
 public:
-	WorkerThread(JobQueue* jobQueue, int id = wxID_ANY);
+	WorkerThread(JobQueue* jobQueue, int id = wxID_ANY, wxThreadKind kind = wxTHREAD_DETACHED);
 	~WorkerThread();
 
 private:
 	JobQueue* jobQueue;
 
 	int id;
+	unsigned int worker;// Identifies our own deque in the job queue
 	virtual wxThread::ExitCode Entry();
 
 	// The job handler (called when this thread pulls a job from the queue)
 	virtual void OnJob();
 
 	Kinematics kinematicAnalysis;
+
+	// Solves all analyses in a batch job (storage is re-used between jobs)
+	void SolveBatch(const KinematicsBatchData &data);
+	std::vector<Kinematics::Inputs> sweepInputs;
+	std::vector<KinematicOutputs> sweepOutputs;
 };
 
 #endif// WORKER_THREAD_H_
\ No newline at end of file
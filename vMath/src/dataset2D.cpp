@@ -17,6 +17,7 @@
 #include <fstream>
 #include <utility>
 #include <cassert>
+#include <algorithm>
 
 // wxWidgets headers
 #include <wx/wx.h>
@@ -46,6 +47,7 @@ Dataset2D::Dataset2D()
 	numberOfPoints = 0;
 	xData = NULL;
 	yData = NULL;
+	xOrder = XOrderUnknown;
 }
 
 //==========================================================================
@@ -171,6 +173,7 @@ void Dataset2D::Resize(const unsigned int &numberOfPoints)
 
 	xData = new double[numberOfPoints];
 	yData = new double[numberOfPoints];
+	xOrder = XOrderUnknown;
 }
 
 //==========================================================================
@@ -234,34 +237,137 @@ void Dataset2D::ExportDataToFile(wxString pathAndFileName) const
 //==========================================================================
 bool Dataset2D::GetYAt(const double &x, double &y, bool *exactValue) const
 {
-	// This assumes data is entered from small x to large x and that y is a function of x
+	// This assumes that y is a function of x.  The value is taken from the first
+	// point with an x-value not less than x, which we can find with a binary search
+	// if the data is entered from small x to large x.
 	unsigned int i;
-	for (i = 0; i < numberOfPoints; i++)
+	if (XIsIncreasing())
+		i = std::lower_bound(xData, xData + numberOfPoints, x) - xData;
+	else
 	{
-		if (xData[i] == x)
+		for (i = 0; i < numberOfPoints; i++)
 		{
-			y = yData[i];
+			if (xData[i] >= x)
+				break;
+		}
+	}
 
-			if (exactValue)
-				*exactValue = true;
+	return InterpolateAt(i, x, y, exactValue);
+}
 
-			return true;
-		}
-		else if (xData[i] > x)
-		{
-			if (i > 0)
-				y = yData[i - 1] + (yData[i] - yData[i - 1]) * (x - xData[i - 1]) / (xData[i] - xData[i - 1]);
-			else
-				y = yData[i];
+//==========================================================================
+// Class:			Dataset2D
+// Function:		GetYAtFrom
+//
+// Description:		Retrieves the Y-value at the specified X-value, searching
+//					forward from the specified point.  For resampling at many
+//					increasing X-values in a single pass; the x-data must be
+//					increasing.
+//
+// Input Arguments:
+//		x		= const double& specifying the X-value
+//		start	= unsigned int& point from which to search (the first point
+//				  with an x-value not less than any previously requested x)
+//
+// Output Arguments:
+//		y		= double& specifying the Y-value
+//		start	= unsigned int& updated for the next search
+//
+// Return Value:
+//		true if specified x is within range of data, false otherwise
+//
+//==========================================================================
+bool Dataset2D::GetYAtFrom(const double &x, double &y, unsigned int &start) const
+{
+	assert(XIsIncreasing());
+	while (start < numberOfPoints && xData[start] < x)
+		start++;
+
+	return InterpolateAt(start, x, y);
+}
+
+//==========================================================================
+// Class:			Dataset2D
+// Function:		InterpolateAt
+//
+// Description:		Computes the Y-value at the specified X-value, given the
+//					first point with an x-value not less than x.
+//
+// Input Arguments:
+//		i	= const unsigned int& index of the first point with xData[i] >= x
+//		x	= const double& specifying the X-value
+//
+// Output Arguments:
+//		y	= double& specifying the Y-value
+//		exactValue	= bool* indicating whether or not the exact value is being returned
+//
+// Return Value:
+//		true if specified x is within range of data, false otherwise
+//
+//==========================================================================
+bool Dataset2D::InterpolateAt(const unsigned int &i, const double &x, double &y, bool *exactValue) const
+{
+	if (i >= numberOfPoints)
+		return false;
 
-			if (exactValue)
-				*exactValue = false;
+	if (xData[i] == x)
+	{
+		y = yData[i];
+
+		if (exactValue)
+			*exactValue = true;
+	}
+	else if (xData[i] > x)
+	{
+		if (i > 0)
+			y = yData[i - 1] + (yData[i] - yData[i - 1]) * (x - xData[i - 1]) / (xData[i] - xData[i - 1]);
+		else
+			y = yData[i];
 
-			return true;
+		if (exactValue)
+			*exactValue = false;
+	}
+	else
+		return false;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			Dataset2D
+// Function:		XIsIncreasing
+//
+// Description:		Checks to see if the x-data is non-decreasing.  The result
+//					is stored until the x-data is next accessed for writing.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool Dataset2D::XIsIncreasing() const
+{
+	if (xOrder == XOrderUnknown)
+	{
+		xOrder = XOrderIncreasing;
+		unsigned int i;
+		for (i = 1; i < numberOfPoints; i++)
+		{
+			// Written so that NaN is unordered
+			if (!(xData[i - 1] <= xData[i]))
+			{
+				xOrder = XOrderUnordered;
+				break;
+			}
 		}
 	}
 
-	return false;
+	return xOrder == XOrderIncreasing;
 }
 
 //==========================================================================
@@ -320,6 +426,7 @@ Dataset2D& Dataset2D::operator=(const Dataset2D &target)
 		xData[i] = target.xData[i];
 		yData[i] = target.yData[i];
 	}
+	xOrder = target.xOrder;
 
 	return *this;
 }
@@ -767,6 +874,8 @@ const Dataset2D Dataset2D::operator%(const double &target) const
 //==========================================================================
 Dataset2D& Dataset2D::MultiplyXData(const double &target)
 {
+	xOrder = XOrderUnknown;
+
 	unsigned int i;
 	for (i = 0; i < numberOfPoints; i++)
 		xData[i] *= target;
@@ -889,6 +998,13 @@ const Dataset2D Dataset2D::ToPower(const double &target) const
 //==========================================================================
 unsigned int Dataset2D::GetNumberOfZoomedPoints(const double &min, const double &max) const
 {
+	if (XIsIncreasing())
+	{
+		const double *end(xData + numberOfPoints);
+		const double *start(std::lower_bound<const double*>(xData, end, min));
+		return std::lower_bound(start, end, max) - start;
+	}
+
 	unsigned int start(0), end(0);
 	while (start < numberOfPoints && xData[start] < min)
 		start++;
@@ -1602,7 +1718,8 @@ Dataset2D Dataset2D::DoUnsyncrhonizedExponentiation(const Dataset2D &d1, const D
 //					in the original datasets, but only for the overlapping portion.
 //					The first dataset is used as the master clock, so the second (d2)
 //					is resampled as necessary to ensure that both output datasets
-//					have a common timebase.
+//					have a common timebase.  Both ends of the overlap are included,
+//					so datasets that already share a timebase keep every point.
 //
 // Input Arguments:
 //		d1	= const Dataset2D&
@@ -1619,32 +1736,52 @@ Dataset2D Dataset2D::DoUnsyncrhonizedExponentiation(const Dataset2D &d1, const D
 void Dataset2D::GetOverlappingOnSameTimebase(const Dataset2D &d1,
 	const Dataset2D &d2, Dataset2D &d1Out, Dataset2D &d2Out)
 {
-	unsigned int start(0);
-	if (d1.GetXData(start) < d2.GetXData(0))
+	// Find the points of d1 that lie within the range of d2 (end is one past the last)
+	unsigned int start(0), end(d1.GetNumberOfPoints());
+	if (d2.GetNumberOfPoints() > 0)
 	{
-		while (d1.GetXData(start) < d2.GetXData(0))
+		const double first2(d2.GetXData(0)), last2(d2.GetXData(d2.GetNumberOfPoints() - 1));
+		while (start < end && d1.GetXData(start) < first2)
 			start++;
+		while (end > start && d1.GetXData(end - 1) > last2)
+			end--;
 	}
+	else
+		end = start;
 
-	unsigned int end1(d1.GetNumberOfPoints() - 1);
-	const unsigned int end2(d2.GetNumberOfPoints() - 1);
-	if (d1.GetXData(end1) > d2.GetXData(end2))
-	{
-		while (d2.GetXData(end2) < d1.GetXData(end1))
-			end1--;
-	}
+	d1Out.Resize(end - start);
+	d2Out.Resize(end - start);
+
+	double *x1Out(d1Out.GetXPointer()), *x2Out(d2Out.GetXPointer());
+	double *y1Out(d1Out.GetYPointer()), *y2Out(d2Out.GetYPointer());
 
-	d1Out.Resize(end1 - start);
-	d2Out.Resize(end1 - start);
+	// If both x-series are sorted, we can resample in a single pass over each
+	// dataset instead of searching from the start for each point
+	const bool merge(d1.XIsIncreasing() && d2.XIsIncreasing());
+	unsigned int cursor1(0), cursor2(0);
 
 	double x;
 	unsigned int i;
-	for (i = 0; i < end1 - start; i++)
+	for (i = 0; i < end - start; i++)
 	{
 		x = d1.GetXData(start + i);
-		d1Out.GetXPointer()[i] = x;
-		d2Out.GetXPointer()[i] = x;
-		d1.GetYAt(x, d1Out.GetYPointer()[i]);
-		d2.GetYAt(x, d2Out.GetYPointer()[i]);
+		x1Out[i] = x;
+		x2Out[i] = x;
+		if (merge)
+		{
+			d1.GetYAtFrom(x, y1Out[i], cursor1);
+			d2.GetYAtFrom(x, y2Out[i], cursor2);
+		}
+		else
+		{
+			d1.GetYAt(x, y1Out[i]);
+			d2.GetYAt(x, y2Out[i]);
+		}
+	}
+
+	if (merge)
+	{
+		d1Out.xOrder = XOrderIncreasing;
+		d2Out.xOrder = XOrderIncreasing;
 	}
 }
\ No newline at end of file
@@ -13,6 +13,9 @@
 // Description:  Handles user-specified mathematical operations on datasets.
 // History:
 
+// Standard C++ headers
+#include <algorithm>
+
 // wxWidgets headers
 #include <wx/wx.h>
 
@@ -61,6 +64,7 @@ ExpressionTree::ExpressionTree(const ManagedList<const Dataset2D> *list) : list(
 //
 //==========================================================================
 const unsigned int ExpressionTree::printfPrecision = 15;
+const unsigned int ExpressionTree::blockSize = 256;
 
 //==========================================================================
 // Class:			ExpressionTree
@@ -131,41 +135,6 @@ std::string ExpressionTree::Solve(std::string expression, std::string &solvedExp
 	return errorString;
 }
 
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		GetSetFromList
-//
-// Description:		Retrieves the proper set from the list.  Handles i=0
-//					where 0 indicates time series instead of data.
-//
-// Input Arguments:
-//		i	= const unsigned int&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		Datased2D requested
-//
-//==========================================================================
-Dataset2D ExpressionTree::GetSetFromList(const unsigned int &i) const
-{
-	assert(list);
-
-	// If user is requesting time, we need to assign the x values to the y values
-	if (i == 0)
-	{
-		Dataset2D set(*(*list)[0]);
-		unsigned int j;
-		for (j = 0; j < set.GetNumberOfPoints(); j++)
-			set.GetYPointer()[j] = set.GetXData(j);
-
-		return set;
-	}
-
-	return *(*list)[i - 1];
-}
-
 //==========================================================================
 // Class:			ExpressionTree
 // Function:		ParenthesesBalanced
@@ -382,8 +351,10 @@ void ExpressionTree::ProcessCloseParenthese(std::stack<wxString> &operatorStack)
 // Class:			ExpressionTree
 // Function:		EvaluateExpression
 //
-// Description:		Evaluates the expression in the queue using Reverse Polish
-//					Notation.
+// Description:		Compiles the expression in the queue and evaluates the
+//					resulting program.  Consecutive element-wise operations on
+//					datasets with a common x-axis are fused into a single kernel,
+//					so no intermediate datasets are created for them.
 //
 // Input Arguments:
 //		None
@@ -397,276 +368,1039 @@ void ExpressionTree::ProcessCloseParenthese(std::stack<wxString> &operatorStack)
 //==========================================================================
 wxString ExpressionTree::EvaluateExpression(Dataset2D &results)
 {
-	wxString next, errorString;
-
-	std::stack<double> doubleStack;
-	std::stack<Dataset2D> setStack;
-	std::stack<bool> useDoubleStack;
+	wxString errorString(CompileExpression());
+	if (!errorString.IsEmpty())
+		return errorString;
 
-	while (!outputQueue.empty())
+	std::vector<Term> stack;
+	std::list<Dataset2D> temporaries;
+	unsigned int i;
+	for (i = 0; i < program.size(); i++)
 	{
-		next = outputQueue.front();
-		outputQueue.pop();
-
-		if (!EvaluateNext(next, doubleStack, setStack, useDoubleStack, errorString))
-			return errorString;
+		if (program[i].code == OpConstant)
+			stack.push_back(Term(program[i].value));
+		else if (program[i].code == OpDataset)
+			stack.push_back(MakeSetTerm(program[i].index));
+		else if (IsBinaryOperation(program[i].code))
+		{
+			ApplyOperation(program[i].code, stack[stack.size() - 2], stack.back(), temporaries);
+			stack.pop_back();
+		}
+		else
+			ApplyFunction(program[i].code, stack.back(), temporaries);
 	}
 
-	if (useDoubleStack.size() > 1)
-		return _T("Not enough operators!");
-
-	if (useDoubleStack.top())
-		return _T("Expression evaluates to a number!");
+	assert(stack.size() == 1 && stack.back().timebase);
+	if (stack.back().set)
+		results = *stack.back().set;
 	else
-		results = setStack.top();
+	{
+		results.Resize(stack.back().timebase->GetNumberOfPoints());
+		std::copy(stack.back().timebase->GetXPointer(), stack.back().timebase->GetXPointer()
+			+ results.GetNumberOfPoints(), results.GetXPointer());
+		ExecuteKernel(stack.back(), results.GetYPointer());
+	}
 
 	return wxEmptyString;
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		EvaluateExpression
+// Function:		CompileExpression
 //
-// Description:		Evaluates the expression in the queue using Reverse Polish
-//					Notation.
+// Description:		Converts the expression in the queue (Reverse Polish
+//					Notation) into a program.  Since the type of each operand
+//					(number or dataset) is known without evaluating anything,
+//					all of the error checking is done here.
 //
 // Input Arguments:
 //		None
 //
 // Output Arguments:
-//		results	= std::string&
+//		None
 //
 // Return Value:
-//		std::string containing a description of any errors, or empty string on success
+//		wxString containing a description of any errors, or wxEmptyString on success
 //
 //==========================================================================
-std::string ExpressionTree::EvaluateExpression(std::string &results)
+wxString ExpressionTree::CompileExpression()
 {
-	wxString next, errorString;
+	program.clear();
 
-	std::stack<double> doubleStack;
-	std::stack<wxString> stringStack;
-	std::stack<bool> useDoubleStack;
+	wxString next, errorString;
+	std::vector<bool> isNumber;
 
 	while (!outputQueue.empty())
 	{
 		next = outputQueue.front();
 		outputQueue.pop();
 
-		if (!EvaluateNext(next, doubleStack, stringStack, useDoubleStack, errorString))
-			return std::string(errorString.mb_str());
-	}
+		if (NextIsFunction(next))
+			errorString = CompileFunction(next, isNumber);
+		else if (NextIsNumber(next))
+			errorString = CompileNumber(next, isNumber);
+		else if (NextIsDataset(next))
+			errorString = CompileDataset(next, isNumber);
+		else if (NextIsOperator(next))
+			errorString = CompileOperator(next, isNumber);
+		else
+			errorString = _T("Unable to evaluate '") + next + _T("'.");
 
-	if (useDoubleStack.size() > 1)
-		return "Not enough operators!";
+		if (!errorString.IsEmpty())
+		{
+			outputQueue = std::queue<wxString>();
+			return errorString;
+		}
+	}
 
-	if (useDoubleStack.top())
-		results = wxString::Format("%0.*f",
-			VVASEMath::GetPrecision(doubleStack.top(), printfPrecision),
-			doubleStack.top()).mb_str();
-	else
-		results = stringStack.top();
+	if (isNumber.empty())
+		return _T("Nothing to evaluate!");
+	else if (isNumber.size() > 1)
+		return _T("Not enough operators!");
+	else if (isNumber.back())
+		return _T("Expression evaluates to a number!");
 
-	return "";
+	return wxEmptyString;
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		PopStackToQueue
+// Function:		CompileFunction
 //
-// Description:		Removes the top entry of the stack and puts it in the queue.
+// Description:		Adds the specified function to the program.
 //
 // Input Arguments:
-//		stack	= std::stack<wxString>& to be popped
+//		function	= const wxString& describing the function to apply
+//		isNumber	= std::vector<bool>& indicating the type of each operand
+//					  on the stack
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		wxString containing a description of any errors, or wxEmptyString on success
 //
 //==========================================================================
-void ExpressionTree::PopStackToQueue(std::stack<wxString> &stack)
+wxString ExpressionTree::CompileFunction(const wxString &function, std::vector<bool> &isNumber)
 {
-	outputQueue.push(stack.top());
-	stack.pop();
+	if (isNumber.empty())
+		return _T("Attempting to apply function without argument!");
+
+	OpCode code;
+	if (!GetFunctionCode(function, code))
+		return _T("Function '") + function + _T("' is not supported.");
+	else if (isNumber.back() &&
+		(code == OpIntegral || code == OpDerivative || code == OpFFT))
+		return _T("Attempting to apply function to value (requires dataset).");
+
+	// TODO:  Handle multiple args here
+	program.push_back(Instruction(code));
+
+	return wxEmptyString;
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		EmptyStackToQueue
+// Function:		CompileOperator
 //
-// Description:		Empties the contents of the stack into the queue.
+// Description:		Adds the specified operator to the program.
 //
 // Input Arguments:
-//		stack	= std::stack<wxString>& to be emptied
+//		operation	= const wxString& describing the operator to apply
+//		isNumber	= std::vector<bool>& indicating the type of each operand
+//					  on the stack
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		bool, true for success, false otherwise (imbalance parentheses)
+//		wxString containing a description of any errors, or wxEmptyString on success
 //
 //==========================================================================
-bool ExpressionTree::EmptyStackToQueue(std::stack<wxString> &stack)
+wxString ExpressionTree::CompileOperator(const wxString &operation, std::vector<bool> &isNumber)
 {
-	while (!stack.empty())
+	const OpCode code(GetOperatorCode(operation));
+
+	// The only unary operator we recognize is minus (negation)
+	if (isNumber.size() < 2)
 	{
-		if (stack.top().Cmp(_T("(")) == 0)
-			return false;
-		PopStackToQueue(stack);
+		if (isNumber.empty() || code != OpSubtract)
+			return _T("Attempting to apply operator without two operands!");
+
+		program.push_back(Instruction(OpNegate));
+		return wxEmptyString;
 	}
 
-	return true;
+	const bool rightIsNumber(isNumber.back());
+	isNumber.pop_back();
+	const bool leftIsNumber(isNumber.back());
+
+	if (leftIsNumber && !rightIsNumber && !SetOperatorValid(operation, true))
+		return wxString::Format("The number %s dataset operation is invalid.", operation.c_str());
+	else if (!leftIsNumber && !rightIsNumber && !SetOperatorValid(operation, false))
+		return wxString::Format("The dataset %s dataset operation is invalid.", operation.c_str());
+
+	isNumber.back() = leftIsNumber && rightIsNumber;
+	program.push_back(Instruction(code));
+
+	return wxEmptyString;
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		NextIsNumber
+// Function:		CompileNumber
 //
-// Description:		Determines if the next portion of the expression is a number.
-//					Some cleverness is required to tell the difference between
-//					a minus sign and a negative sign (minus sign would return false).
+// Description:		Adds the specified number to the program.
 //
 // Input Arguments:
-//		s				= const wxString& containing the expression
-//		lastWasOperator	= const bool& indicating whether or not the last thing
-//						  on the stack is an operator
+//		number		= const wxString&
+//		isNumber	= std::vector<bool>& indicating the type of each operand
+//					  on the stack
 //
 // Output Arguments:
-//		stop	= unsigned int* (optional) indicating length of number
+//		None
 //
 // Return Value:
-//		bool, true if a number is next in the expression
+//		wxString containing a description of any errors, or wxEmptyString on success
 //
 //==========================================================================
-bool ExpressionTree::NextIsNumber(const wxString &s, unsigned int *stop, const bool &lastWasOperator)
+wxString ExpressionTree::CompileNumber(const wxString &number, std::vector<bool> &isNumber)
 {
-	if (s.Len() == 0)
-		return false;
-
-	bool foundDecimal = s[0] == '.';
-	if (foundDecimal ||
-		(int(s[0]) >= int('0') && int(s[0]) <= int('9')) ||
-		(s[0] == '-' && lastWasOperator && NextIsNumber(s.Mid(1), NULL, false)))
-	{
-		unsigned int i;
-		for (i = 1; i < s.Len(); i++)
-		{
-			if (s[i] == '.')
-			{
-				if (foundDecimal)
-					return false;
-				foundDecimal = true;
-			}
-			else if (int(s[i]) < int('0') || int(s[i]) > int('9'))
-				break;
-		}
+	double value;
+	if (!number.ToDouble(&value))
+		return _T("Could not convert ") + number + _T(" to a number.");
 
-		if (stop)
-			*stop = i;
-		return true;
-	}
+	isNumber.push_back(true);
+	program.push_back(Instruction(OpConstant, value));
 
-	return false;
+	return wxEmptyString;
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		NextIsS
+// Function:		CompileDataset
 //
-// Description:		Determines if the next portion of the expression is
-//					complex frequency (s) or discrete time (z).
+// Description:		Adds the specified dataset to the program.
 //
 // Input Arguments:
-//		s		= const wxString& containing the expression
+//		dataset		= const wxString&
+//		isNumber	= std::vector<bool>& indicating the type of each operand
+//					  on the stack
 //
 // Output Arguments:
-//		stop	= unsigned int* (optional) indicating length
+//		None
 //
 // Return Value:
-//		bool, true if a dataset is next in the expression
+//		wxString containing a description of any errors, or wxEmptyString on success
 //
 //==========================================================================
-bool ExpressionTree::NextIsS(const wxString &s, unsigned int *stop)
+wxString ExpressionTree::CompileDataset(const wxString &dataset, std::vector<bool> &isNumber)
 {
-	if (s[0] == 's' || s[0] == 'z')
-	{
-		if (s.length() > 1 &&
-			((s[1] >= 'a' && s[1] <= 'z') ||
-			((s[1] >= 'A' && s[1] <= 'Z'))))
-			return false;
-		
-		if (stop)
-			*stop = 1;
-		return true;
-	}
+	if (!list || (*list).GetCount() == 0)
+		return _T("No datasets available!");
 
-	return false;
+	bool unaryMinus = dataset[0] == '-';
+
+	unsigned long set;
+	if (!dataset.Mid(1 + (int)unaryMinus, dataset.Len() - 2 - (int)unaryMinus).ToULong(&set))
+		return _T("Could not convert '") + dataset + _T("' to set ID.");
+	else if (set > (unsigned int)(*list).GetCount())
+		return wxString::Format("Set ID %lu is not a valid set ID.", set);
+
+	isNumber.push_back(false);
+	program.push_back(Instruction(OpDataset, 0.0, set));
+	if (unaryMinus)
+		program.push_back(Instruction(OpNegate));
+
+	return wxEmptyString;
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		NextIsDataset
+// Function:		GetFunctionCode
 //
-// Description:		Determines if the next portion of the expression is a dataset.
+// Description:		Returns the instruction code for the specified function.
 //
 // Input Arguments:
-//		s				= const wxString& containing the expression
-//		lastWasOperator	= const bool& indicating whether or not the last
-//						  item pushed to the stack was an operator or not
+//		function	= const wxString&
 //
 // Output Arguments:
-//		stop	= unsigned int* (optional) indicating length of dataset ID
+//		code		= OpCode&
 //
 // Return Value:
-//		bool, true if a dataset is next in the expression
+//		bool, true if the function is supported
 //
 //==========================================================================
-bool ExpressionTree::NextIsDataset(const wxString &s, unsigned int *stop, const bool &lastWasOperator)
+bool ExpressionTree::GetFunctionCode(const wxString &function, OpCode &code)
 {
-	if (s.Len() < 3)
+	if (function.CmpNoCase(_T("int")) == 0)
+		code = OpIntegral;
+	else if (function.CmpNoCase(_T("ddx")) == 0)
+		code = OpDerivative;
+	else if (function.CmpNoCase(_T("fft")) == 0)
+		code = OpFFT;
+	else if (function.CmpNoCase(_T("log")) == 0)
+		code = OpLog;
+	else if (function.CmpNoCase(_T("log10")) == 0)
+		code = OpLog10;
+	else if (function.CmpNoCase(_T("exp")) == 0)
+		code = OpExp;
+	else if (function.CmpNoCase(_T("abs")) == 0)
+		code = OpAbs;
+	else if (function.CmpNoCase(_T("sin")) == 0)
+		code = OpSin;
+	else if (function.CmpNoCase(_T("cos")) == 0)
+		code = OpCos;
+	else if (function.CmpNoCase(_T("tan")) == 0)
+		code = OpTan;
+	else if (function.CmpNoCase(_T("asin")) == 0)
+		code = OpArcSin;
+	else if (function.CmpNoCase(_T("acos")) == 0)
+		code = OpArcCos;
+	else if (function.CmpNoCase(_T("atan")) == 0)
+		code = OpArcTan;
+	/*else if (function.CmpNoCase(_T("bit")) == 0)
+		return VVASEMath::ApplyBitMask(set, bit);
+	else if (function.CmpNoCase(_T("frf")) == 0)
+		return FastFourierTransform::ComputeTransferFunction(set1, set2);*/
+	else
 		return false;
 
-	if (s[0] == '[' ||
-		(s[0] == '-' && lastWasOperator && NextIsDataset(s.Mid(1), NULL, false)))
-	{
-		unsigned int close = s.Find(']');
-		if (close == (unsigned int)wxNOT_FOUND)
-			return false;
-
-		unsigned int i;
-		for (i = 1 + (unsigned int)lastWasOperator; i < close; i++)
-		{
-			if (int(s[i]) < '0' || int(s[i]) > '9')
-				return false;
-		}
+	return true;
+}
 
-		if (stop)
-			*stop = close + 1;
-		return true;
-	}
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		GetOperatorCode
+//
+// Description:		Returns the instruction code for the specified (binary)
+//					operator.
+//
+// Input Arguments:
+//		operation	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		OpCode
+//
+//==========================================================================
+ExpressionTree::OpCode ExpressionTree::GetOperatorCode(const wxString &operation)
+{
+	if (operation.Cmp(_T("+")) == 0)
+		return OpAdd;
+	else if (operation.Cmp(_T("-")) == 0)
+		return OpSubtract;
+	else if (operation.Cmp(_T("*")) == 0)
+		return OpMultiply;
+	else if (operation.Cmp(_T("/")) == 0)
+		return OpDivide;
+	else if (operation.Cmp(_T("%")) == 0)
+		return OpModulo;
 
-	return false;
+	assert(operation.Cmp(_T("^")) == 0);
+	return OpPower;
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		NextIsFunction
+// Function:		IsBinaryOperation
 //
-// Description:		Determines if the next portion of the expression is a function.
+// Description:		Checks to see if the specified instruction takes two
+//					operands.
 //
 // Input Arguments:
-//		s		= const wxString& containing the expression
+//		code	= const OpCode&
 //
 // Output Arguments:
-//		stop	= unsigned int* (optional) indicating length of function
+//		None
 //
 // Return Value:
-//		bool, true if a function is next in the expression
+//		bool
 //
 //==========================================================================
-bool ExpressionTree::NextIsFunction(const wxString &s, unsigned int *stop)
+bool ExpressionTree::IsBinaryOperation(const OpCode &code)
+{
+	return code >= OpAdd && code <= OpPower;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		MakeSetTerm
+//
+// Description:		Creates an operand which reads the specified set from the
+//					list.  Handles i=0 where 0 indicates time series instead
+//					of data.
+//
+// Input Arguments:
+//		i	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Term
+//
+//==========================================================================
+ExpressionTree::Term ExpressionTree::MakeSetTerm(const unsigned int &i) const
+{
+	assert(list);
+
+	// If user is requesting time, we use the x values in place of the y values
+	if (i == 0)
+	{
+		Term term;
+		term.timebase = (*list)[0];
+		term.code.push_back(Instruction(OpDataset));
+		term.sources.push_back(term.timebase->GetXPointer());
+		term.depth = 1;
+		return term;
+	}
+
+	return MakeSetTerm(*(*list)[i - 1]);
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		MakeSetTerm
+//
+// Description:		Creates an operand which reads the specified dataset.
+//
+// Input Arguments:
+//		set	= const Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Term
+//
+//==========================================================================
+ExpressionTree::Term ExpressionTree::MakeSetTerm(const Dataset2D &set)
+{
+	Term term;
+	term.timebase = &set;
+	term.set = &set;
+	term.code.push_back(Instruction(OpDataset));
+	term.sources.push_back(set.GetYPointer());
+	term.depth = 1;
+	return term;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		ApplyFunction
+//
+// Description:		Applies the specified function (or negation) to the
+//					operand.  Element-wise functions of datasets are appended
+//					to the operand's kernel; the others require the dataset
+//					to be evaluated first.
+//
+// Input Arguments:
+//		code		= const OpCode&
+//		term		= Term&
+//		temporaries	= std::list<Dataset2D>& storage for evaluated datasets
+//
+// Output Arguments:
+//		term		= Term&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ExpressionTree::ApplyFunction(const OpCode &code, Term &term,
+	std::list<Dataset2D> &temporaries) const
+{
+	if (!term.timebase)
+	{
+		ComputeBlock(code, &term.value, NULL, 1);
+		return;
+	}
+
+	if (code == OpIntegral)
+		temporaries.push_back(DiscreteIntegral::ComputeTimeHistory(Evaluate(term, temporaries)));
+	else if (code == OpDerivative)
+		temporaries.push_back(DiscreteDerivative::ComputeTimeHistory(Evaluate(term, temporaries)));
+	else if (code == OpFFT)
+	{
+		temporaries.push_back(FastFourierTransform::ComputeFFT(Evaluate(term, temporaries)));
+		temporaries.back().MultiplyXData(xAxisFactor);
+	}
+	else
+	{
+		term.code.push_back(Instruction(code));
+		term.set = NULL;
+		return;
+	}
+
+	term = MakeSetTerm(temporaries.back());
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		ApplyOperation
+//
+// Description:		Applies the specified operation to the operands.  If the
+//					operands are datasets with different x-values, they are
+//					evaluated and combined only where they overlap.  Otherwise,
+//					the operation is appended to the kernel.
+//
+// Input Arguments:
+//		code		= const OpCode&
+//		left		= Term&
+//		right		= const Term&
+//		temporaries	= std::list<Dataset2D>& storage for evaluated datasets
+//
+// Output Arguments:
+//		left		= Term& containing the result
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ExpressionTree::ApplyOperation(const OpCode &code, Term &left, const Term &right,
+	std::list<Dataset2D> &temporaries) const
+{
+	if (!left.timebase && !right.timebase)
+	{
+		ComputeBlock(code, &left.value, &right.value, 1);
+		return;
+	}
+	else if (left.timebase && right.timebase && !SameTimebase(*left.timebase, *right.timebase))
+	{
+		const Dataset2D &leftSet(Evaluate(left, temporaries));
+		const Dataset2D &rightSet(Evaluate(right, temporaries));
+
+		if (code == OpAdd)
+			temporaries.push_back(Dataset2D::DoUnsyncrhonizedAdd(leftSet, rightSet));
+		else if (code == OpSubtract)
+			temporaries.push_back(Dataset2D::DoUnsyncrhonizedSubtract(leftSet, rightSet));
+		else if (code == OpMultiply)
+			temporaries.push_back(Dataset2D::DoUnsyncrhonizedMultiply(leftSet, rightSet));
+		else if (code == OpDivide)
+			temporaries.push_back(Dataset2D::DoUnsyncrhonizedDivide(leftSet, rightSet));
+		else
+		{
+			assert(code == OpPower);
+			temporaries.push_back(Dataset2D::DoUnsyncrhonizedExponentiation(leftSet, rightSet));
+		}
+
+		left = MakeSetTerm(temporaries.back());
+		return;
+	}
+
+	if (!left.timebase)
+	{
+		left.timebase = right.timebase;
+		left.code.push_back(Instruction(OpConstant, left.value));
+		left.depth = 1;
+	}
+
+	if (!right.timebase)
+	{
+		left.code.push_back(Instruction(OpConstant, right.value));
+		left.depth = std::max(left.depth, 2u);
+	}
+	else
+	{
+		const unsigned int offset(left.sources.size());
+		unsigned int i;
+		for (i = 0; i < right.code.size(); i++)
+		{
+			left.code.push_back(right.code[i]);
+			if (right.code[i].code == OpDataset)
+				left.code.back().index += offset;
+		}
+
+		left.sources.insert(left.sources.end(), right.sources.begin(), right.sources.end());
+		left.depth = std::max(left.depth, right.depth + 1);
+	}
+
+	left.code.push_back(Instruction(code));
+	left.set = NULL;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		SameTimebase
+//
+// Description:		Checks to see if the datasets have identical x-values.
+//
+// Input Arguments:
+//		a	= const Dataset2D&
+//		b	= const Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool ExpressionTree::SameTimebase(const Dataset2D &a, const Dataset2D &b)
+{
+	if (&a == &b)
+		return true;
+	else if (a.GetNumberOfPoints() != b.GetNumberOfPoints())
+		return false;
+
+	return std::equal(a.GetXPointer(), a.GetXPointer() + a.GetNumberOfPoints(), b.GetXPointer());
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		Evaluate
+//
+// Description:		Returns the dataset represented by the operand.  If the
+//					operand is not simply a dataset from the list, its kernel
+//					is executed into a new temporary dataset.
+//
+// Input Arguments:
+//		term		= const Term&
+//		temporaries	= std::list<Dataset2D>& storage for evaluated datasets
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const Dataset2D&
+//
+//==========================================================================
+const Dataset2D& ExpressionTree::Evaluate(const Term &term, std::list<Dataset2D> &temporaries) const
+{
+	assert(term.timebase);
+	if (term.set)
+		return *term.set;
+
+	temporaries.push_back(Dataset2D(term.timebase->GetNumberOfPoints()));
+	Dataset2D &set(temporaries.back());
+	std::copy(term.timebase->GetXPointer(), term.timebase->GetXPointer()
+		+ set.GetNumberOfPoints(), set.GetXPointer());
+	ExecuteKernel(term, set.GetYPointer());
+
+	return set;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		ExecuteKernel
+//
+// Description:		Executes the operand's kernel.  The data is processed in
+//					blocks small enough to remain in cache, with each
+//					instruction applied to a whole block at a time, so the
+//					data is only read and written once regardless of the
+//					number of operations.
+//
+// Input Arguments:
+//		term	= const Term&
+//
+// Output Arguments:
+//		y		= double* to which the results are written (must have the
+//				  same length as the operand's timebase)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ExpressionTree::ExecuteKernel(const Term &term, double *y) const
+{
+	const unsigned int count(term.timebase->GetNumberOfPoints());
+	std::vector<double> blocks(term.depth * blockSize);
+
+	double *top;// One block past the top of the stack
+	unsigned int start, size, i;
+	for (start = 0; start < count; start += blockSize)
+	{
+		size = std::min(blockSize, count - start);
+		top = blocks.data();
+		for (i = 0; i < term.code.size(); i++)
+		{
+			if (term.code[i].code == OpConstant)
+			{
+				std::fill(top, top + size, term.code[i].value);
+				top += blockSize;
+			}
+			else if (term.code[i].code == OpDataset)
+			{
+				std::copy(term.sources[term.code[i].index] + start,
+					term.sources[term.code[i].index] + start + size, top);
+				top += blockSize;
+			}
+			else if (IsBinaryOperation(term.code[i].code))
+			{
+				top -= blockSize;
+				ComputeBlock(term.code[i].code, top - blockSize, top, size);
+			}
+			else
+				ComputeBlock(term.code[i].code, top - blockSize, NULL, size);
+		}
+
+		std::copy(blocks.data(), blocks.data() + size, y + start);
+	}
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		ComputeBlock
+//
+// Description:		Applies the specified element-wise instruction.  Numbers
+//					are handled as blocks with a size of one.
+//
+// Input Arguments:
+//		code	= const OpCode&
+//		left	= double* operand (or left operand for binary operations)
+//		right	= const double* right operand (ignored for unary operations)
+//		size	= const unsigned int&
+//
+// Output Arguments:
+//		left	= double* containing the result
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ExpressionTree::ComputeBlock(const OpCode &code, double *left,
+	const double *right, const unsigned int &size)
+{
+	unsigned int i;
+	switch (code)
+	{
+	case OpNegate:
+		for (i = 0; i < size; i++)
+			left[i] = -left[i];
+		break;
+
+	case OpAdd:
+		for (i = 0; i < size; i++)
+			left[i] += right[i];
+		break;
+
+	case OpSubtract:
+		for (i = 0; i < size; i++)
+			left[i] -= right[i];
+		break;
+
+	case OpMultiply:
+		for (i = 0; i < size; i++)
+			left[i] *= right[i];
+		break;
+
+	case OpDivide:
+		for (i = 0; i < size; i++)
+			left[i] /= right[i];
+		break;
+
+	case OpModulo:
+		for (i = 0; i < size; i++)
+			left[i] = fmod(left[i], right[i]);
+		break;
+
+	case OpPower:
+		for (i = 0; i < size; i++)
+			left[i] = pow(left[i], right[i]);
+		break;
+
+	case OpLog:
+		for (i = 0; i < size; i++)
+			left[i] = log(left[i]);
+		break;
+
+	case OpLog10:
+		for (i = 0; i < size; i++)
+			left[i] = log10(left[i]);
+		break;
+
+	case OpExp:
+		for (i = 0; i < size; i++)
+			left[i] = exp(left[i]);
+		break;
+
+	case OpAbs:
+		for (i = 0; i < size; i++)
+			left[i] = fabs(left[i]);
+		break;
+
+	case OpSin:
+		for (i = 0; i < size; i++)
+			left[i] = sin(left[i]);
+		break;
+
+	case OpCos:
+		for (i = 0; i < size; i++)
+			left[i] = cos(left[i]);
+		break;
+
+	case OpTan:
+		for (i = 0; i < size; i++)
+			left[i] = tan(left[i]);
+		break;
+
+	case OpArcSin:
+		for (i = 0; i < size; i++)
+			left[i] = asin(left[i]);
+		break;
+
+	case OpArcCos:
+		for (i = 0; i < size; i++)
+			left[i] = acos(left[i]);
+		break;
+
+	case OpArcTan:
+		for (i = 0; i < size; i++)
+			left[i] = atan(left[i]);
+		break;
+
+	default:
+		assert(false);
+		break;
+	}
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		EvaluateExpression
+//
+// Description:		Evaluates the expression in the queue using Reverse Polish
+//					Notation.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		results	= std::string&
+//
+// Return Value:
+//		std::string containing a description of any errors, or empty string on success
+//
+//==========================================================================
+std::string ExpressionTree::EvaluateExpression(std::string &results)
+{
+	wxString next, errorString;
+
+	std::stack<double> doubleStack;
+	std::stack<wxString> stringStack;
+	std::stack<bool> useDoubleStack;
+
+	while (!outputQueue.empty())
+	{
+		next = outputQueue.front();
+		outputQueue.pop();
+
+		if (!EvaluateNext(next, doubleStack, stringStack, useDoubleStack, errorString))
+			return std::string(errorString.mb_str());
+	}
+
+	if (useDoubleStack.size() > 1)
+		return "Not enough operators!";
+
+	if (useDoubleStack.top())
+		results = wxString::Format("%0.*f",
+			VVASEMath::GetPrecision(doubleStack.top(), printfPrecision),
+			doubleStack.top()).mb_str();
+	else
+		results = stringStack.top();
+
+	return "";
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		PopStackToQueue
+//
+// Description:		Removes the top entry of the stack and puts it in the queue.
+//
+// Input Arguments:
+//		stack	= std::stack<wxString>& to be popped
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ExpressionTree::PopStackToQueue(std::stack<wxString> &stack)
+{
+	outputQueue.push(stack.top());
+	stack.pop();
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		EmptyStackToQueue
+//
+// Description:		Empties the contents of the stack into the queue.
+//
+// Input Arguments:
+//		stack	= std::stack<wxString>& to be emptied
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise (imbalance parentheses)
+//
+//==========================================================================
+bool ExpressionTree::EmptyStackToQueue(std::stack<wxString> &stack)
+{
+	while (!stack.empty())
+	{
+		if (stack.top().Cmp(_T("(")) == 0)
+			return false;
+		PopStackToQueue(stack);
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		NextIsNumber
+//
+// Description:		Determines if the next portion of the expression is a number.
+//					Some cleverness is required to tell the difference between
+//					a minus sign and a negative sign (minus sign would return false).
+//
+// Input Arguments:
+//		s				= const wxString& containing the expression
+//		lastWasOperator	= const bool& indicating whether or not the last thing
+//						  on the stack is an operator
+//
+// Output Arguments:
+//		stop	= unsigned int* (optional) indicating length of number
+//
+// Return Value:
+//		bool, true if a number is next in the expression
+//
+//==========================================================================
+bool ExpressionTree::NextIsNumber(const wxString &s, unsigned int *stop, const bool &lastWasOperator)
+{
+	if (s.Len() == 0)
+		return false;
+
+	bool foundDecimal = s[0] == '.';
+	if (foundDecimal ||
+		(int(s[0]) >= int('0') && int(s[0]) <= int('9')) ||
+		(s[0] == '-' && lastWasOperator && NextIsNumber(s.Mid(1), NULL, false)))
+	{
+		unsigned int i;
+		for (i = 1; i < s.Len(); i++)
+		{
+			if (s[i] == '.')
+			{
+				if (foundDecimal)
+					return false;
+				foundDecimal = true;
+			}
+			else if (int(s[i]) < int('0') || int(s[i]) > int('9'))
+				break;
+		}
+
+		if (stop)
+			*stop = i;
+		return true;
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		NextIsS
+//
+// Description:		Determines if the next portion of the expression is
+//					complex frequency (s) or discrete time (z).
+//
+// Input Arguments:
+//		s		= const wxString& containing the expression
+//
+// Output Arguments:
+//		stop	= unsigned int* (optional) indicating length
+//
+// Return Value:
+//		bool, true if a dataset is next in the expression
+//
+//==========================================================================
+bool ExpressionTree::NextIsS(const wxString &s, unsigned int *stop)
+{
+	if (s[0] == 's' || s[0] == 'z')
+	{
+		if (s.length() > 1 &&
+			((s[1] >= 'a' && s[1] <= 'z') ||
+			((s[1] >= 'A' && s[1] <= 'Z'))))
+			return false;
+		
+		if (stop)
+			*stop = 1;
+		return true;
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		NextIsDataset
+//
+// Description:		Determines if the next portion of the expression is a dataset.
+//
+// Input Arguments:
+//		s				= const wxString& containing the expression
+//		lastWasOperator	= const bool& indicating whether or not the last
+//						  item pushed to the stack was an operator or not
+//
+// Output Arguments:
+//		stop	= unsigned int* (optional) indicating length of dataset ID
+//
+// Return Value:
+//		bool, true if a dataset is next in the expression
+//
+//==========================================================================
+bool ExpressionTree::NextIsDataset(const wxString &s, unsigned int *stop, const bool &lastWasOperator)
+{
+	if (s.Len() < 3)
+		return false;
+
+	if (s[0] == '[' ||
+		(s[0] == '-' && lastWasOperator && NextIsDataset(s.Mid(1), NULL, false)))
+	{
+		unsigned int close = s.Find(']');
+		if (close == (unsigned int)wxNOT_FOUND)
+			return false;
+
+		unsigned int i;
+		for (i = 1 + (unsigned int)lastWasOperator; i < close; i++)
+		{
+			if (int(s[i]) < '0' || int(s[i]) > '9')
+				return false;
+		}
+
+		if (stop)
+			*stop = close + 1;
+		return true;
+	}
+
+	return false;
+}
+
+//==========================================================================
+// Class:			ExpressionTree
+// Function:		NextIsFunction
+//
+// Description:		Determines if the next portion of the expression is a function.
+//
+// Input Arguments:
+//		s		= const wxString& containing the expression
+//
+// Output Arguments:
+//		stop	= unsigned int* (optional) indicating length of function
+//
+// Return Value:
+//		bool, true if a function is next in the expression
+//
+//==========================================================================
+bool ExpressionTree::NextIsFunction(const wxString &s, unsigned int *stop)
 {
 	// List these in order of longest to shortest
 	if (BeginningMatchesNoCase(s, _T("log10"), stop))
@@ -858,383 +1592,77 @@ bool ExpressionTree::IsLeftAssociative(const wxChar &c) const
 //		None
 //
 //==========================================================================
-void ExpressionTree::PushToStack(const double &value, std::stack<double> &doubleStack,
-	std::stack<bool> &useDoubleStack) const
-{
-	doubleStack.push(value);
-	useDoubleStack.push(true);
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		PushToStack
-//
-// Description:		Pushes the specified dataset onto the stack.
-//
-// Input Arguments:
-//		dataset			= const Dataset2D&
-//		setStack		= std::stack<Dataset2D>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//==========================================================================
-void ExpressionTree::PushToStack(const Dataset2D &dataset, std::stack<Dataset2D> &setStack,
-	std::stack<bool> &useDoubleStack) const
-{
-	setStack.push(dataset);
-	useDoubleStack.push(false);
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		PushToStack
-//
-// Description:		Pushes the specified dataset onto the stack.
-//
-// Input Arguments:
-//		s				= const wxString&
-//		stringStack		= std::stack<wxString>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//==========================================================================
-void ExpressionTree::PushToStack(const wxString &s, std::stack<wxString> &stringStack,
-	std::stack<bool> &useDoubleStack) const
-{
-	stringStack.push(s);
-	useDoubleStack.push(false);
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		PopFromStack
-//
-// Description:		Pops the next value from the top of the appropriate stack.
-//
-// Input Arguments:
-//		doubleStack		= std::stack<double>&
-//		setStack		= std::stack<Dataset2D>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		value			= double&
-//		dataset			= Dataset2D&
-//
-// Return Value:
-//		bool, true if a double was popped, false if a dataset was popped
-//
-//==========================================================================
-bool ExpressionTree::PopFromStack(std::stack<double> &doubleStack, std::stack<Dataset2D> &setStack,
-	std::stack<bool> &useDoubleStack, double &value, Dataset2D &dataset) const
-{
-	assert(!useDoubleStack.empty());
-
-	bool useDouble = useDoubleStack.top();
-	useDoubleStack.pop();
-
-	if (useDouble)
-	{
-		assert(!doubleStack.empty());
-		value = doubleStack.top();
-		doubleStack.pop();
-	}
-	else
-	{
-		assert(!setStack.empty());
-		dataset = setStack.top();
-		setStack.pop();
-	}
-
-	return useDouble;
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		PopFromStack
-//
-// Description:		Pops the next value from the top of the appropriate stack.
-//
-// Input Arguments:
-//		doubleStack		= std::stack<double>&
-//		stringStack		= std::stack<wxString>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		string			= wxString&
-//		value			= double&
-//
-// Return Value:
-//		bool, true if a double was popped, false otherwise
-//
-//==========================================================================
-bool ExpressionTree::PopFromStack(std::stack<double> &doubleStack, std::stack<wxString> &stringStack,
-	std::stack<bool> &useDoubleStack, wxString& string, double &value) const
-{
-	bool useDouble = useDoubleStack.top();
-	useDoubleStack.pop();
-
-	if (useDouble)
-	{
-		assert(!doubleStack.empty());
-		value = doubleStack.top();
-		doubleStack.pop();
-	}
-	else
-	{
-		assert(!stringStack.empty());
-		string = stringStack.top();
-		stringStack.pop();
-	}
-
-	return useDouble;
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		ApplyFunction
-//
-// Description:		Applies the specified function to the specified dataset.
-//
-// Input Arguments:
-//		function	= const wxString& describing the function to apply
-//		set			= const Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		Dataset2D containing the result of the function
-//
-//==========================================================================
-Dataset2D ExpressionTree::ApplyFunction(const wxString &function,
-	const Dataset2D &set) const
-{
-	if (function.CmpNoCase(_T("int")) == 0)
-		return DiscreteIntegral::ComputeTimeHistory(set);
-	else if (function.CmpNoCase(_T("ddx")) == 0)
-		return DiscreteDerivative::ComputeTimeHistory(set);
-	else if (function.CmpNoCase(_T("fft")) == 0)
-		return FastFourierTransform::ComputeFFT(set).MultiplyXData(xAxisFactor);
-	else if (function.CmpNoCase(_T("log")) == 0)
-		return set.DoLog();
-	else if (function.CmpNoCase(_T("log10")) == 0)
-		return set.DoLog10();
-	else if (function.CmpNoCase(_T("exp")) == 0)
-		return set.DoExp();
-	else if (function.CmpNoCase(_T("abs")) == 0)
-		return set.DoAbs();
-	else if (function.CmpNoCase(_T("sin")) == 0)
-		return set.DoSin();
-	else if (function.CmpNoCase(_T("cos")) == 0)
-		return set.DoCos();
-	else if (function.CmpNoCase(_T("tan")) == 0)
-		return set.DoTan();
-	else if (function.CmpNoCase(_T("asin")) == 0)
-		return set.DoArcSin();
-	else if (function.CmpNoCase(_T("acos")) == 0)
-		return set.DoArcCos();
-	else if (function.CmpNoCase(_T("atan")) == 0)
-		return set.DoArcTan();
-	/*else if (function.CmpNoCase(_T("bit")) == 0)
-		return VVASEMath::ApplyBitMask(set, bit);
-	else if (function.CmpNoCase(_T("frf")) == 0)
-		return FastFourierTransform::ComputeTransferFunction(set1, set2);*/
-
-	assert(false);
-	return set;
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		ApplyFunction
-//
-// Description:		Applies the specified function to the specified dataset.
-//
-// Input Arguments:
-//		function	= const wxString& describing the function to apply
-//		value		= const double&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		double
-//
-//==========================================================================
-double ExpressionTree::ApplyFunction(const wxString &function, const double &value) const
-{
-	if (function.CmpNoCase(_T("log")) == 0)
-		return log(value);
-	else if (function.CmpNoCase(_T("log10")) == 0)
-		return log10(value);
-	else if (function.CmpNoCase(_T("exp")) == 0)
-		return exp(value);
-	else if (function.CmpNoCase(_T("abs")) == 0)
-		return fabs(value);
-	else if (function.CmpNoCase(_T("sin")) == 0)
-		return sin(value);
-	else if (function.CmpNoCase(_T("cos")) == 0)
-		return cos(value);
-	else if (function.CmpNoCase(_T("tan")) == 0)
-		return tan(value);
-	else if (function.CmpNoCase(_T("asin")) == 0)
-		return asin(value);
-	else if (function.CmpNoCase(_T("acos")) == 0)
-		return acos(value);
-	else if (function.CmpNoCase(_T("atan")) == 0)
-		return atan(value);
-	/*else if (function.CmpNoCase(_T("bit")) == 0)
-		return VVASEMath::ApplyBitMask(value, bit);*/
-
-	assert(false);
-	return 0.0;
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		FunctionRequiresDataset
-//
-// Description:		Determines if the specified function requires a dataset to
-//					operate on, or if it can also operate on values.
-//
-// Input Arguments:
-//		function	= const wxString& describing the function to apply
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		bool
-//
-//==========================================================================
-bool ExpressionTree::FunctionRequiresDataset(const wxString &function) const
-{
-	if (function.CmpNoCase(_T("int")) == 0 ||
-		function.CmpNoCase(_T("ddx")) == 0 ||
-		function.CmpNoCase(_T("fft")) == 0 ||
-		function.CmpNoCase(_T("frf")) == 0)
-		return true;
-
-	return false;
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		ApplyOperation
-//
-// Description:		Applies the specified operation to the specified operands.
-//
-// Input Arguments:
-//		operation	= const wxString& describing the function to apply
-//		first		= const Dataset2D&
-//		second		= const Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		Dataset2D containing the result of the operation
-//
-//==========================================================================
-Dataset2D ExpressionTree::ApplyOperation(const wxString &operation,
-	const Dataset2D &first, const Dataset2D &second) const
+void ExpressionTree::PushToStack(const double &value, std::stack<double> &doubleStack,
+	std::stack<bool> &useDoubleStack) const
 {
-	if (operation.Cmp(_T("+")) == 0)
-		return Dataset2D::DoUnsyncrhonizedAdd(second, first);
-	else if (operation.Cmp(_T("-")) == 0)
-		return Dataset2D::DoUnsyncrhonizedSubtract(second, first);
-	else if (operation.Cmp(_T("*")) == 0)
-		return Dataset2D::DoUnsyncrhonizedMultiply(second, first);
-	else if (operation.Cmp(_T("/")) == 0)
-		return Dataset2D::DoUnsyncrhonizedDivide(second, first);
-	else if (operation.Cmp(_T("^")) == 0)
-		return Dataset2D::DoUnsyncrhonizedExponentiation(second, first);
-
-	assert(false);
-	return first;
+	doubleStack.push(value);
+	useDoubleStack.push(true);
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		ApplyOperation
+// Function:		PushToStack
 //
-// Description:		Applies the specified operation to the specified operands.
+// Description:		Pushes the specified dataset onto the stack.
 //
 // Input Arguments:
-//		operation	= const wxString& describing the function to apply
-//		first		= const Dataset2D&
-//		second		= const double&
+//		s				= const wxString&
+//		stringStack		= std::stack<wxString>&
+//		useDoubleStack	= std::stack<bool>&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		Dataset2D containing the result of the operation
+//		None
 //
 //==========================================================================
-Dataset2D ExpressionTree::ApplyOperation(const wxString &operation,
-	const Dataset2D &first, const double &second) const
+void ExpressionTree::PushToStack(const wxString &s, std::stack<wxString> &stringStack,
+	std::stack<bool> &useDoubleStack) const
 {
-	// These operations have some orders reversed in order to avoid undefined operations for doubles
-	if (operation.Cmp(_T("+")) == 0)
-		return first + second;
-	else if (operation.Cmp(_T("-")) == 0)
-		return first * -1.0 + second;
-	else if (operation.Cmp(_T("*")) == 0)
-		return first * second;
-	else if (operation.Cmp(_T("^")) == 0)
-		return first.ApplyPower(second);
-
-	assert(false);
-	return 0.0;
+	stringStack.push(s);
+	useDoubleStack.push(false);
 }
 
 //==========================================================================
 // Class:			ExpressionTree
-// Function:		ApplyOperation
+// Function:		PopFromStack
 //
-// Description:		Applies the specified operation to the specified operands.
+// Description:		Pops the next value from the top of the appropriate stack.
 //
 // Input Arguments:
-//		operation	= const wxString& describing the function to apply
-//		first		= const double&
-//		second		= const Dataset2D&
+//		doubleStack		= std::stack<double>&
+//		stringStack		= std::stack<wxString>&
+//		useDoubleStack	= std::stack<bool>&
 //
 // Output Arguments:
-//		None
+//		string			= wxString&
+//		value			= double&
 //
 // Return Value:
-//		Dataset2D containing the result of the operation
+//		bool, true if a double was popped, false otherwise
 //
 //==========================================================================
-Dataset2D ExpressionTree::ApplyOperation(const wxString &operation,
-	const double &first, const Dataset2D &second) const
+bool ExpressionTree::PopFromStack(std::stack<double> &doubleStack, std::stack<wxString> &stringStack,
+	std::stack<bool> &useDoubleStack, wxString& string, double &value) const
 {
-	if (operation.Cmp(_T("+")) == 0)
-		return second + first;
-	else if (operation.Cmp(_T("-")) == 0)
-		return second - first;
-	else if (operation.Cmp(_T("*")) == 0)
-		return second * first;
-	else if (operation.Cmp(_T("/")) == 0)
-		return second / first;
-	else if (operation.Cmp(_T("%")) == 0)
-		return second % first;
-	else if (operation.Cmp(_T("^")) == 0)
-		return second.ToPower(first);
+	bool useDouble = useDoubleStack.top();
+	useDoubleStack.pop();
 
-	assert(false);
-	return 0.0;
+	if (useDouble)
+	{
+		assert(!doubleStack.empty());
+		value = doubleStack.top();
+		doubleStack.pop();
+	}
+	else
+	{
+		assert(!stringStack.empty());
+		string = stringStack.top();
+		stringStack.pop();
+	}
+
+	return useDouble;
 }
 
 //==========================================================================
@@ -1376,149 +1804,6 @@ wxString ExpressionTree::ApplyOperation(const wxString &operation,
 	return "";
 }
 
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		EvaluateFunction
-//
-// Description:		Evaluates the function specified.
-//
-// Input Arguments:
-//		function		= const wxString& describing the function to apply
-//		doubleStack		= std::stack<double>&
-//		setStack		= std::stack<Dataset2D>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		errorString		= wxString&
-//
-// Return Value:
-//		bool, true for success, false otherwise
-//
-//==========================================================================
-bool ExpressionTree::EvaluateFunction(const wxString &function, std::stack<double> &doubleStack,
-	std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const
-{
-	double value;
-	Dataset2D dataset;
-
-	if (useDoubleStack.empty())
-	{
-		errorString = _T("Attempting to apply function without argument!");
-		return false;
-	}
-	else if (PopFromStack(doubleStack, setStack, useDoubleStack, value, dataset))
-	{
-		if (FunctionRequiresDataset(function))
-		{
-			errorString = _T("Attempting to apply function to value (requires dataset).");
-			return false;
-		}
-
-		// TODO:  Handle multiple args here
-		PushToStack(ApplyFunction(function, value), doubleStack, useDoubleStack);
-		return true;
-	}
-
-	// TODO:  Handle multiple args here
-	PushToStack(ApplyFunction(function, dataset), setStack, useDoubleStack);
-
-	return true;
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		EvaluateOperator
-//
-// Description:		Evaluates the operator specified.
-//
-// Input Arguments:
-//		operator		= const wxString& describing the function to apply
-//		doubleStack		= std::stack<double>&
-//		setStack		= std::stack<Dataset2D>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		errorString		= wxString&
-//
-// Return Value:
-//		bool, true for success, false otherwise
-//
-//==========================================================================
-bool ExpressionTree::EvaluateOperator(const wxString &operation, std::stack<double> &doubleStack,
-	std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const
-{
-	double value1, value2;
-	Dataset2D dataset1, dataset2;
-
-	if (useDoubleStack.size() < 2)
-		return EvaluateUnaryOperator(operation, doubleStack, setStack, useDoubleStack, errorString);
-	else if (PopFromStack(doubleStack, setStack, useDoubleStack, value1, dataset1))
-	{
-		if (PopFromStack(doubleStack, setStack, useDoubleStack, value2, dataset2))
-			PushToStack(ApplyOperation(operation, value1, value2), doubleStack, useDoubleStack);
-		else
-			PushToStack(ApplyOperation(operation, value1, dataset2), setStack, useDoubleStack);
-	}
-	else if (PopFromStack(doubleStack, setStack, useDoubleStack, value2, dataset2))
-	{
-		if (!SetOperatorValid(operation, true))
-		{
-			errorString = wxString::Format("The number %s dataset operation is invalid.", operation.c_str());
-			return false;
-		}
-		PushToStack(ApplyOperation(operation, dataset1, value2), setStack, useDoubleStack);
-	}
-	else
-	{
-		if (!SetOperatorValid(operation, false))
-		{
-			errorString = wxString::Format("The dataset %s dataset operation is invalid.", operation.c_str());
-			return false;
-		}
-		PushToStack(ApplyOperation(operation, dataset1, dataset2), setStack, useDoubleStack);
-	}
-	return true;
-}
-
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		EvaluateUnaryOperator
-//
-// Description:		Evaluates the operator specified.  The only unary operator
-//					we recognize is minus (negation).
-//
-// Input Arguments:
-//		operator		= const wxString& describing the function to apply
-//		doubleStack		= std::stack<double>&
-//		setStack		= std::stack<Dataset2D>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		errorString		= wxString&
-//
-// Return Value:
-//		bool, true for success, false otherwise
-//
-//==========================================================================
-bool ExpressionTree::EvaluateUnaryOperator(const wxString &operation, std::stack<double> &doubleStack,
-	std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const
-{
-	if (operation.Cmp(_T("-")) != 0)
-	{
-		errorString = _T("Attempting to apply operator without two operands!");
-		return false;
-	}
-
-	double value;
-	Dataset2D dataset;
-	if (PopFromStack(doubleStack, setStack, useDoubleStack, value, dataset))
-		PushToStack(ApplyOperation(_T("*"), -1.0, value), doubleStack, useDoubleStack);
-	else
-		PushToStack(ApplyOperation(_T("*"), -1.0, dataset), setStack, useDoubleStack);
-
-	return true;
-}
-
 //==========================================================================
 // Class:			ExpressionTree
 // Function:		EvaluateOperator
@@ -1635,55 +1920,6 @@ bool ExpressionTree::EvaluateNumber(const wxString &number, std::stack<double> &
 	return true;
 }
 
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		EvaluateDataset
-//
-// Description:		Evaluates the dataset specified.
-//
-// Input Arguments:
-//		dataset			= const wxString& describing the function to apply
-//		setStack		= std::stack<Dataset2D>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		errorString		= wxString&
-//
-// Return Value:
-//		bool, true for success, false otherwise
-//
-//==========================================================================
-bool ExpressionTree::EvaluateDataset(const wxString &dataset, std::stack<Dataset2D> &setStack,
-	std::stack<bool> &useDoubleStack, wxString &errorString) const
-{
-	if (!list)
-	{
-		errorString = _T("No datasets available!");
-		return false;
-	}
-
-	bool unaryMinus = dataset[0] == '-';
-
-	unsigned long set;
-	if (!dataset.Mid(1 + (int)unaryMinus, dataset.Len() - 2 - (int)unaryMinus).ToULong(&set))
-	{
-		errorString = _T("Could not convert '") + dataset + _T("' to set ID.");
-		return false;
-	}
-	else if (set > (unsigned int)(*list).GetCount())
-	{
-		errorString = wxString::Format("Set ID %lu is not a valid set ID.", set);
-		return false;
-	}
-
-	if (unaryMinus)
-		PushToStack(GetSetFromList(set) * -1.0, setStack, useDoubleStack);
-	else
-		PushToStack(GetSetFromList(set), setStack, useDoubleStack);
-
-	return true;
-}
-
 //==========================================================================
 // Class:			ExpressionTree
 // Function:		SetOperatorValid
@@ -1719,43 +1955,6 @@ bool ExpressionTree::SetOperatorValid(const wxString &operation, const bool &lef
 	return false;
 }
 
-//==========================================================================
-// Class:			ExpressionTree
-// Function:		EvaluateNext
-//
-// Description:		Determines how to evaluate the specified term and takes
-//					appropriate action.
-//
-// Input Arguments:
-//		next			= const wxString&
-//		doubleStack		= std::stack<double>&
-//		setStack		= std::stack<Dataset2D>&
-//		useDoubleStack	= std::stack<bool>&
-//
-// Output Arguments:
-//		errorString		= wxString&
-//
-// Return Value:
-//		bool, true for valid operation, false otherwise
-//
-//==========================================================================
-bool ExpressionTree::EvaluateNext(const wxString &next, std::stack<double> &doubleStack,
-		std::stack<Dataset2D> &setStack, std::stack<bool> &useDoubleStack, wxString &errorString) const
-{
-	if (NextIsFunction(next))
-		return EvaluateFunction(next, doubleStack, setStack, useDoubleStack, errorString);
-	else if (NextIsNumber(next))
-		return EvaluateNumber(next, doubleStack, useDoubleStack, errorString);
-	else if (NextIsDataset(next))
-		return EvaluateDataset(next, setStack, useDoubleStack, errorString);
-	else if(NextIsOperator(next))
-		return EvaluateOperator(next, doubleStack, setStack, useDoubleStack, errorString);
-	else
-		errorString = _T("Unable to evaluate '") + next + _T("'.");
-
-	return false;
-}
-
 //==========================================================================
 // Class:			ExpressionTree
 // Function:		EvaluateNext
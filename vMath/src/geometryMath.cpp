@@ -6,6 +6,7 @@
 // Standard C++ headers
 #include <cmath>
 #include <cassert>
+#include <algorithm>
 
 // Local headers
 #include "vMath/geometryMath.h"
@@ -16,24 +17,23 @@
 // Function:		FindThreeSpheresIntersection
 //
 // Description:		Computes the intersections between the specified spheres.
-//					It is tempting to attempt to solve for the intersections
-//					directly, but there is actually no closed-form solution
-//					when taking this approach.  Instead, we take the following
-//					approach:
-//					1.  Define a sphere whose surface contains the circle
-//					2.  Find the intersection of the sphere from step 1 and the
-//						sphere passed as an argument (this intersection is a
-//						circle, but we instead choose to find the plane on which
-//						this circle resides)
-//					3.  Find the axis defined by the intersection of the plane
-//						from step 2 and the plane on which the circle passed as
-//						an argument resides
-//					4.  Find the intersection of the axis from step 4 with the
-//						sphere passed as an argument
+//					The solution is found analytically in a local coordinate
+//					system:
+//					1.  Place the origin at the center of the first sphere, with
+//						the first axis passing through the center of the second
+//						sphere and the second axis chosen so that the center of
+//						the third sphere lies in the plane of the first two axes
+//					2.  In this system, subtracting the sphere equations from
+//						each other yields the first two components of the
+//						solution directly
+//					3.  The third component follows from the equation of the
+//						first sphere; the two solutions are symmetric about the
+//						plane containing the three centers
 //
 // Input Arguments:
-//		c	= const Circle&
-//		s	= const Sphere&
+//		s1	= const Sphere&
+//		s2	= const Sphere&
+//		s3	= const Sphere&
 //
 // Output Arguments:
 //		intersections	= Vector* (must have size of 2)
@@ -47,28 +47,118 @@ bool GeometryMath::FindThreeSpheresIntersection(const Sphere& s1, const Sphere&
 {
 	assert(intersections && "intersections must not be NULL");
 
-	// The method:
-	//  1.	The intersection of two spheres creates a circle.  That circle lies on a plane.
-	//		Determine this plane for any two spheres. This plane is determined by subtracting
-	//		the equations of two spheres.  This is different from (better than) substitution,
-	//		because this will ensure that the higher order terms drop out.
-	//  2.	Determine the same plane as in step 1 for a different set of two spheres.
-	//  3.	Find the line created by the intersection of the planes found in steps 1 and 2.
-	//		Lines only have one degree of freedom, so this will be two equations in the same
-	//		variable.
-	//  4.  The intersection of the line and any sphere will yield two points (unless the
-	//		spheres don't intersect or they intersect at only one point).  These points are
-	//		the solutions.  Here, we employ the quadratic equation and the equation of the
-	//		line determined in step 3.
-
-	Plane p1 = FindSphereSphereIntersectionPlane(s1, s2);
-	Plane p2 = FindSphereSphereIntersectionPlane(s1, s3);
-
-	Axis a;
-	if (!FindPlanePlaneIntersection(p1, p2, a))
+	Vector toSecond(s2.center - s1.center);
+	Vector toThird(s3.center - s1.center);
+
+	double d = toSecond.Length();
+	if (VVASEMath::IsZero(d))// Coincident centers
+		return false;
+	Vector ex(toSecond / d);
+
+	double i = ex * toThird;
+	Vector ey(toThird - ex * i);
+	double eyLength = ey.Length();
+	if (VVASEMath::IsZero(eyLength))// Collinear centers
+		return false;
+	ey /= eyLength;
+	Vector ez(ex.Cross(ey));
+	double j = ey * toThird;
+
+	// Components of the solution in the local coordinate system
+	double u = 0.5 * (s1.radius * s1.radius - s2.radius * s2.radius + d * d) / d;
+	double v = 0.5 * (s1.radius * s1.radius - s3.radius * s3.radius + i * i + j * j) / j - i * u / j;
+	double wSquared = s1.radius * s1.radius - u * u - v * v;
+	if (wSquared < 0.0)
 		return false;
 
-	return FindAxisSphereIntersections(a, s1, intersections);
+	double w = sqrt(wSquared);
+	Vector inPlane(s1.center + ex * u + ey * v);
+	intersections[0] = inPlane + ez * w;
+	intersections[1] = inPlane - ez * w;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			GeometryMath
+// Function:		FindThreeSpheresIntersections
+//
+// Description:		Computes the intersections between the specified spheres
+//					for each lane.  This is the same method as
+//					FindThreeSpheresIntersection(), written without branches
+//					or function calls so that the compiler can vectorize the
+//					loop over the lanes.  Results for lanes without a solution
+//					are undefined.
+//
+// Input Arguments:
+//		s1	= const SphereLanes&
+//		s2	= const SphereLanes&
+//		s3	= const SphereLanes&
+//
+// Output Arguments:
+//		intersections	= VectorLanes* (must have size of 2)
+//		solved			= bool* (must have size of laneCount), true for each
+//						  lane for which a solution exists
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeometryMath::FindThreeSpheresIntersections(const SphereLanes& s1, const SphereLanes& s2,
+	const SphereLanes& s3, VectorLanes *intersections, bool *solved)
+{
+	assert(intersections && "intersections must not be NULL");
+	assert(solved && "solved must not be NULL");
+
+	unsigned int k;
+	for (k = 0; k < laneCount; k++)
+	{
+		const double toSecondX(s2.x[k] - s1.x[k]);
+		const double toSecondY(s2.y[k] - s1.y[k]);
+		const double toSecondZ(s2.z[k] - s1.z[k]);
+		const double toThirdX(s3.x[k] - s1.x[k]);
+		const double toThirdY(s3.y[k] - s1.y[k]);
+		const double toThirdZ(s3.z[k] - s1.z[k]);
+
+		const double d(sqrt(toSecondX * toSecondX + toSecondY * toSecondY + toSecondZ * toSecondZ));
+		const double exX(toSecondX / d);
+		const double exY(toSecondY / d);
+		const double exZ(toSecondZ / d);
+
+		const double i(exX * toThirdX + exY * toThirdY + exZ * toThirdZ);
+		double eyX(toThirdX - exX * i);
+		double eyY(toThirdY - exY * i);
+		double eyZ(toThirdZ - exZ * i);
+		const double eyLength(sqrt(eyX * eyX + eyY * eyY + eyZ * eyZ));
+		eyX /= eyLength;
+		eyY /= eyLength;
+		eyZ /= eyLength;
+
+		const double ezX(exY * eyZ - exZ * eyY);
+		const double ezY(exZ * eyX - exX * eyZ);
+		const double ezZ(exX * eyY - exY * eyX);
+		const double j(eyX * toThirdX + eyY * toThirdY + eyZ * toThirdZ);
+
+		const double r1Squared(s1.radius[k] * s1.radius[k]);
+		const double u(0.5 * (r1Squared - s2.radius[k] * s2.radius[k] + d * d) / d);
+		const double v(0.5 * (r1Squared - s3.radius[k] * s3.radius[k] + i * i + j * j) / j - i * u / j);
+		const double wSquared(r1Squared - u * u - v * v);
+		const double w(sqrt(std::max(wSquared, 0.0)));
+
+		solved[k] = d > VVASEMath::NearlyZero && eyLength > VVASEMath::NearlyZero && wSquared >= 0.0;
+
+		const double inPlaneX(s1.x[k] + exX * u + eyX * v);
+		const double inPlaneY(s1.y[k] + exY * u + eyY * v);
+		const double inPlaneZ(s1.z[k] + exZ * u + eyZ * v);
+
+		intersections[0].x[k] = inPlaneX + ezX * w;
+		intersections[0].y[k] = inPlaneY + ezY * w;
+		intersections[0].z[k] = inPlaneZ + ezZ * w;
+
+		intersections[1].x[k] = inPlaneX - ezX * w;
+		intersections[1].y[k] = inPlaneY - ezY * w;
+		intersections[1].z[k] = inPlaneZ - ezZ * w;
+	}
 }
 
 //==========================================================================
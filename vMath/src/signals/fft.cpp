@@ -19,9 +19,29 @@
 
 // Local headers
 #include "vMath/signals/fft.h"
+#include "vMath/signals/fftPlan.h"
 #include "vMath/dataset2D.h"
 #include "vMath/carMath.h"
 #include "vMath/signals/derivative.h"
+#include "vUtilities/debugger.h"
+
+//==========================================================================
+// Class:			FastFourierTransform
+// Function:		Constant Declarations
+//
+// Description:		Constant declarations for FastFourierTransform class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int FastFourierTransform::minimumParallelPoints = 65536;
 
 //==========================================================================
 // Class:			FastFourierTransform
@@ -80,16 +100,34 @@ Dataset2D FastFourierTransform::ComputeFFT(Dataset2D data, const FFTWindow &wind
 		data -= data.ComputeYMean();
 
 	if (windowSize == 0)
-		windowSize = (unsigned int)pow(2, (double)GetMaxPowerOfTwo(data.GetNumberOfPoints()));
+		windowSize = data.GetNumberOfPoints();
 
-	Dataset2D rawFFT, fft;
-	unsigned int i, count = GetNumberOfAverages(windowSize, overlap, data.GetNumberOfPoints());
-	for (i = 0; i < count; i++)
+	unsigned int count = GetNumberOfAverages(windowSize, overlap, data.GetNumberOfPoints());
+	if (count == 0)
+		return Dataset2D();
+
+	Segments segments;
+	segments.input = data.GetYPointer();
+	segments.output = NULL;
+	segments.windowSize = windowSize;
+	segments.step = windowSize - ComputeOverlapPoints(windowSize, overlap);
+	segments.window = GenerateWindow(window, windowSize);
+
+	const FFTPlan plan(windowSize, true);
+	segments.plan = &plan;
+
+	SpectrumSums sums;
+	AccumulateSegmentsInParallel(segments, count, sums);
+
+	// Average and convert to single-sided amplitude (no factor of 2 for DC point)
+	Dataset2D fft(sums.amplitude.size());
+	const double scale(1.0 / ((double)windowSize * (double)count));
+	unsigned int i;
+	for (i = 0; i < fft.GetNumberOfPoints(); i++)
 	{
-		rawFFT = ComputeRawFFT(ChopSample(data, i, windowSize, overlap), window);
-		AddToAverage(fft, GetAmplitudeData(rawFFT, sampleRate), count);
+		fft.GetXPointer()[i] = (double)i * sampleRate / (double)windowSize;
+		fft.GetYPointer()[i] = sums.amplitude[i] * scale * (i == 0 ? 1.0 : 2.0);
 	}
-	fft = ConvertDoubleSidedToSingleSided(fft);
 	//ConvertAmplitudeToDecibels(fft);// Appearance can be achieved with log scaled y-axis, so don't force it on them
 
 	return fft;
@@ -141,10 +179,7 @@ Dataset2D FastFourierTransform::ChopSample(const Dataset2D &data, const unsigned
 {
 	assert(overlap >= 0.0 && overlap <= 1.0 && windowSize > 0);
 
-	unsigned int overlapSize = (unsigned int)(overlap * (double)windowSize);
-	if (overlapSize >= windowSize)
-		overlapSize = windowSize - 1;
-	unsigned int start = sample * (windowSize - overlapSize);
+	unsigned int start = sample * (windowSize - ComputeOverlapPoints(windowSize, overlap));
 
 	assert(start + windowSize <= data.GetNumberOfPoints());
 
@@ -161,38 +196,172 @@ Dataset2D FastFourierTransform::ChopSample(const Dataset2D &data, const unsigned
 
 //==========================================================================
 // Class:			FastFourierTransform
-// Function:		AddToAverage (static)
+// Function:		GenerateWindow (static)
 //
-// Description:		Adds the data to the average.  Initializes the average
-//					if it is empty.
+// Description:		Returns the coefficients of the specified window, so the
+//					window can be applied to each sample without recomputing
+//					it.
 //
 // Input Arguments:
-//		average	= Dataset2D& (input and output)
-//		data	= const Dataset2D&
-//		count	= const unsigned int&
+//		window	= const FFTWindow&
+//		size	= const unsigned int&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
+//		std::vector<double>
+//
+//==========================================================================
+std::vector<double> FastFourierTransform::GenerateWindow(const FFTWindow &window, const unsigned int &size)
+{
+	Dataset2D coefficients(size);
+	unsigned int i;
+	for (i = 0; i < size; i++)
+		coefficients.GetXPointer()[i] = 1.0;
+
+	ApplyWindow(coefficients, window);
+	return std::vector<double>(coefficients.GetXPointer(), coefficients.GetXPointer() + size);
+}
+
+//==========================================================================
+// Class:			FastFourierTransform
+// Function:		AccumulateSegments (static)
+//
+// Description:		Windows and transforms the specified segments and sums
+//					their spectra.  The segments are read directly from the
+//					signal, and all working memory is allocated up front.
+//
+// Input Arguments:
+//		segments	= const Segments&
+//		first		= const unsigned int& first segment
+//		last		= const unsigned int& one past the last segment
+//
+// Output Arguments:
+//		sums		= SpectrumSums&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FastFourierTransform::AccumulateSegments(const Segments &segments,
+	const unsigned int &first, const unsigned int &last, SpectrumSums &sums)
+{
+	const unsigned int size(segments.windowSize), bins(size / 2 + 1);
+	const FFTPlan &plan(*segments.plan);
+
+	std::vector<double> inReal(size), inImaginary(size), outReal, outImaginary;
+	std::vector<double> scratch(plan.GetScratchSize());
+	double *scratchPointer(scratch.empty() ? NULL : &scratch.front());
+
+	if (segments.output)
+	{
+		outReal.resize(size);
+		outImaginary.resize(size);
+		sums.crossReal.assign(bins, 0.0);
+		sums.crossImaginary.assign(bins, 0.0);
+		sums.power.assign(bins, 0.0);
+	}
+	else
+		sums.amplitude.assign(bins, 0.0);
+
+	const double *input, *output;
+	unsigned int i, j;
+	for (i = first; i < last; i++)
+	{
+		input = segments.input + i * segments.step;
+		for (j = 0; j < size; j++)
+			inReal[j] = input[j] * segments.window[j];
+		plan.TransformReal(&inReal.front(), &inReal.front(), &inImaginary.front(), scratchPointer);
+
+		if (!segments.output)
+		{
+			for (j = 0; j < bins; j++)
+				sums.amplitude[j] += sqrt(inReal[j] * inReal[j] + inImaginary[j] * inImaginary[j]);
+			continue;
+		}
+
+		output = segments.output + i * segments.step;
+		for (j = 0; j < size; j++)
+			outReal[j] = output[j] * segments.window[j];
+		plan.TransformReal(&outReal.front(), &outReal.front(), &outImaginary.front(), scratchPointer);
+
+		for (j = 0; j < bins; j++)
+		{
+			sums.crossReal[j] += outReal[j] * inReal[j] + outImaginary[j] * inImaginary[j];
+			sums.crossImaginary[j] += outImaginary[j] * inReal[j] - outReal[j] * inImaginary[j];
+			sums.power[j] += inReal[j] * inReal[j] + inImaginary[j] * inImaginary[j];
+		}
+	}
+}
+
+//==========================================================================
+// Class:			FastFourierTransform
+// Function:		AccumulateSegmentsInParallel (static)
+//
+// Description:		Splits the segments into contiguous blocks and accumulates
+//					each block in its own thread (the calling thread performs
+//					the first block).  Each thread sums into its own buffers,
+//					which are then added together.
+//
+// Input Arguments:
+//		segments	= const Segments&
+//		count		= const unsigned int& number of segments
+//
+// Output Arguments:
+//		sums		= SpectrumSums&
+//
+// Return Value:
 //		None
 //
 //==========================================================================
-void FastFourierTransform::AddToAverage(Dataset2D &average, const Dataset2D &data, const unsigned int &count)
+void FastFourierTransform::AccumulateSegmentsInParallel(const Segments &segments,
+	const unsigned int &count, SpectrumSums &sums)
 {
+	int cpuCount(wxThread::GetCPUCount());
+	unsigned int threadCount(cpuCount < 1 ? 1 : std::min((unsigned int)cpuCount, count));
+	if ((double)count * (double)segments.windowSize < (double)minimumParallelPoints || threadCount < 2)
+	{
+		AccumulateSegments(segments, 0, count, sums);
+		return;
+	}
+
+	std::vector<SpectrumSums> blockSums(threadCount);
+	std::vector<AveragingThread*> threads(threadCount, NULL);
 	unsigned int i;
-	if (average.GetNumberOfPoints() == 0)
+	for (i = 1; i < threadCount; i++)
 	{
-		average.Resize(data.GetNumberOfPoints());
-		for (i = 0; i < average.GetNumberOfPoints(); i++)
+		threads[i] = new AveragingThread(segments,
+			i * count / threadCount, (i + 1) * count / threadCount, blockSums[i]);
+		if (threads[i]->Run() != wxTHREAD_NO_ERROR)
 		{
-			average.GetXPointer()[i] = data.GetXData(i);
-			average.GetYPointer()[i] = 0.0;
+			Debugger::GetInstance() << "Warning (FastFourierTransform):  Failed to start thread" << Debugger::PriorityLow;
+			delete threads[i];
+			threads[i] = NULL;
+			AccumulateSegments(segments, i * count / threadCount, (i + 1) * count / threadCount, blockSums[i]);
 		}
 	}
 
-	for (i = 0; i < average.GetNumberOfPoints(); i++)
-		average.GetYPointer()[i] += data.GetYData(i) / double(count);
+	AccumulateSegments(segments, 0, count / threadCount, sums);
+
+	unsigned int j;
+	for (i = 1; i < threadCount; i++)
+	{
+		if (threads[i])
+		{
+			threads[i]->Wait();
+			delete threads[i];
+		}
+
+		for (j = 0; j < sums.amplitude.size(); j++)
+			sums.amplitude[j] += blockSums[i].amplitude[j];
+		for (j = 0; j < sums.power.size(); j++)
+		{
+			sums.crossReal[j] += blockSums[i].crossReal[j];
+			sums.crossImaginary[j] += blockSums[i].crossImaginary[j];
+			sums.power[j] += blockSums[i].power[j];
+		}
+	}
 }
 
 //==========================================================================
@@ -257,8 +426,9 @@ Dataset2D FastFourierTransform::ComputeRawFFT(const Dataset2D &data, const FFTWi
 	if (data.GetNumberOfPoints() < 2)
 		return rawFFT;
 
-	DoBitReversal(rawFFT);
-	DoFFT(rawFFT);
+	// The windowed signal is real, so it is transformed in place
+	FFTPlan(rawFFT.GetNumberOfPoints(), true).TransformReal(rawFFT.GetXPointer(),
+		rawFFT.GetXPointer(), rawFFT.GetYPointer());
 
 	return rawFFT;
 }
@@ -294,21 +464,34 @@ void FastFourierTransform::ComputeFRF(const Dataset2D &input, const Dataset2D &o
 	unsigned int i, windowSize;
 	double overlap = ComputeOverlap(windowSize, numberOfAverages, input.GetNumberOfPoints());
 
-	Dataset2D fftIn, fftOut, crossPower(windowSize), power(windowSize), size(GenerateConstantDataset(numberOfAverages, 0.0, windowSize));
-	ZeroDataset(crossPower);
-	ZeroDataset(power);
-	for (i = 0; i < numberOfAverages; i++)
-	{
-		fftIn = ComputeRawFFT(ChopSample(input, i, windowSize, overlap), window);
-		fftOut = ComputeRawFFT(ChopSample(output, i, windowSize, overlap), window);
+	Segments segments;
+	segments.input = input.GetYPointer();
+	segments.output = output.GetYPointer();
+	segments.windowSize = windowSize;
+	segments.step = windowSize - ComputeOverlapPoints(windowSize, overlap);
+	segments.window = GenerateWindow(window, windowSize);
+
+	const FFTPlan plan(windowSize, true);
+	segments.plan = &plan;
 
-		crossPower = ComplexAdd(crossPower, ComputeCrossPowerSpectrum(fftIn, fftOut));
-		power = ComplexAdd(power, ComputePowerSpectrum(fftIn));
+	SpectrumSums sums;
+	AccumulateSegmentsInParallel(segments, numberOfAverages, sums);
+
+	// The scaling of the averaged cross and input power spectra cancels in the
+	// ratio; the negative frequencies are the complex conjugates of the positive
+	// frequencies
+	Dataset2D rawFRF(windowSize);
+	for (i = 0; i < sums.power.size(); i++)
+	{
+		rawFRF.GetXPointer()[i] = sums.crossReal[i] / sums.power[i];
+		rawFRF.GetYPointer()[i] = sums.crossImaginary[i] / sums.power[i];
 	}
 
-	crossPower = ComplexDivide(crossPower, size);
-	power = ComplexDivide(power, size);
-	Dataset2D rawFRF = ComplexDivide(crossPower, power);
+	for (; i < windowSize; i++)
+	{
+		rawFRF.GetXPointer()[i] = rawFRF.GetXData(windowSize - i);
+		rawFRF.GetYPointer()[i] = -rawFRF.GetYData(windowSize - i);
+	}
 
 	double sampleRate = 1.0 / input.GetAverageDeltaX();// [Hz]
 	amplitude = ConvertDoubleSidedToSingleSided(GetAmplitudeData(rawFRF, sampleRate), false);
@@ -414,161 +597,6 @@ Dataset2D FastFourierTransform::ComputeCoherence(const Dataset2D& input, const D
 	return GetAmplitudeData(rawCoherence, sampleRate);
 }
 
-//==========================================================================
-// Class:			FastFourierTransform
-// Function:		ZeroDataset (static)
-//
-// Description:		Zeros out the data in the dataset.
-//
-// Input Arguments:
-//		data	= Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//==========================================================================
-void FastFourierTransform::ZeroDataset(Dataset2D &data)
-{
-	data = GenerateConstantDataset(0.0, 0.0, data.GetNumberOfPoints());
-}
-
-//==========================================================================
-// Class:			FastFourierTransform
-// Function:		GenerateConstantDataset (static)
-//
-// Description:		Generates a dataset with constant x- and y-values.
-//
-// Input Arguments:
-//		xValue	= const double&
-//		yValue	= const double&
-//		size	= const unsigned int&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//==========================================================================
-Dataset2D FastFourierTransform::GenerateConstantDataset(const double &xValue, const double &yValue, const unsigned int &size)
-{
-	Dataset2D data(size);
-
-	unsigned int i;
-	for (i = 0; i < data.GetNumberOfPoints(); i++)
-	{
-		data.GetXPointer()[i] = xValue;
-		data.GetYPointer()[i] = yValue;
-	}
-
-	return data;
-}
-
-//==========================================================================
-// Class:			FastFourierTransform
-// Function:		DoBitReversal (static)
-//
-// Description:		Performs bit reversal on processing dataset.  It is assumed
-//					that the set has already been padded/chopped.
-//
-// Input Arguments:
-//		set			= Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//==========================================================================
-void FastFourierTransform::DoBitReversal(Dataset2D &set)
-{
-	assert(double(set.GetNumberOfPoints()) / 2.0 == double(set.GetNumberOfPoints() / 2));
-
-	unsigned int i, j, k;
-	double tempX, tempY;
-
-	j = 0;
-	for (i = 0; i < set.GetNumberOfPoints() - 1; i++)
-	{
-		if (i < j)
-		{
-			tempX = set.GetXData(i);
-			tempY = set.GetYData(i);
-			set.GetXPointer()[i] = set.GetXData(j);
-			set.GetYPointer()[i] = set.GetYData(j);
-			set.GetXPointer()[j] = tempX;
-			set.GetYPointer()[j] = tempY;
-		}
-
-		k = set.GetNumberOfPoints() >> 1;
-		while (k <= j)
-		{
-			j -= k;
-			k >>= 1;
-		}
-
-		j += k;
-	}
-}
-
-//==========================================================================
-// Class:			FastFourierTransform
-// Function:		DoFFT (static)
-//
-// Description:		Performs the calculation to get raw FFT data.
-//
-// Input Arguments:
-//		powerOfTwo	= const unsigned int&
-//		temp		= Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//==========================================================================
-void FastFourierTransform::DoFFT(Dataset2D &temp)
-{
-	unsigned int i, j, i1, l, l1, l2;
-	double c1, c2, t1, t2, u1, u2, z;
-	unsigned int powerOfTwo = GetMaxPowerOfTwo(temp.GetNumberOfPoints());
-
-	c1 = -1.0;
-	c2 = 0.0;
-	l2 = 1;
-	for (l = 0; l < powerOfTwo; l++)
-	{
-		l1 = l2;
-		l2 <<= 1;
-		u1 = 1.0;
-		u2 = 0.0;
-		for (j = 0; j < l1; j++)
-		{
-			for (i = j; i < temp.GetNumberOfPoints(); i += l2)
-			{
-				i1 = i + l1;
-				t1 = u1 * temp.GetXData(i1) - u2 * temp.GetYData(i1);
-				t2 = u1 * temp.GetYData(i1) + u2 * temp.GetXData(i1);
-				temp.GetXPointer()[i1] = temp.GetXData(i) - t1;
-				temp.GetYPointer()[i1] = temp.GetYData(i) - t2;
-				temp.GetXPointer()[i] += t1;
-				temp.GetYPointer()[i] += t2;
-			}
-			z =  u1 * c1 - u2 * c2;
-			u2 = u1 * c2 + u2 * c1;
-			u1 = z;
-		}
-		c2 = sqrt((1.0 - c1) / 2.0);
-		c2 = -c2;
-		c1 = sqrt((1.0 + c1) / 2.0);
-	}
-}
-
 //==========================================================================
 // Class:			FastFourierTransform
 // Function:		ConvertDoubleSidedToSingleSided (static)
@@ -1136,11 +1164,37 @@ std::string FastFourierTransform::GetWindowName(const FFTWindow &window)
 //==========================================================================
 unsigned int FastFourierTransform::GetNumberOfAverages(const unsigned int windowSize,
 		const double &overlap, const unsigned int &dataSize)
+{
+	unsigned int overlapSize = ComputeOverlapPoints(windowSize, overlap);
+	return (dataSize - overlapSize) / (windowSize - overlapSize);
+}
+
+//==========================================================================
+// Class:			FastFourierTransform
+// Function:		ComputeOverlapPoints (static)
+//
+// Description:		Converts the overlap between adjacent samples from a
+//					percentage to a number of points.  Adjacent samples
+//					always begin at least one point apart.
+//
+// Input Arguments:
+//		windowSize	= const unsigned int&
+//		overlap		= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int FastFourierTransform::ComputeOverlapPoints(const unsigned int &windowSize,
+	const double &overlap)
 {
 	unsigned int overlapSize = (unsigned int)(overlap * (double)windowSize);
 	if (overlapSize >= windowSize)
 		overlapSize = windowSize - 1;
-	return (dataSize - overlapSize) / (windowSize - overlapSize);
+	return overlapSize;
 }
 
 //==========================================================================
@@ -1217,4 +1271,54 @@ unsigned int FastFourierTransform::ComputeRequiredOverlapPoints(const unsigned i
 		return 0;
 
 	return (unsigned int)ceil(overlap);
+}
+
+//==========================================================================
+// Class:			FastFourierTransform::AveragingThread
+// Function:		AveragingThread
+//
+// Description:		Constructor for the AveragingThread class.  The thread must
+//					be started with Run(), waited on with Wait() and then
+//					deleted by the caller.
+//
+// Input Arguments:
+//		segments	= const Segments& to be transformed
+//		first		= const unsigned int& first segment
+//		last		= const unsigned int& one past the last segment
+//		sums		= SpectrumSums& in which the spectra are accumulated
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FastFourierTransform::AveragingThread::AveragingThread(const Segments &segments,
+	const unsigned int &first, const unsigned int &last, SpectrumSums &sums)
+	: wxThread(wxTHREAD_JOINABLE), segments(segments), first(first), last(last), sums(sums)
+{
+	wxThread::Create();
+}
+
+//==========================================================================
+// Class:			FastFourierTransform::AveragingThread
+// Function:		Entry
+//
+// Description:		Thread entry point.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ExitCode (NULL)
+//
+//==========================================================================
+FastFourierTransform::AveragingThread::ExitCode FastFourierTransform::AveragingThread::Entry()
+{
+	AccumulateSegments(segments, first, last, sums);
+	return NULL;
 }
\ No newline at end of file
@@ -0,0 +1,605 @@
+/*===================================================================================
+                                    CarDesigner
+                           Copyright Kerry R. Loux 2011
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  fftPlan.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Precomputed tables for computing discrete Fourier transforms of a
+//				 specific length.  Plans are cached, so repeated transforms of the
+//				 same length (i.e. averaging) only compute the tables once.
+// History:
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+// Local headers
+#include "vMath/signals/fftPlan.h"
+#include "vMath/carMath.h"
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		Static Member Initialization
+//
+// Description:		Static member initialization for FFTPlan class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+wxMutex FFTPlan::cacheMutex;
+std::map<unsigned int, const FFTPlan*> FFTPlan::cache;
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		FFTPlan
+//
+// Description:		Constructor for the FFTPlan class.  Computes all of the
+//					tables required for transforms of the specified length.
+//
+// Input Arguments:
+//		size		= const unsigned int& number of points in the transform
+//		realInput	= const bool& indicating whether the plan is for real signals
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FFTPlan::FFTPlan(const unsigned int &size, const bool &realInput)
+	: size(size), realInput(realInput), scratchSize(0), subPlan(NULL), ownedSubPlan(NULL)
+{
+	assert(size > 0);
+
+	if (realInput)
+		InitializeReal();
+	else if (IsPowerOfTwo(size))
+		InitializePowerOfTwo();
+	else
+		InitializeBluestein();
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		~FFTPlan
+//
+// Description:		Destructor for the FFTPlan class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+FFTPlan::~FFTPlan()
+{
+	delete ownedSubPlan;
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		GetPowerOfTwoPlan (static)
+//
+// Description:		Retrieves the complex plan of the specified power-of-two
+//					length from the cache, creating it if necessary.  Only
+//					these plans are cached; their number is limited by the
+//					width of an unsigned int, whereas caching every length
+//					that is transformed would grow without bound.
+//
+// Input Arguments:
+//		size	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const FFTPlan&
+//
+//==========================================================================
+const FFTPlan& FFTPlan::GetPowerOfTwoPlan(const unsigned int &size)
+{
+	assert(IsPowerOfTwo(size));
+
+	// Power-of-two plans do not require other plans, so they can be created
+	// while the cache is locked
+	wxMutexLocker lock(cacheMutex);
+	const FFTPlan *&plan(cache[size]);
+	if (!plan)
+		plan = new FFTPlan(size);
+
+	return *plan;
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		SetSubPlan
+//
+// Description:		Sets the complex plan on which this plan is built.  Plans
+//					of lengths other than powers of two are owned by this
+//					plan.
+//
+// Input Arguments:
+//		subSize	= const unsigned int& length of the sub-plan
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::SetSubPlan(const unsigned int &subSize)
+{
+	if (IsPowerOfTwo(subSize))
+	{
+		subPlan = &GetPowerOfTwoPlan(subSize);
+		return;
+	}
+
+	ownedSubPlan = new FFTPlan(subSize);
+	subPlan = ownedSubPlan;
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		IsPowerOfTwo (static)
+//
+// Description:		Checks to see if the specified size is a power of two.
+//
+// Input Arguments:
+//		size	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool FFTPlan::IsPowerOfTwo(const unsigned int &size)
+{
+	return size > 0 && (size & (size - 1)) == 0;
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		InitializePowerOfTwo
+//
+// Description:		Computes the bit-reversal permutation and the twiddle
+//					factors for each stage.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::InitializePowerOfTwo()
+{
+	unsigned int i, j, k;
+
+	j = 0;
+	for (i = 0; i + 1 < size; i++)
+	{
+		if (i < j)
+		{
+			swaps.push_back(i);
+			swaps.push_back(j);
+		}
+
+		k = size >> 1;
+		while (k <= j)
+		{
+			j -= k;
+			k >>= 1;
+		}
+
+		j += k;
+	}
+
+	// Each stage's twiddles are stored contiguously, so the butterflies in a
+	// stage read them (and the data) with unit stride
+	twiddleReal.resize(size > 1 ? size - 1 : 0);
+	twiddleImaginary.resize(twiddleReal.size());
+	unsigned int halfSize;
+	for (halfSize = 1; halfSize < size; halfSize <<= 1)
+	{
+		for (i = 0; i < halfSize; i++)
+		{
+			twiddleReal[halfSize - 1 + i] = cos(VVASEMath::Pi * i / halfSize);
+			twiddleImaginary[halfSize - 1 + i] = -sin(VVASEMath::Pi * i / halfSize);
+		}
+	}
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		InitializeBluestein
+//
+// Description:		Computes the chirp and the transformed convolution kernel
+//					for Bluestein's algorithm, which expresses a transform
+//					of any length as a convolution that is computed with
+//					power-of-two transforms.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::InitializeBluestein()
+{
+	unsigned int convolutionSize(1);
+	while (convolutionSize < 2 * size - 1)
+		convolutionSize <<= 1;
+
+	SetSubPlan(convolutionSize);
+	scratchSize = 2 * convolutionSize;
+
+	// w[k] = exp(-i * pi * k^2 / size); k^2 is reduced modulo 2 * size to keep
+	// the angle small
+	chirpReal.resize(size);
+	chirpImaginary.resize(size);
+	unsigned int i;
+	double angle;
+	for (i = 0; i < size; i++)
+	{
+		angle = VVASEMath::Pi * (double)(((unsigned long long)i * i) % (2 * (unsigned long long)size)) / size;
+		chirpReal[i] = cos(angle);
+		chirpImaginary[i] = -sin(angle);
+	}
+
+	kernelReal.assign(convolutionSize, 0.0);
+	kernelImaginary.assign(convolutionSize, 0.0);
+	kernelReal[0] = chirpReal[0];
+	kernelImaginary[0] = -chirpImaginary[0];
+	for (i = 1; i < size; i++)
+	{
+		kernelReal[i] = chirpReal[i];
+		kernelImaginary[i] = -chirpImaginary[i];
+		kernelReal[convolutionSize - i] = chirpReal[i];
+		kernelImaginary[convolutionSize - i] = -chirpImaginary[i];
+	}
+
+	subPlan->Transform(kernelReal.data(), kernelImaginary.data());
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		InitializeReal
+//
+// Description:		Prepares for transforms of real signals.  Even lengths
+//					pack the signal into a complex sequence of half the
+//					length; odd lengths use a complex transform directly.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::InitializeReal()
+{
+	if (size % 2 == 1)
+	{
+		SetSubPlan(size);
+		scratchSize = subPlan->GetScratchSize();
+		return;
+	}
+
+	const unsigned int halfSize(size / 2);
+	SetSubPlan(halfSize);
+	scratchSize = subPlan->GetScratchSize();
+
+	splitReal.resize(halfSize / 2 + 1);
+	splitImaginary.resize(splitReal.size());
+	unsigned int i;
+	for (i = 0; i < splitReal.size(); i++)
+	{
+		splitReal[i] = cos(2.0 * VVASEMath::Pi * i / size);
+		splitImaginary[i] = -sin(2.0 * VVASEMath::Pi * i / size);
+	}
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		Transform
+//
+// Description:		Computes the transform of complex data in place.
+//
+// Input Arguments:
+//		real		= double*
+//		imaginary	= double*
+//		scratch		= double* (GetScratchSize() long, or NULL)
+//
+// Output Arguments:
+//		real		= double*
+//		imaginary	= double*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::Transform(double *real, double *imaginary, double *scratch) const
+{
+	assert(!realInput);
+
+	if (IsPowerOfTwo(size))
+	{
+		DoPowerOfTwoFFT(real, imaginary);
+		return;
+	}
+
+	if (scratch)
+		DoBluesteinFFT(real, imaginary, scratch);
+	else
+	{
+		std::vector<double> localScratch(scratchSize);
+		DoBluesteinFFT(real, imaginary, localScratch.data());
+	}
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		TransformReal
+//
+// Description:		Computes the transform of real data.
+//
+// Input Arguments:
+//		input		= const double*
+//		scratch		= double* (GetScratchSize() long, or NULL)
+//
+// Output Arguments:
+//		real		= double*
+//		imaginary	= double*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::TransformReal(const double *input, double *real, double *imaginary, double *scratch) const
+{
+	assert(realInput);
+
+	if (scratch || scratchSize == 0)
+		DoRealFFT(input, real, imaginary, scratch);
+	else
+	{
+		std::vector<double> localScratch(scratchSize);
+		DoRealFFT(input, real, imaginary, localScratch.data());
+	}
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		DoPowerOfTwoFFT
+//
+// Description:		Iterative radix-2 (decimation in time) transform.  The
+//					real and imaginary parts are kept in separate arrays and
+//					the twiddles are read from a table, so the butterfly
+//					loops have unit stride and no dependencies between
+//					iterations, which allows the compiler to vectorize them.
+//
+// Input Arguments:
+//		real		= double*
+//		imaginary	= double*
+//
+// Output Arguments:
+//		real		= double*
+//		imaginary	= double*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::DoPowerOfTwoFFT(double *real, double *imaginary) const
+{
+	unsigned int i;
+	for (i = 0; i < swaps.size(); i += 2)
+	{
+		std::swap(real[swaps[i]], real[swaps[i + 1]]);
+		std::swap(imaginary[swaps[i]], imaginary[swaps[i + 1]]);
+	}
+
+	const double *wReal, *wImaginary;
+	double *aReal, *aImaginary, *bReal, *bImaginary;
+	double tReal, tImaginary;
+	unsigned int halfSize, start, j;
+	for (halfSize = 1; halfSize < size; halfSize <<= 1)
+	{
+		wReal = twiddleReal.data() + halfSize - 1;
+		wImaginary = twiddleImaginary.data() + halfSize - 1;
+		for (start = 0; start < size; start += 2 * halfSize)
+		{
+			aReal = real + start;
+			aImaginary = imaginary + start;
+			bReal = aReal + halfSize;
+			bImaginary = aImaginary + halfSize;
+			for (j = 0; j < halfSize; j++)
+			{
+				tReal = wReal[j] * bReal[j] - wImaginary[j] * bImaginary[j];
+				tImaginary = wReal[j] * bImaginary[j] + wImaginary[j] * bReal[j];
+				bReal[j] = aReal[j] - tReal;
+				bImaginary[j] = aImaginary[j] - tImaginary;
+				aReal[j] += tReal;
+				aImaginary[j] += tImaginary;
+			}
+		}
+	}
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		DoBluesteinFFT
+//
+// Description:		Transform of arbitrary length using Bluestein's algorithm:
+//					X[k] = w[k] * sum(x[n] * w[n] * conj(w[k - n])), where the
+//					sum is a convolution computed with power-of-two transforms.
+//
+// Input Arguments:
+//		real		= double*
+//		imaginary	= double*
+//		scratch		= double* (GetScratchSize() long)
+//
+// Output Arguments:
+//		real		= double*
+//		imaginary	= double*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::DoBluesteinFFT(double *real, double *imaginary, double *scratch) const
+{
+	const unsigned int convolutionSize(subPlan->GetSize());
+	double *aReal(scratch), *aImaginary(scratch + convolutionSize);
+
+	unsigned int i;
+	for (i = 0; i < size; i++)
+	{
+		aReal[i] = real[i] * chirpReal[i] - imaginary[i] * chirpImaginary[i];
+		aImaginary[i] = real[i] * chirpImaginary[i] + imaginary[i] * chirpReal[i];
+	}
+	std::fill(aReal + size, aReal + convolutionSize, 0.0);
+	std::fill(aImaginary + size, aImaginary + convolutionSize, 0.0);
+
+	subPlan->Transform(aReal, aImaginary);
+
+	double temp;
+	for (i = 0; i < convolutionSize; i++)
+	{
+		temp = aReal[i] * kernelReal[i] - aImaginary[i] * kernelImaginary[i];
+		aImaginary[i] = aReal[i] * kernelImaginary[i] + aImaginary[i] * kernelReal[i];
+		aReal[i] = temp;
+	}
+
+	// Exchanging the real and imaginary parts turns the forward transform into
+	// an (unscaled) inverse transform
+	subPlan->Transform(aImaginary, aReal);
+
+	for (i = 0; i < size; i++)
+	{
+		real[i] = (aReal[i] * chirpReal[i] - aImaginary[i] * chirpImaginary[i]) / convolutionSize;
+		imaginary[i] = (aReal[i] * chirpImaginary[i] + aImaginary[i] * chirpReal[i]) / convolutionSize;
+	}
+}
+
+//==========================================================================
+// Class:			FFTPlan
+// Function:		DoRealFFT
+//
+// Description:		Transform of real data.  For even lengths, the even and
+//					odd samples are packed into the real and imaginary parts
+//					of a half-length sequence, and the half-length transform
+//					Z is separated into the transforms of the even (E) and
+//					odd (O) samples:
+//					  E[k] = (Z[k] + conj(Z[N/2 - k])) / 2
+//					  O[k] = (Z[k] - conj(Z[N/2 - k])) / 2i
+//					  X[k] = E[k] + exp(-2 pi i k / N) * O[k]
+//
+// Input Arguments:
+//		input		= const double* (may be the same as real)
+//		scratch		= double* (GetScratchSize() long)
+//
+// Output Arguments:
+//		real		= double*
+//		imaginary	= double*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void FFTPlan::DoRealFFT(const double *input, double *real, double *imaginary, double *scratch) const
+{
+	unsigned int i;
+	if (size % 2 == 1)
+	{
+		if (real != input)
+			std::copy(input, input + size, real);
+		std::fill(imaginary, imaginary + size, 0.0);
+		subPlan->Transform(real, imaginary, scratch);
+		return;
+	}
+
+	// Each input value is read before it can be overwritten (element i is
+	// written after elements 2i and 2i + 1 have been read)
+	const unsigned int halfSize(size / 2);
+	double even, odd;
+	for (i = 0; i < halfSize; i++)
+	{
+		even = input[2 * i];
+		odd = input[2 * i + 1];
+		real[i] = even;
+		imaginary[i] = odd;
+	}
+
+	subPlan->Transform(real, imaginary, scratch);
+
+	// k and N/2 - k are computed together, since each needs the other's value
+	double eReal, eImaginary, oReal, oImaginary, tReal, tImaginary;
+	unsigned int j;
+	for (i = 0; i <= halfSize / 2; i++)
+	{
+		j = (halfSize - i) % halfSize;
+		eReal = 0.5 * (real[i] + real[j]);
+		eImaginary = 0.5 * (imaginary[i] - imaginary[j]);
+		oReal = 0.5 * (imaginary[i] + imaginary[j]);
+		oImaginary = -0.5 * (real[i] - real[j]);
+
+		tReal = splitReal[i] * oReal - splitImaginary[i] * oImaginary;
+		tImaginary = splitReal[i] * oImaginary + splitImaginary[i] * oReal;
+
+		if (i == 0)
+		{
+			real[halfSize] = eReal - tReal;
+			imaginary[halfSize] = eImaginary - tImaginary;
+		}
+		else
+		{
+			// X[N/2 - k] = conj(E[k] - W^k * O[k])
+			real[j] = eReal - tReal;
+			imaginary[j] = tImaginary - eImaginary;
+		}
+
+		real[i] = eReal + tReal;
+		imaginary[i] = eImaginary + tImaginary;
+	}
+
+	// The upper half of the spectrum is the conjugate of the lower half
+	for (i = 1; i < halfSize; i++)
+	{
+		real[size - i] = real[i];
+		imaginary[size - i] = -imaginary[i];
+	}
+}
@@ -15,13 +15,40 @@
 
 // Standard C++ headers
 #include <cstdlib>
+#include <cassert>
+#include <cmath>
 #include <algorithm>
 #include <functional>
+#include <limits>
+#include <iostream>
+
+// wxWidgets headers
+#include <wx/wx.h>
 
 // Local headers
 #include "vMath/signals/filter.h"
 #include "vMath/expressionTree.h"
 #include "vMath/carMath.h"
+#include "vMath/complex.h"
+
+//==========================================================================
+// Class:			Filter
+// Function:		Constant Declarations
+//
+// Description:		Constant declarations for Filter class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int Filter::channelLanes = 8;
+const unsigned int Filter::channelBlockSize = 256;
 
 //==========================================================================
 // Class:			Filter
@@ -41,10 +68,8 @@
 //==========================================================================
 Filter::Filter(const double &sampleRate) : sampleRate(sampleRate)
 {
-	a = NULL;
-	b = NULL;
-	u = NULL;
-	y = NULL;
+	rawValue = 0.0;
+	filteredValue = 0.0;
 }
 
 //==========================================================================
@@ -117,7 +142,6 @@ Filter::Filter(const Filter &f) : sampleRate(f.sampleRate)
 //==========================================================================
 Filter::~Filter()
 {
-	DeleteArrays();
 }
 
 //==========================================================================
@@ -128,6 +152,10 @@ Filter::~Filter()
 //					a filter equivalent to the continuous-time (s-domain)
 //					arguments.  Uses bilinear transform:
 //					s = 2 * (1 - z^-1) / (T * (1 + z^-1)).
+//					The transform is applied to the poles and zeros (rather
+//					than to the polynomials), which are then grouped into
+//					second-order sections.  Zeros (or poles) at infinity map
+//					to z = -1.
 //
 // Input Arguments:
 //		numerator	= const std::vector<double>& continuous time coefficients,
@@ -145,125 +173,385 @@ Filter::~Filter()
 void Filter::GenerateCoefficients(const std::vector<double> &numerator,
 	const std::vector<double> &denominator)
 {
-	unsigned int highestPower = std::max(numerator.size(), denominator.size()) - 1;
-	std::string numString = AssembleZExpression(numerator, highestPower);
-	std::string denString = AssembleZExpression(denominator, highestPower);
-
-	std::vector<double> zNum = CoefficientsFromString(numString);
-	std::vector<double> zDen = CoefficientsFromString(denString);
-	AllocateArrays(zNum.size(), zDen.size());
+	const Complex twiceRate(2.0 * sampleRate, 0.0);
+	std::vector<Complex> zeros(FindRoots(numerator)), poles(FindRoots(denominator));
+	Complex gain(GetLeadingCoefficient(numerator) / GetLeadingCoefficient(denominator), 0.0);
 
 	unsigned int i;
-	for (i = 0; i < zNum.size(); i++)
-		a[i] = zNum[i] / zDen[0];
-	for (i = 0; i < zDen.size() - 1; i++)
-		b[i] = zDen[i + 1] / zDen[0];
+	for (i = 0; i < zeros.size(); i++)
+	{
+		gain *= twiceRate - zeros[i];
+		zeros[i] = (twiceRate + zeros[i]) / (twiceRate - zeros[i]);
+	}
+
+	for (i = 0; i < poles.size(); i++)
+	{
+		gain /= twiceRate - poles[i];
+		poles[i] = (twiceRate + poles[i]) / (twiceRate - poles[i]);
+	}
+
+	while (zeros.size() < poles.size())
+		zeros.push_back(Complex(-1.0, 0.0));
+	while (poles.size() < zeros.size())
+		poles.push_back(Complex(-1.0, 0.0));
+
+	GenerateSections(zeros, poles, gain.real);
 }
 
 //==========================================================================
 // Class:			Filter
-// Function:		AssembleZExpression
+// Function:		GenerateSections
 //
-// Description:		Assembles the z-domain expression equivalent to the s-domain
-//					coefficients provided.
+// Description:		Groups the discrete-time poles and zeros into second-
+//					order sections.  Poles are grouped into sections in order
+//					of increasing radius (so the most lightly damped section
+//					is applied last), and each group of poles is paired with
+//					the nearest remaining group of zeros.  The gain is applied
+//					in the first section.
 //
 // Input Arguments:
-//		coefficients	= const std::vector<double>& continuous time coefficients,
-//						  highest power of s to lowest power of s
-//		highestPower	= const unsigned int&
+//		zeroRoots	= const std::vector<Complex>& (z-domain)
+//		poleRoots	= const std::vector<Complex>& (z-domain)
+//		gain		= const double&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		std::string
+//		None
 //
 //==========================================================================
-std::string Filter::AssembleZExpression(const std::vector<double>& coefficients,
-	const unsigned int &highestPower) const
+void Filter::GenerateSections(const std::vector<Complex> &zeroRoots,
+	const std::vector<Complex> &poleRoots, const double &gain)
 {
-	const unsigned int tempSize(256);
-	char temp[tempSize];
+	std::vector<Factor> zeros(GroupRoots(zeroRoots));
+	std::vector<Factor> poles(GroupRoots(poleRoots));
 
-	VVASEMath::sprintf(temp, tempSize, "(%f*(1+z^-1))", 1.0 / sampleRate);
-	std::string posBilinTerm(temp), negBilinTerm("(2*(1-z^-1))");
-	std::string result;
+	unsigned int i, j;
+	std::vector<std::pair<double, unsigned int> > radii;
+	for (i = 0; i < poles.size(); i++)
+		radii.push_back(std::make_pair(poles[i].rootReal * poles[i].rootReal
+			+ poles[i].rootImaginary * poles[i].rootImaginary, i));
+	std::sort(radii.begin(), radii.end());
 
-	unsigned int i;
-	for (i = 0; i < coefficients.size(); i++)
+	sections.assign(std::max<unsigned int>(1, std::max(poles.size(), zeros.size())), Section());
+	std::vector<bool> hasZeros(sections.size(), false);
+	for (i = 0; i < sections.size(); i++)
 	{
-		if (VVASEMath::IsZero(coefficients[i]))
+		sections[i].a[0] = 1.0;
+		sections[i].a[1] = 0.0;
+		sections[i].a[2] = 0.0;
+		if (i < poles.size())
+		{
+			sections[i].b[0] = poles[radii[i].second].c[1];
+			sections[i].b[1] = poles[radii[i].second].c[2];
+		}
+		else
+		{
+			sections[i].b[0] = 0.0;
+			sections[i].b[1] = 0.0;
+		}
+	}
+
+	// Starting with the poles nearest the unit circle, take the nearest zeros
+	std::vector<bool> used(zeros.size(), false);
+	double distance, closestDistance;
+	unsigned int closest, assigned(0);
+	for (i = poles.size(); i > 0 && assigned < zeros.size(); i--, assigned++)
+	{
+		const Factor &pole(poles[radii[i - 1].second]);
+		closest = zeros.size();
+		closestDistance = 0.0;
+		for (j = 0; j < zeros.size(); j++)
+		{
+			if (used[j])
+				continue;
+
+			distance = (zeros[j].rootReal - pole.rootReal) * (zeros[j].rootReal - pole.rootReal)
+				+ (zeros[j].rootImaginary - pole.rootImaginary) * (zeros[j].rootImaginary - pole.rootImaginary);
+			if (closest == zeros.size() || distance < closestDistance)
+			{
+				closest = j;
+				closestDistance = distance;
+			}
+		}
+
+		std::copy(zeros[closest].c, zeros[closest].c + 3, sections[i - 1].a);
+		used[closest] = true;
+		hasZeros[i - 1] = true;
+	}
+
+	// Remaining zeros go into sections without poles
+	i = 0;
+	for (j = 0; j < zeros.size(); j++)
+	{
+		if (used[j])
 			continue;
-		VVASEMath::sprintf(temp, tempSize, "%f", coefficients[i]);
-		if (!result.empty() && coefficients[i] > 0.0)
-			result.append("+");
-		result.append(temp);
-
-		if (coefficients.size() - 1 > i)
-			result.append("*" + negBilinTerm);
-		if (coefficients.size() - 1 > 1 + i)
+
+		while (hasZeros[i])
+			i++;
+		std::copy(zeros[j].c, zeros[j].c + 3, sections[i].a);
+		hasZeros[i] = true;
+	}
+
+	for (i = 0; i < 3; i++)
+		sections[0].a[i] *= gain;
+
+	ComputeUnitState();
+}
+
+//==========================================================================
+// Class:			Filter
+// Function:		GroupRoots (static)
+//
+// Description:		Groups roots into factors with real coefficients.
+//					Complex roots are paired with their conjugates and real
+//					roots are paired with their nearest neighbors.
+//
+// Input Arguments:
+//		roots	= const std::vector<Complex>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<Factor>
+//
+//==========================================================================
+std::vector<Filter::Factor> Filter::GroupRoots(const std::vector<Complex> &roots)
+{
+	const double tolerance(1.0e-8);
+	std::vector<Complex> complexRoots;
+	std::vector<double> realRoots;
+	unsigned int i, j;
+	for (i = 0; i < roots.size(); i++)
+	{
+		if (fabs(roots[i].imaginary) <= tolerance * std::max(1.0, fabs(roots[i].real)))
+			realRoots.push_back(roots[i].real);
+		else
+			complexRoots.push_back(roots[i]);
+	}
+
+	std::vector<Factor> factors;
+	std::vector<bool> paired(complexRoots.size(), false);
+	unsigned int partner;
+	double distance, partnerDistance;
+	for (i = 0; i < complexRoots.size(); i++)
+	{
+		if (paired[i])
+			continue;
+		paired[i] = true;
+
+		partner = complexRoots.size();
+		partnerDistance = 0.0;
+		for (j = i + 1; j < complexRoots.size(); j++)
 		{
-			VVASEMath::sprintf(temp, tempSize, "^%lu", coefficients.size() - i - 1);
-			result.append(temp);
+			if (paired[j])
+				continue;
+
+			distance = (complexRoots[j].real - complexRoots[i].real) * (complexRoots[j].real - complexRoots[i].real)
+				+ (complexRoots[j].imaginary + complexRoots[i].imaginary) * (complexRoots[j].imaginary + complexRoots[i].imaginary);
+			if (partner == complexRoots.size() || distance < partnerDistance)
+			{
+				partner = j;
+				partnerDistance = distance;
+			}
 		}
-		if (highestPower + i > coefficients.size() - 1)
-			result.append("*" + posBilinTerm);
-		if (highestPower + i > coefficients.size())
+
+		// Without a conjugate, the root must have been real after all
+		if (partner == complexRoots.size())
 		{
-			VVASEMath::sprintf(temp, tempSize, "^%lu", highestPower - coefficients.size() + 1 + i);
-			result.append(temp);
+			realRoots.push_back(complexRoots[i].real);
+			continue;
 		}
+
+		paired[partner] = true;
+		factors.push_back(MultiplyFactors(complexRoots[i], complexRoots[partner]));
 	}
 
-	return result;
+	std::sort(realRoots.begin(), realRoots.end());
+	for (i = 0; i + 1 < realRoots.size(); i += 2)
+		factors.push_back(MultiplyFactors(Complex(realRoots[i], 0.0), Complex(realRoots[i + 1], 0.0)));
+	if (i < realRoots.size())
+		factors.push_back(MultiplyFactors(Complex(realRoots[i], 0.0), Complex(0.0, 0.0)));
+
+	return factors;
 }
 
 //==========================================================================
 // Class:			Filter
-// Function:		operator=
+// Function:		MultiplyFactors (static)
 //
-// Description:		Assignment operator.
+// Description:		Multiplies two linear factors, (1 - root1 * z^-1) and
+//					(1 - root2 * z^-1).  A root of zero may be used to create
+//					a single linear factor.
 //
 // Input Arguments:
-//		f	=	const Filter&
+//		root1	= const Complex&
+//		root2	= const Complex&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		Filter&, reference to this
+//		Factor (the imaginary parts, which cancel for conjugate roots,
+//		are discarded)
 //
 //==========================================================================
-Filter& Filter::operator=(const Filter &f)
+Filter::Factor Filter::MultiplyFactors(const Complex &root1, const Complex &root2)
 {
-	if (this == &f)
-		return *this;
+	Factor factor;
+	factor.c[0] = 1.0;
+	factor.c[1] = -(root1 + root2).real;
+	factor.c[2] = (root1 * root2).real;
+
+	if (root1.real * root1.real + root1.imaginary * root1.imaginary
+		>= root2.real * root2.real + root2.imaginary * root2.imaginary)
+	{
+		factor.rootReal = root1.real;
+		factor.rootImaginary = root1.imaginary;
+	}
+	else
+	{
+		factor.rootReal = root2.real;
+		factor.rootImaginary = root2.imaginary;
+	}
 
-	DeleteArrays();
-	AllocateArrays(f.inSize, f.outSize);
+	return factor;
+}
 
+//==========================================================================
+// Class:			Filter
+// Function:		GetLeadingCoefficient (static)
+//
+// Description:		Returns the first non-zero coefficient of the polynomial.
+//
+// Input Arguments:
+//		coefficients	= const std::vector<double>&, highest power first
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double (zero if all coefficients are zero)
+//
+//==========================================================================
+double Filter::GetLeadingCoefficient(const std::vector<double> &coefficients)
+{
 	unsigned int i;
-	for (i = 0; i < inSize; i++)
+	for (i = 0; i < coefficients.size(); i++)
+	{
+		if (coefficients[i] != 0.0)
+			return coefficients[i];
+	}
+
+	return 0.0;
+}
+
+//==========================================================================
+// Class:			Filter
+// Function:		FindRoots (static)
+//
+// Description:		Finds the roots of the specified polynomial using the
+//					Durand-Kerner (Weierstrass) method.  Trailing zero
+//					coefficients are treated as exact roots at zero.
+//
+// Input Arguments:
+//		coefficients	= const std::vector<double>&, highest power first
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<Complex> (empty if all coefficients are zero)
+//
+//==========================================================================
+std::vector<Complex> Filter::FindRoots(const std::vector<double> &coefficients)
+{
+	std::vector<Complex> roots;
+	unsigned int first(0), last(coefficients.size());
+	while (first < last && coefficients[first] == 0.0)
+		first++;
+	while (last > first && coefficients[last - 1] == 0.0)
 	{
-		a[i] = f.a[i];
-		u[i] = f.u[i];
+		roots.push_back(Complex(0.0, 0.0));
+		last--;
 	}
 
-	for (i = 0; i < outSize; i++)
+	if (last - first < 2)
 	{
-		if (i < outSize - 1)
-			b[i] = f.b[i];
-		y[i] = f.y[i];
+		if (first == last)
+			roots.clear();
+		return roots;
 	}
 
-	return *this;
+	const unsigned int order(last - first - 1);
+	std::vector<double> monic(coefficients.begin() + first, coefficients.begin() + last);
+	unsigned int i, j;
+	double bound(0.0);
+	for (i = monic.size() - 1; i > 0; i--)
+	{
+		monic[i] /= monic[0];
+		bound = std::max(bound, fabs(monic[i]));
+	}
+	monic[0] = 1.0;
+
+	if (order == 1)
+	{
+		roots.push_back(Complex(-monic[1], 0.0));
+		return roots;
+	}
+
+	// Initial guesses are spread around a circle that contains all of the roots
+	const Complex seed(0.4, 0.9);
+	Complex guess(1.0 + bound, 0.0);
+	std::vector<Complex> estimates;
+	for (i = 0; i < order; i++)
+	{
+		estimates.push_back(guess);
+		guess *= seed;
+	}
+
+	const unsigned int maxIterations(1000);
+	const double epsilon(std::numeric_limits<double>::epsilon());
+	Complex value, product, correction;
+	bool converged(false);
+	unsigned int iteration;
+	for (iteration = 0; iteration < maxIterations && !converged; iteration++)
+	{
+		converged = true;
+		for (i = 0; i < order; i++)
+		{
+			value = Complex(1.0, 0.0);
+			product = Complex(1.0, 0.0);
+			for (j = 1; j < monic.size(); j++)
+				value = value * estimates[i] + monic[j];
+			for (j = 0; j < order; j++)
+			{
+				if (j != i)
+					product *= estimates[i] - estimates[j];
+			}
+
+			correction = value / product;
+			estimates[i] -= correction;
+			if (correction.real * correction.real + correction.imaginary * correction.imaginary
+				> epsilon * epsilon * (1.0 + estimates[i].real * estimates[i].real
+				+ estimates[i].imaginary * estimates[i].imaginary))
+				converged = false;
+		}
+	}
+
+	roots.insert(roots.end(), estimates.begin(), estimates.end());
+	return roots;
 }
 
 //==========================================================================
 // Class:			Filter
-// Function:		DeleteArrays
+// Function:		ComputeUnitState
 //
-// Description:		Deletes dynamically allocated memory for this object.
+// Description:		Computes the state of each section at steady state with a
+//					unit input to the filter.  The steady state for other
+//					inputs is found by scaling.
 //
 // Input Arguments:
 //		None
@@ -275,12 +563,56 @@ Filter& Filter::operator=(const Filter &f)
 //		None
 //
 //==========================================================================
-void Filter::DeleteArrays()
+void Filter::ComputeUnitState()
 {
-	delete [] a;
-	delete [] b;
-	delete [] y;
-	delete [] u;
+	unitState.resize(2 * sections.size());
+	state.resize(unitState.size());
+
+	double input(1.0), gain, denominator;
+	unsigned int i;
+	for (i = 0; i < sections.size(); i++)
+	{
+		const Section &s(sections[i]);
+		denominator = 1.0 + s.b[0] + s.b[1];
+		if (VVASEMath::IsZero(denominator))
+			gain = 0.0;
+		else
+			gain = (s.a[0] + s.a[1] + s.a[2]) / denominator;
+
+		unitState[2 * i + 1] = (s.a[2] - s.b[1] * gain) * input;
+		unitState[2 * i] = (s.a[1] - s.b[0] * gain) * input + unitState[2 * i + 1];
+		input *= gain;
+	}
+}
+
+//==========================================================================
+// Class:			Filter
+// Function:		operator=
+//
+// Description:		Assignment operator.
+//
+// Input Arguments:
+//		f	=	const Filter&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Filter&, reference to this
+//
+//==========================================================================
+Filter& Filter::operator=(const Filter &f)
+{
+	if (this == &f)
+		return *this;
+
+	sections = f.sections;
+	state = f.state;
+	unitState = f.unitState;
+	rawValue = f.rawValue;
+	filteredValue = f.filteredValue;
+
+	return *this;
 }
 
 //==========================================================================
@@ -302,11 +634,11 @@ void Filter::DeleteArrays()
 void Filter::Initialize(const double &initialValue)
 {
 	unsigned int i;
-	for (i = 0; i < inSize; i++)
-		u[i] = initialValue;
+	for (i = 0; i < state.size(); i++)
+		state[i] = unitState[i] * initialValue;
 
-	for (i = 0; i < outSize; i++)
-		y[i] = initialValue * ComputeSteadyStateGain();
+	rawValue = initialValue;
+	filteredValue = initialValue * ComputeSteadyStateGain();
 }
 
 //==========================================================================
@@ -327,72 +659,257 @@ void Filter::Initialize(const double &initialValue)
 //==========================================================================
 double Filter::Apply(const double &u)
 {
-	ShiftArray(this->u, inSize);
-	this->u[0] = u;
+	rawValue = u;
+	filteredValue = u;
 
-	ShiftArray(y, outSize);
-
-	y[0] = 0.0;
+	double y;
 	unsigned int i;
-	for (i = 0; i < inSize; i++)
-		y[0] += a[i] * this->u[i];
-	for (i = 1; i < outSize; i++)
-		y[0] -= b[i - 1] * y[i];
+	for (i = 0; i < sections.size(); i++)
+	{
+		const Section &s(sections[i]);
+		y = s.a[0] * filteredValue + state[2 * i];
+		state[2 * i] = s.a[1] * filteredValue - s.b[0] * y + state[2 * i + 1];
+		state[2 * i + 1] = s.a[2] * filteredValue - s.b[1] * y;
+		filteredValue = y;
+	}
 
-	return y[0];
+	return filteredValue;
 }
 
 //==========================================================================
 // Class:			Filter
-// Function:		ShiftArray
+// Function:		Apply
 //
-// Description:		Shifts the array values by one index (value with highest
-//					index is lost).
+// Description:		Applies the filter to a block of input values, continuing
+//					from the current state.
 //
 // Input Arguments:
-//		s		= double*
-//		size	= const unsigned int& indicating the size of the array
+//		in	= const double* (n long)
+//		n	= const unsigned int&
 //
 // Output Arguments:
+//		out	= double* (n long; may be the same as in)
+//
+// Return Value:
 //		None
 //
+//==========================================================================
+void Filter::Apply(const double *in, double *out, const unsigned int &n)
+{
+	if (n == 0)
+		return;
+
+	rawValue = in[n - 1];
+	FilterBlock(in, out, n, state.empty() ? NULL : &state.front());
+	filteredValue = out[n - 1];
+}
+
+//==========================================================================
+// Class:			Filter
+// Function:		ApplyZeroPhase
+//
+// Description:		Applies the filter forwards, then backwards, so that the
+//					phase lag of the filter cancels (the magnitude response is
+//					squared).  Each pass begins at steady state.
+//
+// Input Arguments:
+//		in	= const double* (n long)
+//		n	= const unsigned int&
+//
+// Output Arguments:
+//		out	= double* (n long; may be the same as in)
+//
 // Return Value:
 //		None
 //
 //==========================================================================
-void Filter::ShiftArray(double *s, const unsigned int &size)
+void Filter::ApplyZeroPhase(const double *in, double *out, const unsigned int &n) const
 {
+	if (n == 0)
+		return;
+
+	std::vector<double> passState(unitState.size());
 	unsigned int i;
-	for (i = size - 1; i > 0; i--)
-		s[i] = s[i - 1];
+	for (i = 0; i < passState.size(); i++)
+		passState[i] = unitState[i] * in[0];
+	FilterBlock(in, out, n, passState.empty() ? NULL : &passState.front());
+
+	std::reverse(out, out + n);
+	for (i = 0; i < passState.size(); i++)
+		passState[i] = unitState[i] * out[0];
+	FilterBlock(out, out, n, passState.empty() ? NULL : &passState.front());
+	std::reverse(out, out + n);
+}
+
+//==========================================================================
+// Class:			Filter
+// Function:		ApplyToChannels
+//
+// Description:		Filters several channels with the same coefficients (but
+//					independent states).  Groups of channels are processed
+//					together so the innermost loop runs across channels.
+//
+// Input Arguments:
+//		in				= const double* const* (channelCount arrays, n long)
+//		channelCount	= const unsigned int&
+//		n				= const unsigned int&
+//		zeroPhase		= const bool& indicating that each channel should
+//						  also be filtered backwards (as in ApplyZeroPhase)
+//
+// Output Arguments:
+//		out				= double* const* (channelCount arrays, n long; may
+//						  be the same as in)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Filter::ApplyToChannels(const double *const *in, double *const *out,
+	const unsigned int &channelCount, const unsigned int &n, const bool &zeroPhase) const
+{
+	unsigned int i;
+	for (i = 0; i < channelCount; i += channelLanes)
+	{
+		FilterChannelGroup(in + i, out + i, std::min(channelLanes, channelCount - i), n, false);
+		if (zeroPhase)
+			FilterChannelGroup(out + i, out + i, std::min(channelLanes, channelCount - i), n, true);
+	}
 }
 
 //==========================================================================
 // Class:			Filter
-// Function:		AllocateArrays
+// Function:		FilterBlock
 //
-// Description:		Allocates the coefficient and input/output storage arrays.
+// Description:		Applies the cascade to each sample of the block.  Unlike
+//					the single-sample Apply(), the state is kept in local
+//					variables (not member data) for the whole block.
 //
 // Input Arguments:
-//		_inSize		= const unsigned int&
-//		_outSize	= const unsigned int&
+//		in				= const double* (n long)
+//		n				= const unsigned int&
+//		sectionState	= double* (two for each section; updated)
 //
 // Output Arguments:
+//		out				= double* (n long; may be the same as in)
+//
+// Return Value:
 //		None
 //
+//==========================================================================
+void Filter::FilterBlock(const double *in, double *out, const unsigned int &n,
+	double *sectionState) const
+{
+	const unsigned int count(sections.size());
+	const Section *s(count > 0 ? &sections.front() : NULL);
+	std::vector<double> localState(sectionState, sectionState + 2 * count);
+	double *w(count > 0 ? &localState.front() : NULL);
+
+	double x, y;
+	unsigned int i, j;
+	for (i = 0; i < n; i++)
+	{
+		x = in[i];
+		for (j = 0; j < count; j++)
+		{
+			y = s[j].a[0] * x + w[2 * j];
+			w[2 * j] = s[j].a[1] * x - s[j].b[0] * y + w[2 * j + 1];
+			w[2 * j + 1] = s[j].a[2] * x - s[j].b[1] * y;
+			x = y;
+		}
+		out[i] = x;
+	}
+
+	std::copy(localState.begin(), localState.end(), sectionState);
+}
+
+//==========================================================================
+// Class:			Filter
+// Function:		FilterChannelGroup
+//
+// Description:		Filters up to channelLanes channels side by side.  Blocks
+//					of samples are interleaved into a working buffer (one
+//					lane per channel), every section is applied to the
+//					buffer, and the results are copied out.  Unused lanes
+//					contain zeros.
+//
+// Input Arguments:
+//		in				= const double* const* (channelCount arrays, n long)
+//		channelCount	= const unsigned int& (no more than channelLanes)
+//		n				= const unsigned int&
+//		reverse			= const bool& indicating that the channels should be
+//						  filtered from the last sample to the first
+//
+// Output Arguments:
+//		out				= double* const* (channelCount arrays, n long; may
+//						  be the same as in)
+//
 // Return Value:
 //		None
 //
 //==========================================================================
-void Filter::AllocateArrays(const unsigned int &inSize, const unsigned int &outSize)
+void Filter::FilterChannelGroup(const double *const *in, double *const *out,
+	const unsigned int &channelCount, const unsigned int &n, const bool &reverse) const
 {
-	this->inSize = inSize;
-	this->outSize = outSize;
+	assert(channelCount <= channelLanes);
+	if (n == 0)
+		return;
+
+	std::vector<double> buffer(channelBlockSize * channelLanes, 0.0);
+	std::vector<double> laneState(2 * sections.size() * channelLanes, 0.0);
+
+	unsigned int i, j, k;
+	for (i = 0; i < 2 * sections.size(); i++)
+	{
+		for (j = 0; j < channelCount; j++)
+			laneState[i * channelLanes + j] = unitState[i] * in[j][reverse ? n - 1 : 0];
+	}
+
+	unsigned int start, length, index;
+	double *x, s1[channelLanes], s2[channelLanes], y;
+	for (start = 0; start < n; start += channelBlockSize)
+	{
+		length = std::min(channelBlockSize, n - start);
+		for (j = 0; j < channelCount; j++)
+		{
+			for (k = 0; k < length; k++)
+			{
+				index = reverse ? n - 1 - start - k : start + k;
+				buffer[k * channelLanes + j] = in[j][index];
+			}
+		}
+
+		// Local copies of the state (and coefficients) keep the inner loop free of aliasing
+		for (i = 0; i < sections.size(); i++)
+		{
+			const double a0(sections[i].a[0]), a1(sections[i].a[1]), a2(sections[i].a[2]);
+			const double b0(sections[i].b[0]), b1(sections[i].b[1]);
+			std::copy(&laneState[2 * i * channelLanes], &laneState[(2 * i + 1) * channelLanes], s1);
+			std::copy(&laneState[(2 * i + 1) * channelLanes], &laneState[(2 * i + 2) * channelLanes], s2);
+			for (k = 0; k < length; k++)
+			{
+				x = &buffer[k * channelLanes];
+				for (j = 0; j < channelLanes; j++)
+				{
+					y = a0 * x[j] + s1[j];
+					s1[j] = a1 * x[j] - b0 * y + s2[j];
+					s2[j] = a2 * x[j] - b1 * y;
+					x[j] = y;
+				}
+			}
+
+			std::copy(s1, s1 + channelLanes, &laneState[2 * i * channelLanes]);
+			std::copy(s2, s2 + channelLanes, &laneState[(2 * i + 1) * channelLanes]);
+		}
 
-	a = new double[inSize];
-	b = new double[outSize - 1];
-	u = new double[inSize];
-	y = new double[outSize];
+		for (j = 0; j < channelCount; j++)
+		{
+			for (k = 0; k < length; k++)
+			{
+				index = reverse ? n - 1 - start - k : start + k;
+				out[j][index] = buffer[k * channelLanes + j];
+			}
+		}
+	}
 }
 
 //==========================================================================
@@ -601,13 +1118,16 @@ double Filter::ComputeSteadyStateGain(const std::string &num, const std::string
 //==========================================================================
 double Filter::ComputeSteadyStateGain() const
 {
-	double numeratorSum(0.0);
-	double denominatorSum(1.0);
+	double gain(1.0), denominator;
 	unsigned int i;
-	for (i = 0; i < inSize; i++)
-		numeratorSum += a[i];
-	for (i = 1; i < outSize; i++)
-		denominatorSum += b[i - 1];
+	for (i = 0; i < sections.size(); i++)
+	{
+		denominator = 1.0 + sections[i].b[0] + sections[i].b[1];
+		if (VVASEMath::IsZero(denominator))
+			return 0.0;
+
+		gain *= (sections[i].a[0] + sections[i].a[1] + sections[i].a[2]) / denominator;
+	}
 
-	return numeratorSum / denominatorSum;
+	return gain;
 }
\ No newline at end of file
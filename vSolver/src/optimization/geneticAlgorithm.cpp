@@ -19,6 +19,8 @@
 #include <cstdlib>
 #include <ctime>
 #include <algorithm>
+#include <vector>
+#include <cassert>
 
 // Local headers
 #include "vSolver/optimization/geneticAlgorithm.h"
@@ -48,6 +50,26 @@ GeneticAlgorithm::GeneticAlgorithm()
 	genomes = NULL;
 	numberOfPhenotypes = NULL;
 	fitnesses = NULL;
+	objectives = NULL;
+	bestGenomes = NULL;
+	bestFitnesses = NULL;
+	sortOrder = NULL;
+	sortGenomes = NULL;
+	keepAllGenerations = false;
+
+	numberOfIslands = 1;
+	migrationInterval = 10;
+	migrationCount = 1;
+	randomSeed = 0;
+	activeIslands = 1;
+	generators = NULL;
+
+	steadyState = false;
+	tournamentSize = 2;
+
+	multiObjective = false;
+	numberOfObjectives = 0;
+	paretoFrontSize = 0;
 
 	generationLimit = 0;
 	sortingMethod = SortMerge;
@@ -104,6 +126,119 @@ void GeneticAlgorithm::SetPopulationSize(int populationSize)
 		this->populationSize = populationSize;
 }
 
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SetKeepAllGenerations
+//
+// Description:		Sets whether every generation is stored, or only the
+//					current and previous generations (the best citizen from
+//					each generation is always stored).
+//
+// Input Arguments:
+//		keepAllGenerations	= bool
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::SetKeepAllGenerations(bool keepAllGenerations)
+{
+	DeleteDynamicMemory();
+
+	wxMutexLocker lock(gsaMutex);
+	this->keepAllGenerations = keepAllGenerations;
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SetIslands
+//
+// Description:		Sets the island model parameters.  With one island (the
+//					default), the whole population breeds together.  Each
+//					island must have at least two citizens, so fewer islands
+//					may be used for small populations.
+//
+// Input Arguments:
+//		numberOfIslands		= int
+//		migrationInterval	= int specifying the number of generations between
+//							  migrations (zero for no migration)
+//		migrationCount		= int specifying the number of citizens each island
+//							  sends to the next island during a migration
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::SetIslands(int numberOfIslands, int migrationInterval, int migrationCount)
+{
+	wxMutexLocker lock(gsaMutex);
+
+	this->numberOfIslands = std::max(numberOfIslands, 1);
+	this->migrationInterval = std::max(migrationInterval, 0);
+	this->migrationCount = std::max(migrationCount, 0);
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SetSteadyState
+//
+// Description:		Sets whether the algorithm runs in steady-state mode.  In
+//					this mode, there is no barrier between generations - a
+//					new child is bred as soon as any evaluation completes,
+//					and the child replaces the least fit of tournamentSize
+//					randomly chosen citizens if the child is more fit.
+//
+// Input Arguments:
+//		steadyState		= bool
+//		tournamentSize	= int specifying the number of citizens competing in
+//						  each parent selection and replacement tournament
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::SetSteadyState(bool steadyState, int tournamentSize)
+{
+	wxMutexLocker lock(gsaMutex);
+
+	this->steadyState = steadyState;
+	this->tournamentSize = std::max(tournamentSize, 1);
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SetMultiObjective
+//
+// Description:		Sets whether the algorithm runs in multi-objective
+//					(NSGA-II) mode.
+//
+// Input Arguments:
+//		multiObjective	= bool
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::SetMultiObjective(bool multiObjective)
+{
+	DeleteDynamicMemory();
+
+	wxMutexLocker lock(gsaMutex);
+	this->multiObjective = multiObjective;
+}
+
 //==========================================================================
 // Class:			GeneticAlgorithm
 // Function:		SetGenerationLimit
@@ -266,6 +401,7 @@ void GeneticAlgorithm::InitializeAlgorithm(int populationSize, int generationLim
 	DebugLog::GetInstance()->Log(_T("GeneticAlgorithm::InitializeAlgorithm (locker)"));
 
 	currentGeneration = -1;
+	paretoFrontSize = 0;
 
 	// Handle the memory allocation
 	if (numberOfGenes > 0 && numberOfPhenotypes)
@@ -281,21 +417,21 @@ void GeneticAlgorithm::InitializeAlgorithm(int populationSize, int generationLim
 		// allocate memory for the genomes and fitnesses
 		if (generationLimit > 0 && populationSize > 0)
 		{
-			// Allocate memory for the top level of pointers
-			genomes = new int**[generationLimit];
-			fitnesses = new double*[generationLimit];
+			const int storedGenerations(keepAllGenerations ? generationLimit : std::min(generationLimit, 2));
+			genomes = new int[storedGenerations * populationSize * numberOfGenes];
+			fitnesses = new double[storedGenerations * populationSize];
 
-			// Allocate memory for the genomes and fitnesses within each generation
-			for (i = 0; i < generationLimit; i++)
+			if (multiObjective)
 			{
-				genomes[i] = new int*[populationSize];
-				fitnesses[i] = new double[populationSize];
-
-				// Allocate the memory for each gene for each citizen
-				int j;
-				for (j = 0; j < populationSize; j++)
-					genomes[i][j] = new int[numberOfGenes];
+				numberOfObjectives = std::max(GetNumberOfObjectives(), 1);
+				objectives = new double[storedGenerations * populationSize * numberOfObjectives];
 			}
+
+			bestGenomes = new int[generationLimit * numberOfGenes];
+			bestFitnesses = new double[generationLimit];
+
+			sortOrder = new int[populationSize];
+			sortGenomes = new int[populationSize * numberOfGenes];
 		}
 	}
 }
@@ -319,10 +455,18 @@ void GeneticAlgorithm::InitializeAlgorithm(int populationSize, int generationLim
 void GeneticAlgorithm::SimulateGeneration()
 {
 	// Determine the fitness for each genome in this generation
+	double *currentFitnesses(GetFitnesses(currentGeneration));
 	int currentCitizen;
 	for (currentCitizen = 0; currentCitizen < populationSize; currentCitizen++)
-		fitnesses[currentGeneration][currentCitizen] =
-			DetermineFitness(genomes[currentGeneration][currentCitizen]);
+		currentFitnesses[currentCitizen] =
+			DetermineFitness(GetGenome(currentGeneration, currentCitizen));
+
+	if (!multiObjective)
+		return;
+
+	for (currentCitizen = 0; currentCitizen < populationSize; currentCitizen++)
+		DetermineObjectives(GetGenome(currentGeneration, currentCitizen),
+			GetObjectives(currentGeneration) + currentCitizen * numberOfObjectives);
 }
 
 //==========================================================================
@@ -350,6 +494,24 @@ bool GeneticAlgorithm::PerformOptimization()
 	if (numberOfGenes == 0 || !numberOfPhenotypes || !genomes)
 		return false;
 
+	if (multiObjective)
+	{
+		PerformMultiObjectiveOptimization();
+		return true;
+	}
+
+	if (steadyState)
+	{
+		PerformSteadyStateOptimization();
+		return true;
+	}
+
+	if (numberOfIslands > 1 && EvaluatesIslandsSeparately())
+	{
+		PerformIslandOptimization();
+		return true;
+	}
+
 	bool stopFlag = false;
 
 	while (!stopFlag && currentGeneration + 1 < generationLimit)
@@ -358,6 +520,11 @@ bool GeneticAlgorithm::PerformOptimization()
 		Breed();
 		SimulateGeneration();
 		SortByFitness();
+
+		if (IsMigrationGeneration(currentGeneration))
+			MigrateCitizens();
+
+		RecordBestCitizen();
 		PerformAdditionalActions();
 	}
 
@@ -368,7 +535,8 @@ bool GeneticAlgorithm::PerformOptimization()
 // Class:			GeneticAlgorithm
 // Function:		CreateFirstGeneration
 //
-// Description:		Randomly creates the first generation's genomes.
+// Description:		Seeds the random number generators and randomly creates
+//					the first generation's genomes.
 //
 // Input Arguments:
 //		None
@@ -382,16 +550,36 @@ bool GeneticAlgorithm::PerformOptimization()
 //==========================================================================
 void GeneticAlgorithm::CreateFirstGeneration()
 {
-	srand((unsigned int)time(NULL));
+	// Islands are not used in steady-state or multi-objective mode
+	if (steadyState || multiObjective)
+		activeIslands = 1;
+	else
+		activeIslands = std::max(1, std::min(numberOfIslands, populationSize / 2));
+
+	// Each island gets its own stream, so the results do not depend on the order
+	// in which the islands are processed
+	const unsigned int seed(randomSeed == 0 ? (unsigned int)time(NULL) : randomSeed);
+	delete [] generators;
+	generators = new std::mt19937[activeIslands];
+
+	int i;
+	for (i = 0; i < activeIslands; i++)
+	{
+		std::seed_seq sequence = { seed, (unsigned int)i };
+		generators[i].seed(sequence);
+	}
 
 	// For each citizen in the first generation, go through the process of creating a genome
 	int currentCitizen, currentGene;
-	for (currentCitizen = 0; currentCitizen < populationSize; currentCitizen++)
+	for (i = 0; i < activeIslands; i++)
 	{
-		// For each gene in the genome, get a random value that is within the range.
-		// (rand() % limit)  will give an integer between 0 and limit - 1.
-		for (currentGene = 0; currentGene < numberOfGenes; currentGene++)
-			genomes[0][currentCitizen][currentGene] = rand() % numberOfPhenotypes[currentGene];
+		for (currentCitizen = GetIslandStart(i); currentCitizen < GetIslandStart(i + 1); currentCitizen++)
+		{
+			// For each gene in the genome, get a random value that is within the range.
+			for (currentGene = 0; currentGene < numberOfGenes; currentGene++)
+				GetGenome(0, currentCitizen)[currentGene] =
+					RandomInteger(generators[i], numberOfPhenotypes[currentGene]);
+		}
 	}
 }
 
@@ -422,23 +610,133 @@ void GeneticAlgorithm::Breed()
 		return;
 	}
 
+	// Each island breeds only with itself
+	int i;
+	for (i = 0; i < activeIslands; i++)
+		BreedIsland(currentGeneration, i);
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		PerformIslandOptimization
+//
+// Description:		Main run loop for the island model.  Rather than waiting
+//					for the whole generation to be evaluated, each island is
+//					sorted, bred and evaluated again as soon as its own
+//					evaluations complete.  An island may only start a
+//					generation once every island has completed the
+//					generation before its parents' generation (only two
+//					generations are stored), and no island passes a
+//					migration until every island has reached it, so the
+//					results do not depend on the order in which the islands
+//					complete.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::PerformIslandOptimization()
+{
+	currentGeneration = 0;
+	CreateFirstGeneration();
+
+	// The generation each island is evaluating (or has most recently completed)
+	std::vector<int> islandGeneration(activeIslands, 0);
+	std::vector<bool> islandWaiting(activeIslands, false);
+	std::vector<int> completedCount(generationLimit, 0);
+
+	int island;
+	for (island = 0; island < activeIslands; island++)
+		BeginIslandEvaluation(0, island, GetIslandStart(island),
+			GetIslandStart(island + 1) - GetIslandStart(island));
+
+	int generation, completedGeneration(-1);
+	while (completedGeneration + 1 < generationLimit)
+	{
+		island = WaitForIslandEvaluation();
+		SortIsland(islandGeneration[island], island);
+		completedCount[islandGeneration[island]]++;
+		islandWaiting[island] = true;
+
+		// Generations are completed in order, once every island has been evaluated
+		while (completedGeneration + 1 < generationLimit &&
+			completedCount[completedGeneration + 1] == activeIslands)
+		{
+			currentGeneration = ++completedGeneration;
+			if (IsMigrationGeneration(currentGeneration))
+				MigrateCitizens();
+
+			RecordBestCitizen();
+			PerformAdditionalActions();
+		}
+
+		// Start the next generation on every island that is allowed to proceed
+		// (always in island order)
+		for (island = 0; island < activeIslands; island++)
+		{
+			generation = islandGeneration[island] + 1;
+			if (!islandWaiting[island] || generation >= generationLimit ||
+				completedGeneration < generation - 2 ||
+				(IsMigrationGeneration(generation - 1) && completedGeneration < generation - 1))
+				continue;
+
+			islandWaiting[island] = false;
+			islandGeneration[island] = generation;
+			BreedIsland(generation, island);
+			BeginIslandEvaluation(generation, island, GetIslandStart(island),
+				GetIslandStart(island + 1) - GetIslandStart(island));
+		}
+	}
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		BreedIsland
+//
+// Description:		Breeds within one island of the previous generation to
+//					create the same island in the specified generation.  The
+//					island must be sorted by fitness.
+//
+// Input Arguments:
+//		generation	= const int& the generation to create
+//		island		= const int& the island to breed
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::BreedIsland(const int &generation, const int &island)
+{
+	const int first(GetIslandStart(island));
+	const int size(GetIslandStart(island + 1) - first);
+	std::mt19937 &generator(generators[island]);
+
 	// Perform the breeding
 	int i, geneToMutate, /*randomCrossover,*/ numberOfOffspring = 0;
 	bool spawnTwoChildren;
-	while (numberOfOffspring < populationSize)
+	while (numberOfOffspring < size)
 	{
 		// Look at elitism first - if we don't have the "elite" citizens in the new
 		// generation, grab them now
-		if (numberOfOffspring < ceil(elitism * populationSize))
+		if (numberOfOffspring < ceil(elitism * size))
 		{
 			for (i = 0; i < numberOfGenes; i++)
-				genomes[currentGeneration][numberOfOffspring][i] =
-					genomes[currentGeneration - 1][numberOfOffspring][i];
+				GetGenome(generation, first + numberOfOffspring)[i] =
+					GetGenome(generation - 1, first + numberOfOffspring)[i];
 		}
 		else// Not a direct copy of a previous citizen
 		{
 			// If there is room for at least two more children in the new generation, spawn two children
-			if (populationSize - numberOfOffspring > 1)
+			if (size - numberOfOffspring > 1)
 				spawnTwoChildren = true;
 			else
 				spawnTwoChildren = false;
@@ -448,7 +746,7 @@ void GeneticAlgorithm::Breed()
 
 			// The father is determined by the index, the mother is determined
 			// randomly (but must not match the father).  Find the mother.
-			int mother = rand() % int(populationSize / 2.0);
+			int mother = RandomInteger(generator, int(size / 2.0));
 			if (numberOfOffspring == 0 && numberOfOffspring == mother)
 				mother += 1;
 			else if (numberOfOffspring == mother)
@@ -469,28 +767,28 @@ void GeneticAlgorithm::Breed()
 					for (i = 0; i < numberOfGenes; i++)
 					{
 						// If the roll is less than 50%, take the gene from the father
-						if ((rand() % 2 == 0 && genesFromDad < 0.5 * numberOfGenes) ||
+						if ((RandomInteger(generator, 2) == 0 && genesFromDad < 0.5 * numberOfGenes) ||
 							i - genesFromDad > 0.5 * numberOfGenes)
 						{
 							genesFromDad++;
 
 							// The first child gets this gene from the father
-							genomes[currentGeneration][numberOfOffspring][i] =
-								genomes[currentGeneration - 1][numberOfOffspring][i];
+							GetGenome(generation, first + numberOfOffspring)[i] =
+								GetGenome(generation - 1, first + numberOfOffspring)[i];
 
 							// The second child gets this gene from the mother
-							genomes[currentGeneration][numberOfOffspring + 1][i] =
-								genomes[currentGeneration - 1][mother][i];
+							GetGenome(generation, first + numberOfOffspring + 1)[i] =
+								GetGenome(generation - 1, first + mother)[i];
 						}
 						else// This gene come from the mother
 						{
 							// The first child gets this gene from the mother
-							genomes[currentGeneration][numberOfOffspring][i] =
-								genomes[currentGeneration - 1][mother][i];
+							GetGenome(generation, first + numberOfOffspring)[i] =
+								GetGenome(generation - 1, first + mother)[i];
 
 							// The second child gets this gene from the father
-							genomes[currentGeneration][numberOfOffspring + 1][i] =
-								genomes[currentGeneration - 1][numberOfOffspring][i];
+							GetGenome(generation, first + numberOfOffspring + 1)[i] =
+								GetGenome(generation - 1, first + numberOfOffspring)[i];
 						}
 					}
 				}
@@ -500,34 +798,34 @@ void GeneticAlgorithm::Breed()
 					for (i = 0; i < numberOfGenes; i++)
 					{
 						// If the roll is less than 50%, take the gene from the father
-						if ((rand() % 2 == 0 && genesFromDad < 0.5 * numberOfGenes) ||
+						if ((RandomInteger(generator, 2) == 0 && genesFromDad < 0.5 * numberOfGenes) ||
 							i - genesFromDad > 0.5 * numberOfGenes)
 						{
 							genesFromDad++;
-							genomes[currentGeneration][numberOfOffspring][i] =
-								genomes[currentGeneration - 1][numberOfOffspring][i];
+							GetGenome(generation, first + numberOfOffspring)[i] =
+								GetGenome(generation - 1, first + numberOfOffspring)[i];
 						}
 						else// This gene come from the mother
-							genomes[currentGeneration][numberOfOffspring][i] =
-								genomes[currentGeneration - 1][mother][i];
+							GetGenome(generation, first + numberOfOffspring)[i] =
+								GetGenome(generation - 1, first + mother)[i];
 					}
 				}
 			}
 			/*else if (crossover == numberOfGenes)// Random crossover point
 			{
 				// Determine the crossover point to use for this offspring
-				randomCrossover = rand() % numberOfGenes;
+				randomCrossover = RandomInteger(generator, numberOfGenes);
 
 				// For each gene, see if the gene will come from the mother or father
 				for (i = 0; i < numberOfGenes; i++)
 				{
 					// If the current gene is before the crossover point, it comes from the father
 					if (i < randomCrossover)
-						genomes[currentGeneration][numberOfOffspring][i] =
-							genomes[currentGeneration - 1][numberOfOffspring][i];
+						GetGenome(generation, first + numberOfOffspring)[i] =
+							GetGenome(generation - 1, first + numberOfOffspring)[i];
 					else// The gene comes from the mother
-						genomes[currentGeneration][numberOfOffspring][i] =
-							genomes[currentGeneration - 1][mother][i];
+						GetGenome(generation, first + numberOfOffspring)[i] =
+							GetGenome(generation - 1, first + mother)[i];
 				}
 
 				// Determine if we should repeat for a second child
@@ -538,11 +836,11 @@ void GeneticAlgorithm::Breed()
 					{
 						// If the current gene is before the crossover point, it comes from the father
 						if (i < randomCrossover)
-							genomes[currentGeneration][numberOfOffspring + 1][i] =
-								genomes[currentGeneration - 1][numberOfOffspring][i];
+							GetGenome(generation, first + numberOfOffspring + 1)[i] =
+								GetGenome(generation - 1, first + numberOfOffspring)[i];
 						else// The gene comes from the mother
-							genomes[currentGeneration][numberOfOffspring + 1][i] =
-								genomes[currentGeneration - 1][mother][i];
+							GetGenome(generation, first + numberOfOffspring + 1)[i] =
+								GetGenome(generation - 1, first + mother)[i];
 					}
 				}
 			}*/
@@ -553,11 +851,11 @@ void GeneticAlgorithm::Breed()
 				{
 					// If the current gene is before the crossover point, it comes from the father
 					if (i < crossover)
-						genomes[currentGeneration][numberOfOffspring][i] =
-							genomes[currentGeneration - 1][numberOfOffspring][i];
+						GetGenome(generation, first + numberOfOffspring)[i] =
+							GetGenome(generation - 1, first + numberOfOffspring)[i];
 					else// The gene comes from the mother
-						genomes[currentGeneration][numberOfOffspring][i] =
-							genomes[currentGeneration - 1][mother][i];
+						GetGenome(generation, first + numberOfOffspring)[i] =
+							GetGenome(generation - 1, first + mother)[i];
 				}
 
 				// Determine if we should repeat for a second child
@@ -568,11 +866,11 @@ void GeneticAlgorithm::Breed()
 					{
 						// If the current gene is before the crossover point, it comes from the father
 						if (i < crossover)
-							genomes[currentGeneration][numberOfOffspring + 1][i] =
-								genomes[currentGeneration - 1][numberOfOffspring][i];
+							GetGenome(generation, first + numberOfOffspring + 1)[i] =
+								GetGenome(generation - 1, first + numberOfOffspring)[i];
 						else// The gene comes from the mother
-							genomes[currentGeneration][numberOfOffspring + 1][i] =
-								genomes[currentGeneration - 1][mother][i];
+							GetGenome(generation, first + numberOfOffspring + 1)[i] =
+								GetGenome(generation - 1, first + mother)[i];
 					}
 				}
 			}
@@ -581,24 +879,24 @@ void GeneticAlgorithm::Breed()
 			if (mutation > 0.0)
 			{
 				// Determine if a mutation occured
-				if (rand() % 100 + 1 < int(mutation * 100.0))
+				if (RandomInteger(generator, 100) + 1 < int(mutation * 100.0))
 				{
 					// Mutate a random gene from this genome
-					geneToMutate = rand() % numberOfGenes;
-					genomes[currentGeneration][numberOfOffspring][geneToMutate] =
-						rand() % numberOfPhenotypes[geneToMutate];
+					geneToMutate = RandomInteger(generator, numberOfGenes);
+					GetGenome(generation, first + numberOfOffspring)[geneToMutate] =
+						RandomInteger(generator, numberOfPhenotypes[geneToMutate]);
 				}
 
 				// If we had two children, check for another chance of mutation
 				if (spawnTwoChildren)
 				{
 					// Determine if the second child should be mutated as well
-					if (rand() % 100 + 1 < int(mutation * 100.0))
+					if (RandomInteger(generator, 100) + 1 < int(mutation * 100.0))
 					{
 						// Mutate a random gene from the second child's genome
-						geneToMutate = rand() % numberOfGenes;
-						genomes[currentGeneration][numberOfOffspring + 1][geneToMutate] =
-							rand() % numberOfPhenotypes[geneToMutate];
+						geneToMutate = RandomInteger(generator, numberOfGenes);
+						GetGenome(generation, first + numberOfOffspring + 1)[geneToMutate] =
+							RandomInteger(generator, numberOfPhenotypes[geneToMutate]);
 					}
 				}
 			}
@@ -617,9 +915,7 @@ void GeneticAlgorithm::Breed()
 // Class:			GeneticAlgorithm
 // Function:		SortByFitness
 //
-// Description:		Sorts the specified generation by fitness.  The Minimize
-//					flag is checked to determine how to sort (high to low or
-//					low to high).
+// Description:		Sorts each island in the current generation by fitness.
 //
 // Input Arguments:
 //		None
@@ -633,29 +929,76 @@ void GeneticAlgorithm::Breed()
 //==========================================================================
 void GeneticAlgorithm::SortByFitness()
 {
+	// Each island is sorted separately (citizens never leave their island here)
+	int island;
+	for (island = 0; island < activeIslands; island++)
+		SortIsland(currentGeneration, island);
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SortIsland
+//
+// Description:		Sorts one island in the specified generation by fitness.
+//					The Minimize flag is checked to determine how to sort
+//					(high to low or low to high).  Only the island's part of
+//					the sorting arrays is used.
+//
+// Input Arguments:
+//		generation	= const int& the generation to sort
+//		island		= const int& the island to sort
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::SortIsland(const int &generation, const int &island)
+{
+	const int first(GetIslandStart(island));
+	const int last(GetIslandStart(island + 1));
+
+	int i;
+	for (i = first; i < last; i++)
+		sortOrder[i] = i;
+
 	// Use the algorithm specified by the SortingMethod variable
+	double *currentFitnesses(GetFitnesses(generation));
 	switch (sortingMethod)
 	{
 	case SortSelection:
-		SelectionSort(fitnesses[currentGeneration], genomes[currentGeneration], populationSize);
+		SelectionSort(currentFitnesses + first, sortOrder + first, last - first);
 		break;
 
 	case SortQuicksort:
-		Quicksort(fitnesses[currentGeneration], genomes[currentGeneration], populationSize);
+		Quicksort(currentFitnesses + first, sortOrder + first, last - first);
 		break;
 
 	case SortMerge:
 	default:
-		MergeSort(fitnesses[currentGeneration], genomes[currentGeneration], populationSize);
+		MergeSort(currentFitnesses + first, sortOrder + first, last - first);
 		break;
 	}
+
+	// Re-arrange the genomes to match (each genome is moved exactly once)
+	const int *currentGenome;
+	for (i = first; i < last; i++)
+	{
+		currentGenome = GetGenome(generation, sortOrder[i]);
+		std::copy(currentGenome, currentGenome + numberOfGenes, sortGenomes + i * numberOfGenes);
+	}
+	std::copy(sortGenomes + first * numberOfGenes, sortGenomes + last * numberOfGenes,
+		GetGenome(generation, first));
 }
 
 //==========================================================================
 // Class:			GeneticAlgorithm
-// Function:		DeleteDynamicMemory
+// Function:		RecordBestCitizen
 //
-// Description:		Deletes dynamically allocated memory.
+// Description:		Stores the best citizen from the current generation.  Must
+//					be called after the generation has been sorted.
 //
 // Input Arguments:
 //		None
@@ -667,48 +1010,41 @@ void GeneticAlgorithm::SortByFitness()
 //		None
 //
 //==========================================================================
-void GeneticAlgorithm::DeleteDynamicMemory()
+void GeneticAlgorithm::RecordBestCitizen()
 {
-	wxMutexLocker lock(gsaMutex);
-	DebugLog::GetInstance()->Log(_T("GeneticAlgorithm::DeleteDynamicMemory (locker)"));
-
-	// Delete the old genomes and fitnesses (if they exist)
-	// Here we make the assumption that if and only if the genomes exist,
-	// everything else exists, too
-	int i, j;
-	if (genomes)
+	// The best citizen is the first citizen of one of the islands (in multi-objective
+	// mode, the generation is not sorted by fitness, so every citizen is checked)
+	const double *currentFitnesses(GetFitnesses(currentGeneration));
+	int i, best(0);
+	if (multiObjective)
 	{
-		for (i = 0; i < generationLimit; i++)
+		for (i = 1; i < populationSize; i++)
 		{
-			// Delete the genomes for each citizen in this generation
-			for (j = 0; j < populationSize; j++)
-			{
-				delete [] genomes[i][j];
-				genomes[i][j] = NULL;
-			}
-			delete [] genomes[i];
-			genomes[i] = NULL;
-
-			// Delete the fitnesses
-			delete [] fitnesses[i];
-			fitnesses[i] = NULL;
+			if (IsMoreFit(currentFitnesses[i], currentFitnesses[best]))
+				best = i;
 		}
-		delete [] genomes;
-		genomes = NULL;
-		delete [] fitnesses;
-		fitnesses = NULL;
-
-		// Delete the number of phenotypes
-		delete [] numberOfPhenotypes;
-		numberOfPhenotypes = NULL;
 	}
+
+	for (i = 1; i < activeIslands; i++)
+	{
+		if ((currentFitnesses[GetIslandStart(i)] > currentFitnesses[best] && !minimize) ||
+			(currentFitnesses[GetIslandStart(i)] < currentFitnesses[best] && minimize))
+			best = GetIslandStart(i);
+	}
+
+	const int *bestGenome(GetGenome(currentGeneration, best));
+	std::copy(bestGenome, bestGenome + numberOfGenes, bestGenomes + currentGeneration * numberOfGenes);
+	bestFitnesses[currentGeneration] = currentFitnesses[best];
 }
 
 //==========================================================================
 // Class:			GeneticAlgorithm
-// Function:		PerformAdditionalActions
+// Function:		MigrateCitizens
 //
-// Description:		Performs any additional actions required (to be overridden).
+// Description:		Copies the best citizens from each island over the worst
+//					citizens of the next island (ring topology), then
+//					re-sorts the islands.  Must be called after the
+//					generation has been sorted.
 //
 // Input Arguments:
 //		None
@@ -720,24 +1056,58 @@ void GeneticAlgorithm::DeleteDynamicMemory()
 //		None
 //
 //==========================================================================
-void GeneticAlgorithm::PerformAdditionalActions()
+void GeneticAlgorithm::MigrateCitizens()
 {
+	// Never replace more than half of an island
+	int i, count(migrationCount);
+	for (i = 0; i < activeIslands; i++)
+		count = std::min(count, (GetIslandStart(i + 1) - GetIslandStart(i)) / 2);
+
+	if (count == 0)
+		return;
+
+	// Collect all of the migrants before any island is modified
+	double *currentFitnesses(GetFitnesses(currentGeneration));
+	double *migrantFitnesses = new double[activeIslands * count];
+	int *migrantGenomes = new int[activeIslands * count * numberOfGenes];
+
+	int j;
+	for (i = 0; i < activeIslands; i++)
+	{
+		std::copy(currentFitnesses + GetIslandStart(i), currentFitnesses + GetIslandStart(i) + count,
+			migrantFitnesses + i * count);
+		std::copy(GetGenome(currentGeneration, GetIslandStart(i)),
+			GetGenome(currentGeneration, GetIslandStart(i) + count),
+			migrantGenomes + i * count * numberOfGenes);
+	}
+
+	int destination;
+	for (i = 0; i < activeIslands; i++)
+	{
+		destination = GetIslandStart((i + 1) % activeIslands + 1) - count;
+		for (j = 0; j < count; j++)
+		{
+			currentFitnesses[destination + j] = migrantFitnesses[i * count + j];
+			std::copy(migrantGenomes + (i * count + j) * numberOfGenes,
+				migrantGenomes + (i * count + j + 1) * numberOfGenes,
+				GetGenome(currentGeneration, destination + j));
+		}
+	}
+
+	delete [] migrantFitnesses;
+	delete [] migrantGenomes;
+
+	SortByFitness();
 }
 
 //==========================================================================
 // Class:			GeneticAlgorithm
-// Function:		SelectionSort
+// Function:		DeleteDynamicMemory
 //
-// Description:		Sorts the fitnesses and genomes by fitness using a
-//					selection sort algorithm.
+// Description:		Deletes dynamically allocated memory.
 //
 // Input Arguments:
-//		fitnessArray	= double* pointing to the list of values to sort
-//		genomeArray		= int** pointing to the list of genomes - these
-//						  values are not used in the sorting process, but
-//						  they must be sorted along with the corresponding
-//						  fitness value
-//		arraySize		= const int specifying the length of the array
+//		None
 //
 // Output Arguments:
 //		None
@@ -746,64 +1116,468 @@ void GeneticAlgorithm::PerformAdditionalActions()
 //		None
 //
 //==========================================================================
-void GeneticAlgorithm::SelectionSort(double *fitnessArray, int **genomeArray,
-									  const int arraySize)
+void GeneticAlgorithm::DeleteDynamicMemory()
 {
-	// We will need to find the minimum or maximum value and swap it with
-	// the next element in the list.
-	int bestIndex, i, swapGene;
-	double swapFitness;
+	wxMutexLocker lock(gsaMutex);
+	DebugLog::GetInstance()->Log(_T("GeneticAlgorithm::DeleteDynamicMemory (locker)"));
 
-	// Repeat this procedure until the list is sorted
-	int sortIndex = 0;
-	while (sortIndex < arraySize)
-	{
-		// Initialize bestIndex
-		bestIndex = sortIndex;
+	// Delete the old genomes and fitnesses (if they exist)
+	delete [] genomes;
+	genomes = NULL;
+	delete [] fitnesses;
+	fitnesses = NULL;
+	delete [] objectives;
+	objectives = NULL;
 
-		// Go through the list and find the next best value
-		for (i = sortIndex; i < arraySize; i ++)
-		{
-			// This depends on whether we're finding minimums or maximums
-			if ((fitnessArray[i] > fitnessArray[bestIndex] && !minimize) ||
-				(fitnessArray[i] < fitnessArray[bestIndex] && minimize))
-				bestIndex = i;
-		}
+	delete [] bestGenomes;
+	bestGenomes = NULL;
+	delete [] bestFitnesses;
+	bestFitnesses = NULL;
 
-		// Swap the next best value with the current element in the list
-		swapFitness = fitnessArray[sortIndex];
-		fitnessArray[sortIndex] = fitnessArray[bestIndex];
-		fitnessArray[bestIndex] = swapFitness;
+	delete [] sortOrder;
+	sortOrder = NULL;
+	delete [] sortGenomes;
+	sortGenomes = NULL;
 
-		// Use a for loop to swap the genomes
-		for (i = 0; i < numberOfGenes; i++)
-		{
-			swapGene = genomeArray[sortIndex][i];
-			genomeArray[sortIndex][i] = genomeArray[bestIndex][i];
-			genomeArray[bestIndex][i] = swapGene;
-		}
+	delete [] generators;
+	generators = NULL;
 
-		// Increment the sort index
-		sortIndex++;
-	}
+	// Delete the number of phenotypes
+	delete [] numberOfPhenotypes;
+	numberOfPhenotypes = NULL;
 }
 
 //==========================================================================
 // Class:			GeneticAlgorithm
-// Function:		MergeSort
+// Function:		PerformAdditionalActions
 //
-// Description:		Sorts the fitnesses and genomes by fitness using a
-//					merge sort algorithm.
+// Description:		Performs any additional actions required (to be overridden).
 //
 // Input Arguments:
-//		fitnessArray	= double* pointing to the list of values to sort
-//		genomeArray		= int** pointing to the list of genomes - these
-//						  values are not used in the sorting process, but
-//						  they must be sorted along with the corresponding
-//						  fitness value
-//		arraySize		= const int specifying the length of the array
-//						  (can be different from PopulationSize in the case
-//						  of recursive calls)
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::PerformAdditionalActions()
+{
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		BeginEvaluation
+//
+// Description:		Starts evaluating the fitness of a steady-state child.  The
+//					default implementation evaluates the child immediately.
+//
+// Input Arguments:
+//		slot	= const unsigned int& identifying this evaluation (less than
+//				  GetMaximumPendingEvaluations())
+//		genome	= const int* pointing to the child's genome
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::BeginEvaluation(const unsigned int &slot, const int *genome)
+{
+	completedEvaluations.push_back(std::make_pair(slot, DetermineFitness(genome)));
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		WaitForEvaluation
+//
+// Description:		Waits for any pending steady-state evaluation to complete.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		fitness	= double& containing the fitness of the evaluated child
+//
+// Return Value:
+//		unsigned int, slot of the completed evaluation
+//
+//==========================================================================
+unsigned int GeneticAlgorithm::WaitForEvaluation(double &fitness)
+{
+	assert(!completedEvaluations.empty());
+
+	const unsigned int slot(completedEvaluations.front().first);
+	fitness = completedEvaluations.front().second;
+	completedEvaluations.pop_front();
+
+	return slot;
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		BeginIslandEvaluation
+//
+// Description:		Starts evaluating the fitnesses of one island.  The default
+//					implementation evaluates the island immediately.
+//
+// Input Arguments:
+//		generation	= const int& the generation containing the island
+//		island		= const int& the island to evaluate
+//		first		= const int& index of the first citizen in the island
+//		size		= const int& number of citizens in the island
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::BeginIslandEvaluation(const int &generation, const int &island,
+	const int &first, const int &size)
+{
+	double *currentFitnesses(GetFitnesses(generation));
+	int currentCitizen;
+	for (currentCitizen = first; currentCitizen < first + size; currentCitizen++)
+		currentFitnesses[currentCitizen] = DetermineFitness(GetGenome(generation, currentCitizen));
+
+	completedIslands.push_back(island);
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		WaitForIslandEvaluation
+//
+// Description:		Waits for the evaluation of any pending island to complete.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, the island whose evaluation completed
+//
+//==========================================================================
+int GeneticAlgorithm::WaitForIslandEvaluation()
+{
+	assert(!completedIslands.empty());
+
+	const int island(completedIslands.front());
+	completedIslands.pop_front();
+
+	return island;
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		PerformSteadyStateOptimization
+//
+// Description:		Main run loop for steady-state mode.  The first generation
+//					is evaluated as a batch; after that, children are bred and
+//					evaluated one at a time (with up to
+//					GetMaximumPendingEvaluations() in progress) until
+//					populationSize children have been evaluated for each
+//					remaining generation.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::PerformSteadyStateOptimization()
+{
+	currentGeneration++;
+	Breed();
+	SimulateGeneration();
+	SortByFitness();
+	RecordBestCitizen();
+	PerformAdditionalActions();
+
+	if (currentGeneration + 1 >= generationLimit)
+		return;
+
+	StartSteadyStateGeneration();
+
+	const unsigned int maximumPending(std::max(1U,
+		std::min(GetMaximumPendingEvaluations(), (unsigned int)populationSize)));
+	int *children = new int[maximumPending * numberOfGenes];
+	std::vector<unsigned int> freeSlots;
+	unsigned int slot;
+	for (slot = 0; slot < maximumPending; slot++)
+		freeSlots.push_back(slot);
+
+	const int totalEvaluations((generationLimit - currentGeneration) * populationSize);
+	int started(0), completed(0), loser, i;
+	double fitness;
+	std::mt19937 &generator(generators[0]);
+	while (completed < totalEvaluations)
+	{
+		// Keep as many evaluations in progress as we are allowed
+		while (!freeSlots.empty() && started < totalEvaluations)
+		{
+			slot = freeSlots.back();
+			freeSlots.pop_back();
+
+			BreedChild(GetGenome(currentGeneration, SelectByTournament(generator, true)),
+				GetGenome(currentGeneration, SelectByTournament(generator, true)),
+				children + slot * numberOfGenes, generator);
+			BeginEvaluation(slot, children + slot * numberOfGenes);
+			started++;
+		}
+
+		slot = WaitForEvaluation(fitness);
+		freeSlots.push_back(slot);
+		completed++;
+
+		// The child only enters the population if it beats the loser of a tournament
+		loser = SelectByTournament(generator, false);
+		if (IsMoreFit(fitness, GetFitnesses(currentGeneration)[loser]))
+		{
+			for (i = 0; i < numberOfGenes; i++)
+				GetGenome(currentGeneration, loser)[i] = children[slot * numberOfGenes + i];
+			GetFitnesses(currentGeneration)[loser] = fitness;
+		}
+
+		// Every populationSize evaluations is treated as a generation
+		if (completed % populationSize == 0)
+		{
+			SortByFitness();
+			RecordBestCitizen();
+			PerformAdditionalActions();
+
+			if (currentGeneration + 1 < generationLimit)
+				StartSteadyStateGeneration();
+		}
+	}
+
+	delete [] children;
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		StartSteadyStateGeneration
+//
+// Description:		Advances to the next generation in steady-state mode by
+//					copying the current population forward.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::StartSteadyStateGeneration()
+{
+	currentGeneration++;
+
+	int i;
+	for (i = 0; i < populationSize * numberOfGenes; i++)
+		GetGenome(currentGeneration, 0)[i] = GetGenome(currentGeneration - 1, 0)[i];
+	for (i = 0; i < populationSize; i++)
+		GetFitnesses(currentGeneration)[i] = GetFitnesses(currentGeneration - 1)[i];
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SelectByTournament
+//
+// Description:		Randomly chooses tournamentSize citizens from the current
+//					generation and returns the most (or least) fit.
+//
+// Input Arguments:
+//		generator	= std::mt19937&
+//		mostFit		= const bool& indicating whether the most fit or the least
+//					  fit competitor wins
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, index of the winning citizen
+//
+//==========================================================================
+int GeneticAlgorithm::SelectByTournament(std::mt19937 &generator, const bool &mostFit) const
+{
+	const double *currentFitnesses(GetFitnesses(currentGeneration));
+	int i, competitor, winner(RandomInteger(generator, populationSize));
+	for (i = 1; i < tournamentSize; i++)
+	{
+		competitor = RandomInteger(generator, populationSize);
+		if (mostFit && IsMoreFit(currentFitnesses[competitor], currentFitnesses[winner]))
+			winner = competitor;
+		else if (!mostFit && IsMoreFit(currentFitnesses[winner], currentFitnesses[competitor]))
+			winner = competitor;
+	}
+
+	return winner;
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		BreedChild
+//
+// Description:		Creates a single child from two parents using the same
+//					crossover and mutation rules as BreedIsland.
+//
+// Input Arguments:
+//		father		= const int* pointing to the first parent's genome
+//		mother		= const int* pointing to the second parent's genome
+//		generator	= std::mt19937&
+//
+// Output Arguments:
+//		child		= int* pointing to the child's genome
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::BreedChild(const int *father, const int *mother, int *child,
+	std::mt19937 &generator) const
+{
+	int i, genesFromDad(0);
+	for (i = 0; i < numberOfGenes; i++)
+	{
+		if (crossover == 0)// Not using a crossover point
+		{
+			if ((RandomInteger(generator, 2) == 0 && genesFromDad < 0.5 * numberOfGenes) ||
+				i - genesFromDad > 0.5 * numberOfGenes)
+			{
+				genesFromDad++;
+				child[i] = father[i];
+			}
+			else
+				child[i] = mother[i];
+		}
+		else if (i < crossover)
+			child[i] = father[i];
+		else
+			child[i] = mother[i];
+	}
+
+	if (mutation > 0.0 && RandomInteger(generator, 100) + 1 < int(mutation * 100.0))
+	{
+		const int geneToMutate(RandomInteger(generator, numberOfGenes));
+		child[geneToMutate] = RandomInteger(generator, numberOfPhenotypes[geneToMutate]);
+	}
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		DetermineObjectives
+//
+// Description:		Evaluates the objectives for multi-objective mode.  The
+//					default implementation uses the fitness as the only
+//					objective.
+//
+// Input Arguments:
+//		currentGenome	= const int* pointing to the genome to evaluate
+//
+// Output Arguments:
+//		objectives		= double* (GetNumberOfObjectives() long)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::DetermineObjectives(const int *currentGenome, double *objectives)
+{
+	objectives[0] = DetermineFitness(currentGenome);
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		PerformMultiObjectiveOptimization
+//
+// Description:		Main run loop for multi-objective mode.  Each generation
+//					of children is bred from the previous generation, then
+//					the best of the parents and children (by Pareto rank and
+//					crowding distance) survive to form the generation.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::PerformMultiObjectiveOptimization()
+{
+	paretoRanking.SetNumberOfThreads(std::max(wxThread::GetCPUCount(), 1));
+
+	while (currentGeneration + 1 < generationLimit)
+	{
+		currentGeneration++;
+		if (currentGeneration == 0)
+			CreateFirstGeneration();
+		else
+			BreedMultiObjective();
+
+		SimulateGeneration();
+		SelectSurvivors();
+		RecordBestCitizen();
+		PerformAdditionalActions();
+	}
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		BreedMultiObjective
+//
+// Description:		Breeds the children for the current generation from the
+//					previous generation (which is in order of preference).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::BreedMultiObjective()
+{
+	std::mt19937 &generator(generators[0]);
+	int i, father, mother;
+	for (i = 0; i < populationSize; i++)
+	{
+		father = SelectByCrowding(generator);
+		mother = SelectByCrowding(generator);
+		BreedChild(GetGenome(currentGeneration - 1, father),
+			GetGenome(currentGeneration - 1, mother), GetGenome(currentGeneration, i), generator);
+	}
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SelectSurvivors
+//
+// Description:		Ranks the children in the current generation together with
+//					their parents (the previous generation) and keeps the best
+//					populationSize citizens, in order of preference.
+//
+// Input Arguments:
+//		None
 //
 // Output Arguments:
 //		None
@@ -812,7 +1586,170 @@ void GeneticAlgorithm::SelectionSort(double *fitnessArray, int **genomeArray,
 //		None
 //
 //==========================================================================
-void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
+void GeneticAlgorithm::SelectSurvivors()
+{
+	// Candidates are the children followed by the parents
+	const int candidateCount(currentGeneration > 0 ? 2 * populationSize : populationSize);
+	std::vector<double> candidateObjectives(candidateCount * numberOfObjectives);
+	std::copy(GetObjectives(currentGeneration), GetObjectives(currentGeneration)
+		+ populationSize * numberOfObjectives, candidateObjectives.begin());
+	if (currentGeneration > 0)
+		std::copy(GetObjectives(currentGeneration - 1), GetObjectives(currentGeneration - 1)
+			+ populationSize * numberOfObjectives, candidateObjectives.begin() + populationSize * numberOfObjectives);
+
+	// The ranking always minimizes
+	int i;
+	if (!minimize)
+	{
+		for (i = 0; i < candidateCount * numberOfObjectives; i++)
+			candidateObjectives[i] = -candidateObjectives[i];
+	}
+
+	paretoRanking.Rank(candidateObjectives.data(), candidateCount, numberOfObjectives);
+	paretoFrontSize = std::min((int)paretoRanking.GetFrontSize(0), populationSize);
+
+	// The current generation may be one of the sources, so the survivors are
+	// assembled separately
+	std::vector<double> survivorFitnesses(populationSize);
+	std::vector<double> survivorObjectives(populationSize * numberOfObjectives);
+	int generation, citizen;
+	for (i = 0; i < populationSize; i++)
+	{
+		citizen = paretoRanking.GetOrder()[i];
+		if (citizen < populationSize)
+			generation = currentGeneration;
+		else
+		{
+			generation = currentGeneration - 1;
+			citizen -= populationSize;
+		}
+
+		std::copy(GetGenome(generation, citizen), GetGenome(generation, citizen) + numberOfGenes,
+			sortGenomes + i * numberOfGenes);
+		survivorFitnesses[i] = GetFitnesses(generation)[citizen];
+		std::copy(GetObjectives(generation) + citizen * numberOfObjectives,
+			GetObjectives(generation) + (citizen + 1) * numberOfObjectives,
+			survivorObjectives.begin() + i * numberOfObjectives);
+	}
+
+	std::copy(sortGenomes, sortGenomes + populationSize * numberOfGenes, GetGenome(currentGeneration, 0));
+	std::copy(survivorFitnesses.begin(), survivorFitnesses.end(), GetFitnesses(currentGeneration));
+	std::copy(survivorObjectives.begin(), survivorObjectives.end(), GetObjectives(currentGeneration));
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SelectByCrowding
+//
+// Description:		Randomly chooses tournamentSize citizens from the previous
+//					generation and returns the preferred citizen (lowest rank,
+//					then largest crowding distance).  The generation is stored
+//					in order of preference, so this is the lowest index.
+//
+// Input Arguments:
+//		generator	= std::mt19937&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, index of the winning citizen
+//
+//==========================================================================
+int GeneticAlgorithm::SelectByCrowding(std::mt19937 &generator) const
+{
+	int i, winner(RandomInteger(generator, populationSize));
+	for (i = 1; i < tournamentSize; i++)
+		winner = std::min(winner, RandomInteger(generator, populationSize));
+
+	return winner;
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		SelectionSort
+//
+// Description:		Sorts the fitnesses and genomes by fitness using a
+//					selection sort algorithm.
+//
+// Input Arguments:
+//		fitnessArray	= double* pointing to the list of values to sort
+//		orderArray		= int* pointing to the list of citizen indices - these
+//						  values are not used in the sorting process, but
+//						  they must be sorted along with the corresponding
+//						  fitness value
+//		arraySize		= const int specifying the length of the array
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::SelectionSort(double *fitnessArray, int *orderArray,
+									  const int arraySize)
+{
+	// We will need to find the minimum or maximum value and swap it with
+	// the next element in the list.
+	int bestIndex, i, swapOrder;
+	double swapFitness;
+
+	// Repeat this procedure until the list is sorted
+	int sortIndex = 0;
+	while (sortIndex < arraySize)
+	{
+		// Initialize bestIndex
+		bestIndex = sortIndex;
+
+		// Go through the list and find the next best value
+		for (i = sortIndex; i < arraySize; i ++)
+		{
+			// This depends on whether we're finding minimums or maximums
+			if ((fitnessArray[i] > fitnessArray[bestIndex] && !minimize) ||
+				(fitnessArray[i] < fitnessArray[bestIndex] && minimize))
+				bestIndex = i;
+		}
+
+		// Swap the next best value with the current element in the list
+		swapFitness = fitnessArray[sortIndex];
+		fitnessArray[sortIndex] = fitnessArray[bestIndex];
+		fitnessArray[bestIndex] = swapFitness;
+
+		swapOrder = orderArray[sortIndex];
+		orderArray[sortIndex] = orderArray[bestIndex];
+		orderArray[bestIndex] = swapOrder;
+
+		// Increment the sort index
+		sortIndex++;
+	}
+}
+
+//==========================================================================
+// Class:			GeneticAlgorithm
+// Function:		MergeSort
+//
+// Description:		Sorts the fitnesses and genomes by fitness using a
+//					merge sort algorithm.
+//
+// Input Arguments:
+//		fitnessArray	= double* pointing to the list of values to sort
+//		orderArray		= int* pointing to the list of citizen indices - these
+//						  values are not used in the sorting process, but
+//						  they must be sorted along with the corresponding
+//						  fitness value
+//		arraySize		= const int specifying the length of the array
+//						  (can be different from PopulationSize in the case
+//						  of recursive calls)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GeneticAlgorithm::MergeSort(double *fitnessArray, int *orderArray,
 								  const int arraySize)
 {
 	// If the length is 1 or less, it is already sorted
@@ -823,16 +1760,13 @@ void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
 	int firstSize = arraySize / 2;
 	int secondSize = arraySize - firstSize;
 	double *secondFitnessArray = fitnessArray + firstSize;
-	int **secondGenomeArray = genomeArray + firstSize;
-	MergeSort(fitnessArray, genomeArray, firstSize);
-	MergeSort(secondFitnessArray, secondGenomeArray, secondSize);
+	int *secondOrderArray = orderArray + firstSize;
+	MergeSort(fitnessArray, orderArray, firstSize);
+	MergeSort(secondFitnessArray, secondOrderArray, secondSize);
 
 	// Create the result arrays
-	int i;
 	double *resultFitness = new double[arraySize];
-	int **resultGenome = new int*[arraySize];
-	for (i = 0; i < arraySize; i++)
-		resultGenome[i] = new int[numberOfGenes];
+	int *resultOrder = new int[arraySize];
 
 	// Merge the two halfs of the array back into one array
 	// with the same size as the original
@@ -847,10 +1781,7 @@ void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
 		{
 			// Append the element from the first array to the result
 			resultFitness[firstIndex + secondIndex] = fitnessArray[firstIndex];
-
-			// Use a loop to do the same for the genome
-			for (i = 0; i < numberOfGenes; i++)
-				resultGenome[firstIndex + secondIndex][i] = genomeArray[firstIndex][i];
+			resultOrder[firstIndex + secondIndex] = orderArray[firstIndex];
 
 			// Increment the first index
 			firstIndex++;
@@ -859,10 +1790,7 @@ void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
 		{
 			// Append the element from the second array to the result
 			resultFitness[firstIndex + secondIndex] = secondFitnessArray[secondIndex];
-
-			// Use a loop to do the same for the genome
-			for (i = 0; i < numberOfGenes; i++)
-				resultGenome[firstIndex + secondIndex][i] = secondGenomeArray[secondIndex][i];
+			resultOrder[firstIndex + secondIndex] = secondOrderArray[secondIndex];
 
 			// Increment the second index
 			secondIndex++;
@@ -874,10 +1802,7 @@ void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
 	{
 		// Append the element from the first array to the result
 		resultFitness[firstIndex + secondIndex] = fitnessArray[firstIndex];
-
-		// Use a loop to do the same for the genome
-		for (i = 0; i < numberOfGenes; i++)
-			resultGenome[firstIndex + secondIndex][i] = genomeArray[firstIndex][i];
+		resultOrder[firstIndex + secondIndex] = orderArray[firstIndex];
 
 		// Increment the first index
 		firstIndex++;
@@ -886,34 +1811,21 @@ void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
 	{
 		// Append the element from the second array to the result
 		resultFitness[firstIndex + secondIndex] = secondFitnessArray[secondIndex];
-
-		// Use a loop to do the same for the genome
-		for (i = 0; i < numberOfGenes; i++)
-			resultGenome[firstIndex + secondIndex][i] = secondGenomeArray[secondIndex][i];
+		resultOrder[firstIndex + secondIndex] = secondOrderArray[secondIndex];
 
 		// Increment the second index
 		secondIndex++;
 	}
 
 	// Assign the results to the input arrays
-	for (firstIndex = 0; firstIndex < arraySize; firstIndex++)
-	{
-		fitnessArray[firstIndex] = resultFitness[firstIndex];
-
-		for (i = 0; i < numberOfGenes; i++)
-			genomeArray[firstIndex][i] = resultGenome[firstIndex][i];
-	}
+	std::copy(resultFitness, resultFitness + arraySize, fitnessArray);
+	std::copy(resultOrder, resultOrder + arraySize, orderArray);
 
 	// Delete the result arrays
 	delete [] resultFitness;
 	resultFitness = NULL;
-	for (i = 0; i < arraySize; i++)
-	{
-		delete [] resultGenome[i];
-		resultGenome[i] = NULL;
-	}
-	delete [] resultGenome;
-	resultGenome = NULL;
+	delete [] resultOrder;
+	resultOrder = NULL;
 }
 
 //==========================================================================
@@ -925,7 +1837,7 @@ void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
 //
 // Input Arguments:
 //		fitnessArray	= double* pointing to the list of values to sort
-//		genomeArray		= int** pointing to the list of genomes - these
+//		orderArray		= int* pointing to the list of citizen indices - these
 //						  values are not used in the sorting process, but
 //						  they must be sorted along with the corresponding
 //						  fitness value
@@ -940,7 +1852,7 @@ void GeneticAlgorithm::MergeSort(double *fitnessArray, int **genomeArray,
 //		None
 //
 //==========================================================================
-void GeneticAlgorithm::Quicksort(double *fitnessArray, int **genomeArray,
+void GeneticAlgorithm::Quicksort(double *fitnessArray, int *orderArray,
 								  const int arraySize)
 {
 	// If there is nothing to sort, don't do anything
@@ -958,12 +1870,11 @@ void GeneticAlgorithm::Quicksort(double *fitnessArray, int **genomeArray,
 
 	// For swapping elements
 	double swapFitness;
-	int *swapGenome = new int[numberOfGenes];
+	int swapOrder;
 
 	// Split the array into two groups:  Higher than pivot and lower than pivot
 	int sortedElements = 0;
 	int numberOfTopElements = 0;
-	int swapGene, i;
 	while (sortedElements < arraySize)
 	{
 		// Check to see if the element is larger or smaller than the pivot
@@ -976,13 +1887,10 @@ void GeneticAlgorithm::Quicksort(double *fitnessArray, int **genomeArray,
 			fitnessArray[numberOfTopElements] = fitnessArray[sortedElements];
 			fitnessArray[sortedElements] = swapFitness;
 
-			// Also swap the genome
-			for (i = 0; i < numberOfGenes; i++)
-			{
-				swapGene = genomeArray[numberOfTopElements][i];
-				genomeArray[numberOfTopElements][i] = genomeArray[sortedElements][i];
-				genomeArray[sortedElements][i] = swapGene;
-			}
+			// Also swap the order
+			swapOrder = orderArray[numberOfTopElements];
+			orderArray[numberOfTopElements] = orderArray[sortedElements];
+			orderArray[sortedElements] = swapOrder;
 
 			// Increment the number of top elements
 			numberOfTopElements++;
@@ -997,20 +1905,13 @@ void GeneticAlgorithm::Quicksort(double *fitnessArray, int **genomeArray,
 	fitnessArray[numberOfTopElements] = fitnessArray[arraySize - 1];
 	fitnessArray[arraySize - 1] = swapFitness;
 
-	// We must also place the genome in the right location
-	for (i = 0; i < numberOfGenes; i++)
-	{
-		swapGene = genomeArray[numberOfTopElements][i];
-		genomeArray[numberOfTopElements][i] = genomeArray[arraySize - 1][i];
-		genomeArray[arraySize - 1][i] = swapGene;
-	}
+	// We must also place the order in the right location
+	swapOrder = orderArray[numberOfTopElements];
+	orderArray[numberOfTopElements] = orderArray[arraySize - 1];
+	orderArray[arraySize - 1] = swapOrder;
 
 	// Call this recursively on the two new lists
-	Quicksort(fitnessArray, genomeArray, numberOfTopElements);
-	Quicksort(fitnessArray + numberOfTopElements + 1, genomeArray + numberOfTopElements + 1,
+	Quicksort(fitnessArray, orderArray, numberOfTopElements);
+	Quicksort(fitnessArray + numberOfTopElements + 1, orderArray + numberOfTopElements + 1,
 		arraySize - numberOfTopElements - 1);
-
-	// Delete the swap genome
-	delete swapGenome;
-	swapGenome = NULL;
 }
\ No newline at end of file
@@ -0,0 +1,268 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  genomeCache.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Memory-limited cache of the values computed for each genome, with
+//				 least-recently-used eviction.  Allows genetic algorithms to skip the
+//				 analysis of genomes that have already been evaluated (elite citizens,
+//				 duplicates in converged populations, etc.).
+// History:
+
+// Standard C++ headers
+#include <cassert>
+
+// VVASE headers
+#include "vSolver/optimization/genomeCache.h"
+
+//==========================================================================
+// Class:			GenomeCache
+// Function:		GenomeCache
+//
+// Description:		Constructor for the GenomeCache class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+GenomeCache::GenomeCache()
+{
+	genomeLength = 0;
+	valueCount = 0;
+	capacity = 0;
+	hits = 0;
+	lookups = 0;
+}
+
+//==========================================================================
+// Class:			GenomeCache
+// Function:		Initialize
+//
+// Description:		Clears the cache and determines the number of entries
+//					that can be stored within the specified memory limit.
+//					The estimate includes the container overhead, but is
+//					approximate.  A limit of zero disables the cache.
+//
+// Input Arguments:
+//		genomeLength	= const unsigned int& number of genes in each genome
+//		valueCount		= const unsigned int& number of values stored for each genome
+//		memoryLimit		= const size_t& [bytes]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GenomeCache::Initialize(const unsigned int &genomeLength,
+	const unsigned int &valueCount, const size_t &memoryLimit)
+{
+	Clear();
+
+	this->genomeLength = genomeLength;
+	this->valueCount = valueCount;
+	key.resize(genomeLength);
+
+	// The genome is stored twice (once in the list and once as the key);
+	// allow three pointers each for the list node and the hash table node
+	const size_t entrySize(sizeof(Entry) + sizeof(std::vector<int>)
+		+ 2 * genomeLength * sizeof(int) + valueCount * sizeof(double)
+		+ sizeof(EntryList::iterator) + 6 * sizeof(void*));
+	capacity = (unsigned int)(memoryLimit / entrySize);
+
+	index.reserve(capacity);
+}
+
+//==========================================================================
+// Class:			GenomeCache
+// Function:		Clear
+//
+// Description:		Removes all entries and resets the statistics.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GenomeCache::Clear()
+{
+	index.clear();
+	entries.clear();
+	hits = 0;
+	lookups = 0;
+}
+
+//==========================================================================
+// Class:			GenomeCache
+// Function:		Find
+//
+// Description:		Looks up the values for the specified genome.  Entries
+//					that are found become the most recently used.
+//
+// Input Arguments:
+//		genome	= const int* (genomeLength long)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const double* pointing to the stored values (valueCount long), or
+//		NULL if the genome is not in the cache
+//
+//==========================================================================
+const double* GenomeCache::Find(const int *genome)
+{
+	if (capacity == 0)
+		return NULL;
+
+	lookups++;
+	SetKey(genome);
+	std::unordered_map<std::vector<int>, EntryList::iterator, GenomeHash>::iterator it(index.find(key));
+	if (it == index.end())
+		return NULL;
+
+	hits++;
+	entries.splice(entries.begin(), entries, it->second);
+	return entries.front().values.data();
+}
+
+//==========================================================================
+// Class:			GenomeCache
+// Function:		Insert
+//
+// Description:		Adds (or replaces) the values for the specified genome.  If
+//					the cache is full, the least recently used entry is evicted.
+//
+// Input Arguments:
+//		genome	= const int* (genomeLength long)
+//		values	= const double* (valueCount long)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GenomeCache::Insert(const int *genome, const double *values)
+{
+	if (capacity == 0)
+		return;
+
+	SetKey(genome);
+	std::unordered_map<std::vector<int>, EntryList::iterator, GenomeHash>::iterator it(index.find(key));
+	if (it != index.end())
+	{
+		it->second->values.assign(values, values + valueCount);
+		entries.splice(entries.begin(), entries, it->second);
+		return;
+	}
+
+	// Re-use the least recently used entry rather than allocating a new one
+	if (entries.size() >= capacity)
+	{
+		index.erase(entries.back().genome);
+		entries.splice(entries.begin(), entries, --entries.end());
+	}
+	else
+		entries.push_front(Entry());
+
+	Entry &entry(entries.front());
+	entry.genome = key;
+	entry.values.assign(values, values + valueCount);
+	index[key] = entries.begin();
+}
+
+//==========================================================================
+// Class:			GenomeCache
+// Function:		GetHitRate
+//
+// Description:		Returns the fraction of lookups that were found in the cache.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double (0.0 to 1.0)
+//
+//==========================================================================
+double GenomeCache::GetHitRate() const
+{
+	if (lookups == 0)
+		return 0.0;
+
+	return (double)hits / (double)lookups;
+}
+
+//==========================================================================
+// Class:			GenomeCache
+// Function:		SetKey
+//
+// Description:		Copies the specified genome into the lookup key.
+//
+// Input Arguments:
+//		genome	= const int* (genomeLength long)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void GenomeCache::SetKey(const int *genome)
+{
+	assert(key.size() == genomeLength);
+	key.assign(genome, genome + genomeLength);
+}
+
+//==========================================================================
+// Class:			GenomeCache::GenomeHash
+// Function:		operator()
+//
+// Description:		Computes the hash of a genome (FNV-1a over the genes).
+//
+// Input Arguments:
+//		genome	= const std::vector<int>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//==========================================================================
+size_t GenomeCache::GenomeHash::operator()(const std::vector<int> &genome) const
+{
+	size_t hash(2166136261u);
+	unsigned int i;
+	for (i = 0; i < genome.size(); i++)
+	{
+		hash ^= (size_t)(unsigned int)genome[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
@@ -0,0 +1,1923 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  kinematicsGA.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Genetic algorithm for optimizing suspension hardpoints against a list
+//				 of kinematic goals.  Analyses are distributed to the worker threads via
+//				 the job queue; this class has no dependence on the GUI.
+// History:
+
+// Standard C++ headers
+#include <fstream>
+#include <cassert>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#include <limits>
+
+// wxWidgets headers
+#include <wx/wx.h>
+
+// VVASE headers
+#include "vSolver/optimization/kinematicsGA.h"
+#include "vSolver/physics/kinematics.h"
+#include "vSolver/physics/kinematicOutputs.h"
+#include "vSolver/threads/kinematicsBatchData.h"
+#include "vSolver/threads/jobQueue.h"
+#include "vCar/car.h"
+#include "vCar/suspension.h"
+#include "vMath/carMath.h"
+#include "vUtilities/unitConverter.h"
+#include "vUtilities/debugger.h"
+#include "vUtilities/machineDefinitions.h"
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		KinematicsGA
+//
+// Description:		Constructor for KinematicsGA class.
+//
+// Input Arguments:
+//		queue	= JobQueue& reference to the job queue
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+KinematicsGA::KinematicsGA(JobQueue &queue) : queue(queue)
+{
+	int cpuCount = wxThread::GetCPUCount();
+	if (cpuCount < 1)
+		cpuCount = 1;
+	numberOfThreads = cpuCount;
+
+	originalCarArray = NULL;
+	numberOfCars = 0;
+	kinematicOutputArray = NULL;
+	goalValues = NULL;
+	isRunning = false;
+
+	cacheMemoryLimit = 64 * 1024 * 1024;
+	surrogateFraction = 1.0;
+	refinementIterations = 0;
+	outputMask = KinematicOutputs::GroupAll;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		~KinematicsGA
+//
+// Description:		Destructor for KinematicsGA class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+KinematicsGA::~KinematicsGA()
+{
+	wxMutexLocker lock(gsaMutex);
+	DebugLog::GetInstance()->Log(_T("KinematicsGA::~KinematicsGA()"));
+
+	unsigned int i;
+	for (i = 0; i < numberOfCars; i++)
+	{
+		delete originalCarArray[i];
+		originalCarArray[i] = NULL;
+	}
+	delete [] originalCarArray;
+	originalCarArray = NULL;
+
+	delete [] kinematicOutputArray;
+	kinematicOutputArray = NULL;
+
+	delete [] goalValues;
+	goalValues = NULL;
+
+	// Clean up the lists
+	geneList.Clear();
+	goalList.Clear();
+	inputList.Clear();
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		Constant declarations
+//
+// Description:		Where constants for the KinematicsGA class are declared.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const int KinematicsGA::currentFileVersion = 0;
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		surrogateSampleLimit (static)
+//
+// Description:		Maximum number of analyzed genomes used to fit the
+//					surrogate model (fitting cost grows with the cube of this).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int KinematicsGA::surrogateSampleLimit = 256;
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		SimulateGeneration
+//
+// Description:		Overriden method from GeneticAlgorithm that allows the
+//					use of threading.  Completed batches post to the inverse
+//					semaphore directly, so no event loop is required.  Genomes
+//					that have been evaluated previously are taken from the
+//					cache instead of being analyzed again.  If surrogate
+//					screening is enabled, only the most promising of the
+//					remaining genomes are analyzed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::SimulateGeneration()
+{
+	isRunning = true;
+
+	// Genomes that are in the cache (or that are duplicates of another citizen
+	// in this generation) do not need to be analyzed.  The remaining citizens
+	// are assigned to the first cars in the array.
+	const unsigned int valueCount(GetGoalValueCount());
+	std::vector<int> carIndex(populationSize, -1);
+	std::vector<int> duplicateOf(populationSize, -1);
+	std::unordered_map<std::vector<int>, int, GenomeCache::GenomeHash> generationGenomes;
+	std::unordered_map<std::vector<int>, int, GenomeCache::GenomeHash>::iterator it;
+	unsigned int carCount(0);
+	const double *cachedValues;
+	std::vector<int> candidates;
+
+	int i, jobIndex(GetJobIndex());
+	cacheMutex.Lock();
+	for (i = 0; i < populationSize; i++)
+	{
+		cachedValues = cache.Find(GetGenome(currentGeneration, i));
+		if (cachedValues)
+		{
+			std::copy(cachedValues, cachedValues + valueCount, goalValues + i * valueCount);
+			continue;
+		}
+
+		std::vector<int> genome(GetGenome(currentGeneration, i),
+			GetGenome(currentGeneration, i) + numberOfGenes);
+		it = generationGenomes.find(genome);
+		if (it != generationGenomes.end())
+		{
+			duplicateOf[i] = it->second;
+			continue;
+		}
+
+		generationGenomes[genome] = i;
+		candidates.push_back(i);
+	}
+	cacheMutex.Unlock();
+
+	// Genomes rejected by the surrogate keep their predicted goal values
+	std::vector<bool> predicted(populationSize, false);
+	std::vector<int> rejected(ScreenCandidates(candidates));
+	for (i = 0; i < (int)rejected.size(); i++)
+		predicted[rejected[i]] = true;
+
+	for (i = 0; i < (int)candidates.size(); i++)
+	{
+		if (predicted[candidates[i]])
+			continue;
+
+		carIndex[candidates[i]] = carCount;
+		SetCarGenome(carCount++, GetGenome(currentGeneration, candidates[i]));
+	}
+
+	// Skipped analyses count towards the progress, too
+	const unsigned int analysisCount(carCount * inputList.GetCount());
+	if (analysisCount < (unsigned int)populationSize * inputList.GetCount())
+		queue.Report(ThreadJob::CommandThreadKinematicsGA, 0, jobIndex,
+			(unsigned int)populationSize * inputList.GetCount() - analysisCount);
+
+	AnalyzeCars(carCount, true);
+
+	// Duplicates always follow the citizen that was analyzed
+	std::vector<double> surrogateInputs(numberOfGenes);
+	wxMutexLocker lock(cacheMutex);
+	for (i = 0; i < populationSize; i++)
+	{
+		if (carIndex[i] >= 0)
+		{
+			ExtractGoalValues(carIndex[i], goalValues + i * valueCount);
+			cache.Insert(GetGenome(currentGeneration, i), goalValues + i * valueCount);
+
+			GetSurrogateInputs(GetGenome(currentGeneration, i), surrogateInputs.data());
+			surrogate.AddSample(surrogateInputs.data(), goalValues + i * valueCount);
+		}
+		else if (duplicateOf[i] >= 0)
+		{
+			std::copy(goalValues + duplicateOf[i] * valueCount,
+				goalValues + (duplicateOf[i] + 1) * valueCount, goalValues + i * valueCount);
+			predicted[i] = predicted[duplicateOf[i]];
+		}
+	}
+
+	// Predicted genomes must never outrank analyzed genomes (we minimize fitness),
+	// so they are placed behind the worst analyzed genome, in predicted order
+	ComputeFitnesses(goalValues, populationSize, GetFitnesses(currentGeneration));
+
+	double worstFitness(0.0);
+	for (i = 0; i < populationSize; i++)
+	{
+		if (!predicted[i])
+			worstFitness = std::max(worstFitness, GetFitnesses(currentGeneration)[i]);
+	}
+
+	for (i = 0; i < populationSize; i++)
+	{
+		if (predicted[i])
+			GetFitnesses(currentGeneration)[i] += worstFitness;
+	}
+
+	if (!multiObjective)
+		return;
+
+	// The same applies to each objective, which places every predicted genome
+	// behind the analyzed genomes in the Pareto ranking
+	double *objectives(GetObjectives(currentGeneration));
+	ComputeObjectives(goalValues, populationSize, objectives);
+
+	std::vector<double> worstObjectives(numberOfObjectives, 0.0);
+	int j;
+	for (i = 0; i < populationSize; i++)
+	{
+		if (predicted[i])
+			continue;
+
+		for (j = 0; j < numberOfObjectives; j++)
+			worstObjectives[j] = std::max(worstObjectives[j], objectives[i * numberOfObjectives + j]);
+	}
+
+	for (i = 0; i < populationSize; i++)
+	{
+		if (!predicted[i])
+			continue;
+
+		for (j = 0; j < numberOfObjectives; j++)
+			objectives[i * numberOfObjectives + j] += worstObjectives[j];
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		AnalyzeCars
+//
+// Description:		Analyzes the first carCount cars at every input condition
+//					and waits for the analyses to complete.  The analyses are
+//					grouped into contiguous batches (one job each) to reduce
+//					queue and event overhead.
+//
+// Input Arguments:
+//		carCount		= const unsigned int&
+//		reportProgress	= const bool& indicating whether or not the completed
+//						  analyses count towards the optimization progress
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::AnalyzeCars(const unsigned int &carCount, const bool &reportProgress)
+{
+	const unsigned int analysisCount(carCount * inputList.GetCount());
+	if (analysisCount == 0)
+		return;
+
+	const ThreadJob::ThreadCommand command(reportProgress ?
+		ThreadJob::CommandThreadKinematicsGA : ThreadJob::CommandThreadKinematicsRefinement);
+	const unsigned int batchSize(KinematicsBatchData::ComputeBatchSize(
+		analysisCount, GetNumberOfThreads()));
+
+	// Use a counter to keep track of the number of pending jobs
+	inverseSemaphore.Set((analysisCount + batchSize - 1) / batchSize);// TODO:  Check return value to ensure no errors!
+
+	int jobIndex(GetJobIndex());
+	KinematicsBatchData *data(NULL);
+	unsigned int i;
+	for (i = 0; i < analysisCount; i++)
+	{
+		if (!data)
+		{
+			data = new KinematicsBatchData;
+			data->completion = &inverseSemaphore;
+			data->outputMask = outputMask;
+		}
+		data->Add(originalCarArray[i / inputList.GetCount()],
+			*inputList[i % inputList.GetCount()], kinematicOutputArray + i);
+
+		if (data->GetCount() == batchSize || i == analysisCount - 1)
+		{
+			ThreadJob newJob(command, data, GetJobName(), jobIndex);
+			queue.AddJob(newJob);
+			data = NULL;
+		}
+	}
+
+	inverseSemaphore.Wait();
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		ScreenCandidates
+//
+// Description:		Ranks the candidate citizens using the surrogate model and
+//					chooses the ones that will not be analyzed.  The predicted
+//					goal values for the rejected citizens are stored in
+//					goalValues.  Nothing is rejected until the model has been
+//					fit to enough analyzed genomes.
+//
+// Input Arguments:
+//		candidates	= const std::vector<int>& citizens that need analysis
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<int> containing the rejected citizens
+//
+//==========================================================================
+std::vector<int> KinematicsGA::ScreenCandidates(const std::vector<int> &candidates)
+{
+	std::vector<int> rejected;
+	if (surrogateFraction >= 1.0 || candidates.empty() ||
+		surrogate.GetSampleCount() <= (unsigned int)numberOfGenes || !surrogate.Fit())
+		return rejected;
+
+	const unsigned int valueCount(GetGoalValueCount());
+	std::vector<double> surrogateInputs(numberOfGenes);
+	std::vector<std::pair<double, int> > ranking;
+	unsigned int i;
+	for (i = 0; i < candidates.size(); i++)
+	{
+		GetSurrogateInputs(GetGenome(currentGeneration, candidates[i]), surrogateInputs.data());
+		surrogate.Predict(surrogateInputs.data(), goalValues + candidates[i] * valueCount);
+		ranking.push_back(std::make_pair(
+			ComputeFitness(goalValues + candidates[i] * valueCount), candidates[i]));
+	}
+
+	std::sort(ranking.begin(), ranking.end());
+
+	const unsigned int analyzeCount(std::max(1U,
+		(unsigned int)ceil(surrogateFraction * candidates.size())));
+	for (i = analyzeCount; i < ranking.size(); i++)
+		rejected.push_back(ranking[i].second);
+
+	return rejected;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		GetSurrogateInputs
+//
+// Description:		Converts a genome into surrogate model inputs (each gene
+//					is scaled to the range 0 to 1).
+//
+// Input Arguments:
+//		genome	= const int*
+//
+// Output Arguments:
+//		inputs	= double* (one per gene)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::GetSurrogateInputs(const int *genome, double *inputs) const
+{
+	int i;
+	for (i = 0; i < numberOfGenes; i++)
+	{
+		if (geneList[i]->numberOfValues > 1)
+			inputs[i] = genome[i] / (geneList[i]->numberOfValues - 1.0);
+		else
+			inputs[i] = 0.0;
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		SetSurrogateFraction
+//
+// Description:		Sets the fraction of each generation's new genomes that
+//					are analyzed (values of one or more disable screening).
+//
+// Input Arguments:
+//		fraction	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::SetSurrogateFraction(const double &fraction)
+{
+	wxMutexLocker lock(gsaMutex);
+	surrogateFraction = std::max(0.0, std::min(fraction, 1.0));
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		GetMaximumPendingEvaluations
+//
+// Description:		Returns the number of steady-state children that may be
+//					evaluated at once.  Two per thread keeps the workers busy
+//					while this thread breeds the next child.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int KinematicsGA::GetMaximumPendingEvaluations() const
+{
+	return std::min((unsigned int)populationSize, 2 * GetNumberOfThreads());
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		BeginEvaluation
+//
+// Description:		Starts the analyses for one steady-state child.  Each slot
+//					uses the car (and outputs) with the same index.  Children
+//					found in the cache are completed immediately.
+//
+// Input Arguments:
+//		slot	= const unsigned int& identifying this evaluation
+//		genome	= const int* pointing to the child's genome
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::BeginEvaluation(const unsigned int &slot, const int *genome)
+{
+	isRunning = true;
+
+	if (slot >= pendingGenomes.size())
+	{
+		pendingGenomes.resize(slot + 1);
+		pendingFromCache.resize(slot + 1);
+	}
+	pendingGenomes[slot] = genome;
+
+	const unsigned int valueCount(GetGoalValueCount());
+	cacheMutex.Lock();
+	const double *cachedValues(cache.Find(genome));
+	if (cachedValues)
+		std::copy(cachedValues, cachedValues + valueCount, goalValues + slot * valueCount);
+	cacheMutex.Unlock();
+
+	int jobIndex(GetJobIndex());
+	pendingFromCache[slot] = cachedValues != NULL;
+	if (cachedValues)
+	{
+		queue.Report(ThreadJob::CommandThreadKinematicsGA, 0, jobIndex, inputList.GetCount());
+		completionQueue.Post(slot);
+		return;
+	}
+
+	SetCarGenome(slot, genome);
+
+	KinematicsBatchData *data(new KinematicsBatchData);
+	data->completionQueue = &completionQueue;
+	data->completionTag = slot;
+	data->outputMask = outputMask;
+
+	unsigned int i;
+	for (i = 0; i < inputList.GetCount(); i++)
+		data->Add(originalCarArray[slot], *inputList[i],
+			kinematicOutputArray + slot * inputList.GetCount() + i);
+
+	ThreadJob newJob(ThreadJob::CommandThreadKinematicsGA, data, GetJobName(), jobIndex);
+	queue.AddJob(newJob);
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		EvaluatesIslandsSeparately
+//
+// Description:		Returns true if islands may be evaluated separately.  The
+//					surrogate ranks all of a generation's new genomes together
+//					(and which genomes are new would depend on the order in
+//					which the islands complete), so whole generations are
+//					evaluated when surrogate screening is enabled.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool KinematicsGA::EvaluatesIslandsSeparately() const
+{
+	return surrogateFraction >= 1.0;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		BeginIslandEvaluation
+//
+// Description:		Starts the analyses for one island.  As in
+//					SimulateGeneration(), genomes found in the cache (or that
+//					are duplicates of another citizen in the island) are not
+//					analyzed.  Each citizen uses the car (and outputs) with the
+//					same index, so several islands may be analyzed at once.
+//
+// Input Arguments:
+//		generation	= const int& the generation containing the island
+//		island		= const int& the island to evaluate
+//		first		= const int& index of the first citizen in the island
+//		size		= const int& number of citizens in the island
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::BeginIslandEvaluation(const int &generation, const int &island,
+	const int &first, const int &size)
+{
+	isRunning = true;
+
+	if (island >= (int)islandEvaluations.size())
+		islandEvaluations.resize(island + 1);
+
+	IslandEvaluation &evaluation(islandEvaluations[island]);
+	evaluation.generation = generation;
+	evaluation.first = first;
+	evaluation.size = size;
+	evaluation.analyzed.assign(size, false);
+	evaluation.duplicateOf.assign(size, -1);
+
+	const unsigned int valueCount(GetGoalValueCount());
+	std::unordered_map<std::vector<int>, int, GenomeCache::GenomeHash> islandGenomes;
+	std::unordered_map<std::vector<int>, int, GenomeCache::GenomeHash>::iterator it;
+	const double *cachedValues;
+	std::vector<int> citizens;
+
+	int i;
+	cacheMutex.Lock();
+	for (i = first; i < first + size; i++)
+	{
+		cachedValues = cache.Find(GetGenome(generation, i));
+		if (cachedValues)
+		{
+			std::copy(cachedValues, cachedValues + valueCount, goalValues + i * valueCount);
+			continue;
+		}
+
+		std::vector<int> genome(GetGenome(generation, i), GetGenome(generation, i) + numberOfGenes);
+		it = islandGenomes.find(genome);
+		if (it != islandGenomes.end())
+		{
+			evaluation.duplicateOf[i - first] = it->second;
+			continue;
+		}
+
+		islandGenomes[genome] = i;
+		citizens.push_back(i);
+	}
+	cacheMutex.Unlock();
+
+	for (i = 0; i < (int)citizens.size(); i++)
+	{
+		evaluation.analyzed[citizens[i] - first] = true;
+		SetCarGenome(citizens[i], GetGenome(generation, citizens[i]));
+	}
+
+	// Skipped analyses count towards the progress, too
+	const unsigned int analysisCount(citizens.size() * inputList.GetCount());
+	int jobIndex(GetJobIndex());
+	if (analysisCount < (unsigned int)size * inputList.GetCount())
+		queue.Report(ThreadJob::CommandThreadKinematicsGA, 0, jobIndex,
+			(unsigned int)size * inputList.GetCount() - analysisCount);
+
+	if (analysisCount == 0)
+	{
+		evaluation.pendingJobs = 1;
+		completionQueue.Post(island);
+		return;
+	}
+
+	// Batches are sized as they would be for the whole generation
+	const unsigned int batchSize(KinematicsBatchData::ComputeBatchSize(
+		(unsigned int)populationSize * inputList.GetCount(), GetNumberOfThreads()));
+	evaluation.pendingJobs = (analysisCount + batchSize - 1) / batchSize;
+
+	KinematicsBatchData *data(NULL);
+	unsigned int j, car;
+	for (j = 0; j < analysisCount; j++)
+	{
+		if (!data)
+		{
+			data = new KinematicsBatchData;
+			data->completionQueue = &completionQueue;
+			data->completionTag = island;
+			data->outputMask = outputMask;
+		}
+
+		car = citizens[j / inputList.GetCount()];
+		data->Add(originalCarArray[car], *inputList[j % inputList.GetCount()],
+			kinematicOutputArray + car * inputList.GetCount() + j % inputList.GetCount());
+
+		if (data->GetCount() == batchSize || j == analysisCount - 1)
+		{
+			ThreadJob newJob(ThreadJob::CommandThreadKinematicsGA, data, GetJobName(), jobIndex);
+			queue.AddJob(newJob);
+			data = NULL;
+		}
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		WaitForIslandEvaluation
+//
+// Description:		Waits for every analysis of any pending island to complete
+//					and computes the island's fitnesses.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, the island whose evaluation completed
+//
+//==========================================================================
+int KinematicsGA::WaitForIslandEvaluation()
+{
+	int island;
+	do
+		island = (int)completionQueue.Wait();
+	while (--islandEvaluations[island].pendingJobs > 0);
+
+	const IslandEvaluation &evaluation(islandEvaluations[island]);
+	const unsigned int valueCount(GetGoalValueCount());
+
+	// Duplicates always follow the citizen that was analyzed
+	int i;
+	cacheMutex.Lock();
+	for (i = evaluation.first; i < evaluation.first + evaluation.size; i++)
+	{
+		if (evaluation.analyzed[i - evaluation.first])
+		{
+			ExtractGoalValues(i, goalValues + i * valueCount);
+			cache.Insert(GetGenome(evaluation.generation, i), goalValues + i * valueCount);
+		}
+		else if (evaluation.duplicateOf[i - evaluation.first] >= 0)
+			std::copy(goalValues + evaluation.duplicateOf[i - evaluation.first] * valueCount,
+				goalValues + (evaluation.duplicateOf[i - evaluation.first] + 1) * valueCount,
+				goalValues + i * valueCount);
+	}
+	cacheMutex.Unlock();
+
+	ComputeFitnesses(goalValues + evaluation.first * valueCount, evaluation.size,
+		GetFitnesses(evaluation.generation) + evaluation.first);
+
+	return island;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		WaitForEvaluation
+//
+// Description:		Waits for the analyses of any steady-state child to complete
+//					and computes its fitness.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		fitness	= double&
+//
+// Return Value:
+//		unsigned int, slot of the completed child
+//
+//==========================================================================
+unsigned int KinematicsGA::WaitForEvaluation(double &fitness)
+{
+	const unsigned int slot(completionQueue.Wait());
+	double *values(goalValues + slot * GetGoalValueCount());
+
+	if (!pendingFromCache[slot])
+	{
+		ExtractGoalValues(slot, values);
+
+		wxMutexLocker lock(cacheMutex);
+		cache.Insert(pendingGenomes[slot], values);
+	}
+
+	fitness = ComputeFitness(values);
+	return slot;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		DetermineFitness
+//
+// Description:		Fitness function for the genetic algorithm.  This is slightly
+//					different from the original intended usage of this method
+//					due to the use of threads.  This will not need to call the
+//					analysis methods, as at this point, the outputs of interest
+//					for every citizen have been stored in goalValues (either
+//					from the analyses or from the cache).
+//
+// Input Arguments:
+//		currentGenome	= const int* pointing to the index for the genome we're analyzing
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+double KinematicsGA::DetermineFitness(const int *citizen)
+{
+	// Here, instead of actually pointing to the current genome, the argument points
+	// to the index representing the current citizen.  Use Citizen[0] to get the
+	// index.
+	return ComputeFitness(goalValues + citizen[0] * GetGoalValueCount());
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		DetermineObjectives
+//
+// Description:		Objective function for multi-objective mode.  As with
+//					DetermineFitness(), the argument is the citizen index, and
+//					the goal values must already be stored in goalValues.
+//
+// Input Arguments:
+//		citizen		= const int* pointing to the index for the citizen
+//
+// Output Arguments:
+//		objectives	= double* (one per goal)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::DetermineObjectives(const int *citizen, double *objectives)
+{
+	ComputeObjectives(goalValues + citizen[0] * GetGoalValueCount(), 1, objectives);
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		ExtractGoalValues
+//
+// Description:		Copies the outputs of interest from the analyses of the
+//					specified car.  This is all the information needed to
+//					compute the fitness, so it is what we store in the cache.
+//
+// Input Arguments:
+//		carIndex	= const unsigned int& index of the analyzed car
+//
+// Output Arguments:
+//		values		= double* (GetGoalValueCount() long)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::ExtractGoalValues(const unsigned int &carIndex, double *values) const
+{
+	const KinematicOutputs *outputs(kinematicOutputArray + carIndex * inputList.GetCount());
+
+	// For goals that are not deltas, both inputs are the same
+	unsigned int i;
+	for (i = 0; i < goalPlan.size(); i++)
+	{
+		values[2 * i] = outputs[goalPlan[i].beforeInput].GetOutputValue(goalPlan[i].output);
+		values[2 * i + 1] = outputs[goalPlan[i].afterInput].GetOutputValue(goalPlan[i].output);
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		ComputeFitness
+//
+// Description:		Computes the fitness from the outputs of interest.
+//
+// Input Arguments:
+//		values	= const double* (GetGoalValueCount() long)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double KinematicsGA::ComputeFitness(const double *values) const
+{
+	double fitness;
+	ComputeFitnesses(values, 1, &fitness);
+	return fitness;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		ComputeFitnesses
+//
+// Description:		Computes the fitnesses of several citizens from their
+//					outputs of interest.  The loops run over the goal plan
+//					first and the citizens second, so the inner loop is the
+//					same arithmetic applied to each citizen.
+//
+// Input Arguments:
+//		values	= const double* (count * GetGoalValueCount() long)
+//		count	= const unsigned int& number of citizens
+//
+// Output Arguments:
+//		fitnesses	= double* (count long)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::ComputeFitnesses(const double *values, const unsigned int &count,
+	double *fitnesses) const
+{
+	const unsigned int valueCount(GetGoalValueCount());
+	unsigned int i, j;
+	for (j = 0; j < count; j++)
+		fitnesses[j] = 0.0;
+
+	double error;
+	for (i = 0; i < goalPlan.size(); i++)
+	{
+		const GoalPlanEntry &goal(goalPlan[i]);
+		const double *goalValue(values + 2 * i);
+		for (j = 0; j < count; j++)
+		{
+			// Add to the fitness according to the following formula:
+			// Fitness (for each goal) = fabs(DesiredValue - ActualValue) * Importance / ExpectedDeviation
+			// Total fitness is the sum of the individual fitnesses
+			error = (goal.desiredValue - goal.afterFactor * goalValue[j * valueCount + 1]
+				+ goal.beforeFactor * goalValue[j * valueCount]) * goal.scale;
+
+			// If the output is undefined, make it a really big number (ruin the fitness)
+			if (VVASEMath::IsNaN(error))
+				fitnesses[j] += 1e10;
+			else
+				fitnesses[j] += fabs(error);
+		}
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		ComputeObjectives
+//
+// Description:		Computes the objectives (the contribution of each goal to
+//					the fitness) of several citizens from their outputs of
+//					interest.
+//
+// Input Arguments:
+//		values	= const double* (count * GetGoalValueCount() long)
+//		count	= const unsigned int& number of citizens
+//
+// Output Arguments:
+//		objectives	= double* (count * number of goals long)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::ComputeObjectives(const double *values, const unsigned int &count,
+	double *objectives) const
+{
+	const unsigned int valueCount(GetGoalValueCount());
+	const unsigned int goalCount(goalPlan.size());
+	unsigned int i, j;
+	double error;
+	for (i = 0; i < goalCount; i++)
+	{
+		const GoalPlanEntry &goal(goalPlan[i]);
+		const double *goalValue(values + 2 * i);
+		for (j = 0; j < count; j++)
+		{
+			error = (goal.desiredValue - goal.afterFactor * goalValue[j * valueCount + 1]
+				+ goal.beforeFactor * goalValue[j * valueCount]) * goal.scale;
+
+			// Undefined outputs are treated the same as for the fitness
+			if (VVASEMath::IsNaN(error))
+				objectives[j * goalCount + i] = 1e10;
+			else
+				objectives[j * goalCount + i] = fabs(error);
+		}
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		GetGoalError
+//
+// Description:		Computes the weighted error for one goal from the outputs
+//					of interest (NaN if an output is undefined).
+//
+// Input Arguments:
+//		values	= const double* (GetGoalValueCount() long)
+//		goal	= const unsigned int& index of the goal
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double, (DesiredValue - ActualValue) * Importance / ExpectedDeviation
+//
+//==========================================================================
+double KinematicsGA::GetGoalError(const double *values, const unsigned int &goal) const
+{
+	if (VVASEMath::IsNaN(values[2 * goal]) || VVASEMath::IsNaN(values[2 * goal + 1]))
+		return std::numeric_limits<double>::quiet_NaN();
+
+	const GoalPlanEntry &entry(goalPlan[goal]);
+	return (entry.desiredValue - entry.afterFactor * values[2 * goal + 1]
+		+ entry.beforeFactor * values[2 * goal]) * entry.scale;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		SetUp
+//
+// Description:		Calls the parent class's initialization routine.
+//
+// Input Arguments:
+//		targetCar	= const Car& pointing to the object to optimize
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::SetUp(const Car &targetCar)
+{
+	gsaMutex.Lock();
+	DebugLog::GetInstance()->Log(_T("KinematicsGA::SetUp (lock)"));
+
+	int *phenotypeSizes = new int[geneList.GetCount()];
+	unsigned int i;
+	for (i = 0; i < geneList.GetCount(); i++)
+		phenotypeSizes[i] = geneList[i]->numberOfValues;
+
+	this->targetCar = &targetCar;
+
+	DebugLog::GetInstance()->Log(_T("KinematicsGA::SetUp (unlock)"));
+	gsaMutex.Unlock();
+
+	InitializeAlgorithm(populationSize, generationLimit, geneList.GetCount(),
+		phenotypeSizes, true, crossover, elitism, mutation);
+
+
+	wxMutexLocker lock(gsaMutex);
+	DebugLog::GetInstance()->Log(_T("KinematicsGA::SetUp (locker)"));
+
+	delete [] phenotypeSizes;
+
+	DetermineAllInputs();
+
+	for (i = 0; i < numberOfCars; i++)
+		delete originalCarArray[i];
+	delete [] originalCarArray;
+	delete [] kinematicOutputArray;
+
+	// One car per citizen; the kinematics solver only copies the suspension for each input
+	numberOfCars = populationSize;
+
+	kinematicOutputArray = new KinematicOutputs[populationSize * inputList.GetCount()];
+	originalCarArray = new Car*[numberOfCars];
+	for (i = 0; i < numberOfCars; i++)
+		originalCarArray[i] = new Car();
+
+	delete [] goalValues;
+	goalValues = new double[populationSize * GetGoalValueCount()];
+
+	outputMask = 0;
+	for (i = 0; i < goalList.GetCount(); i++)
+		outputMask |= KinematicOutputs::GetOutputMask(goalList[i]->output);
+
+	wxMutexLocker cacheLock(cacheMutex);
+	cache.Initialize(geneList.GetCount(), GetGoalValueCount(), cacheMemoryLimit);
+	surrogate.Initialize(geneList.GetCount(), GetGoalValueCount(), surrogateSampleLimit);
+
+	refinedValues.clear();
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		SetCarGenome
+//
+// Description:		Updates the original car so it represents the specified genome.
+//
+// Input Arguments:
+//		carIndex		= int specifying the index to use for the car array (citizen)
+//		currentGenome	= const int* pointing to the genome describing the desired car
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::SetCarGenome(int carIndex, const int *currentGenome)
+{
+	std::vector<double> values(geneList.GetCount());
+	unsigned int i;
+	for (i = 0; i < geneList.GetCount(); i++)
+		values[i] = GetGeneValue(i, currentGenome[i]);
+
+	SetCarValues(carIndex, values.data());
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		GetGeneValue
+//
+// Description:		Returns the hardpoint coordinate represented by the
+//					specified phenotype.
+//
+// Input Arguments:
+//		gene		= const unsigned int& index of the gene
+//		phenotype	= const int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double KinematicsGA::GetGeneValue(const unsigned int &gene, const int &phenotype) const
+{
+	const Gene *currentGene(geneList[gene]);
+	return currentGene->minimum +
+		double(currentGene->numberOfValues - phenotype - 1)
+		* (currentGene->maximum - currentGene->minimum) / double(currentGene->numberOfValues - 1);
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		SetCarValues
+//
+// Description:		Updates the original car so the hardpoint coordinate
+//					associated with each gene has the specified value.  Unlike
+//					genomes, the values need not be one of the gene's discrete
+//					phenotypes.
+//
+// Input Arguments:
+//		carIndex	= int specifying the index to use for the car array
+//		values		= const double* containing one coordinate for each gene
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::SetCarValues(int carIndex, const double *values)
+{
+	// Change the appropriate values to make this new car match the values
+	Corner *currentCorner;
+	Corner *oppositeCorner;
+
+	// Get locks on all the cars we're manipulating
+	// NOTE:  Always lock working car first, then lock original car (consistency required to prevent deadlocks)
+	wxMutexLocker targetLocker(targetCar->GetMutex());
+	DebugLog::GetInstance()->Log(_T("KinematicsGA::SetCarGenome (targetLocker)"));
+	wxMutexLocker originalLocker(originalCarArray[carIndex]->GetMutex());
+	DebugLog::GetInstance()->Log(_T("KinematicsGA::SetCarGenome (originalLocker)"));
+
+	// Set the original and working cars equal to the target car
+	*originalCarArray[carIndex] = *targetCar;
+
+	// Go through all of the genes, and adjust the variables to match the current genome
+	Gene *currentGene;
+	unsigned int i;
+	for (i = 0; i < geneList.GetCount(); i++)
+	{
+		// Get the current gene
+		currentGene = geneList[i];
+
+		// Set the current and opposite corners
+		if (currentGene->location == Corner::LocationLeftFront)
+		{
+			currentCorner = &originalCarArray[carIndex]->suspension->leftFront;
+			oppositeCorner = &originalCarArray[carIndex]->suspension->rightFront;
+		}
+		else if (currentGene->location == Corner::LocationRightFront)
+		{
+			currentCorner = &originalCarArray[carIndex]->suspension->rightFront;
+			oppositeCorner = &originalCarArray[carIndex]->suspension->leftFront;
+		}
+		else if (currentGene->location == Corner::LocationLeftRear)
+		{
+			currentCorner = &originalCarArray[carIndex]->suspension->leftRear;
+			oppositeCorner = &originalCarArray[carIndex]->suspension->rightRear;
+		}
+		else
+		{
+			currentCorner = &originalCarArray[carIndex]->suspension->rightRear;
+			oppositeCorner = &originalCarArray[carIndex]->suspension->leftRear;
+		}
+
+		// Determine which component of the vector to vary
+		if (currentGene->direction == Vector::AxisX)
+		{
+			// Set the appropriate variable to the value for this gene
+			currentCorner->hardpoints[currentGene->hardpoint].x = values[i];
+
+			// If there is a tied-to variable specified, update that as well
+			if (currentGene->tiedTo != Corner::NumberOfHardpoints)
+				currentCorner->hardpoints[currentGene->tiedTo].x =
+					currentCorner->hardpoints[currentGene->hardpoint].x;
+
+			// If the suspension is symmetric, also update the point on the opposite corner
+			if (targetCar->suspension->isSymmetric)
+			{
+				// Copy the values from one side to the other
+				oppositeCorner->hardpoints[currentGene->hardpoint].x =
+					currentCorner->hardpoints[currentGene->hardpoint].x;
+
+				// If there was a tied-to variable specified, we must update that on
+				// the other side of the car, too
+				if (currentGene->tiedTo != Corner::NumberOfHardpoints)
+					oppositeCorner->hardpoints[currentGene->tiedTo].x =
+						oppositeCorner->hardpoints[currentGene->hardpoint].x;
+			}
+		}
+		else if (currentGene->direction == Vector::AxisY)
+		{
+			// Set the appropriate variable to the value for this gene
+			currentCorner->hardpoints[currentGene->hardpoint].y = values[i];
+
+			// If there is a tied-to variable specified, update that as well
+			if (currentGene->tiedTo != Corner::NumberOfHardpoints)
+				currentCorner->hardpoints[currentGene->tiedTo].y =
+					currentCorner->hardpoints[currentGene->hardpoint].y;
+
+			// If the suspension is symmetric, also update the point on the opposite corner
+			if (targetCar->suspension->isSymmetric)
+			{
+				// Copy the values from one side to the other (Note Y is flipped)
+				oppositeCorner->hardpoints[currentGene->hardpoint].y =
+					-currentCorner->hardpoints[currentGene->hardpoint].y;
+
+				// If there was a tied-to variable specified, we must update that on
+				// the other side of the car, too
+				if (currentGene->tiedTo != Corner::NumberOfHardpoints)
+					oppositeCorner->hardpoints[currentGene->tiedTo].y =
+						oppositeCorner->hardpoints[currentGene->hardpoint].y;
+			}
+		}
+		else// Vector::AxisZ
+		{
+			// Set the appropriate variable to the value for this gene
+			currentCorner->hardpoints[currentGene->hardpoint].z = values[i];
+
+			// If there is a tied-to variable specified, update that as well
+			if (currentGene->tiedTo != Corner::NumberOfHardpoints)
+				currentCorner->hardpoints[currentGene->tiedTo].z =
+					currentCorner->hardpoints[currentGene->hardpoint].z;
+
+			// If the suspension is symmetric, also update the point on the opposite corner
+			if (targetCar->suspension->isSymmetric)
+			{
+				// Copy the values from one side to the other
+				oppositeCorner->hardpoints[currentGene->hardpoint].z =
+					currentCorner->hardpoints[currentGene->hardpoint].z;
+
+				// If there was a tied-to variable specified, we must update that on
+				// the other side of the car, too
+				if (currentGene->tiedTo != Corner::NumberOfHardpoints)
+					oppositeCorner->hardpoints[currentGene->tiedTo].z =
+						oppositeCorner->hardpoints[currentGene->hardpoint].z;
+			}
+		}
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		PerformAdditionalActions
+//
+// Description:		Prints current status to the screen.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::PerformAdditionalActions()
+{
+	double averageFitness = 0.0;
+	int i;
+	for (i = 0; i < populationSize; i++)
+		averageFitness += GetFitnesses(currentGeneration)[i];
+	averageFitness /= (double)populationSize;
+
+	double maximumFitness = GetBestFitness(currentGeneration);
+
+	Debugger::GetInstance() << "Completed Generation " << currentGeneration + 1 << Debugger::PriorityVeryHigh;
+	Debugger::GetInstance() << "\tAverage Fitness:  " <<
+		UnitConverter::GetInstance().FormatNumber(averageFitness) << Debugger::PriorityVeryHigh;
+	Debugger::GetInstance() << "\tBest Fitness:     " <<
+		UnitConverter::GetInstance().FormatNumber(maximumFitness) << Debugger::PriorityVeryHigh;
+	Debugger::GetInstance() << "\tCache Hit Rate:   " <<
+		UnitConverter::GetInstance().FormatNumber(GetCacheHitRate() * 100.0) << "%" << Debugger::PriorityLow;
+
+	if (currentGeneration == generationLimit - 1)
+	{
+		if (refinementIterations > 0)
+			RefineBestCitizen();
+		isRunning = false;
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		RefineBestCitizen
+//
+// Description:		Polishes the best citizen of the current generation with a
+//					continuous optimization.  The least-squares problem is
+//					solved on the individual goal errors, but the result is
+//					only kept if it also improves the fitness.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::RefineBestCitizen()
+{
+	std::vector<double> values(numberOfGenes), lower(numberOfGenes), upper(numberOfGenes);
+	int i;
+	for (i = 0; i < numberOfGenes; i++)
+	{
+		values[i] = GetGeneValue(i, GetBestGenome(currentGeneration)[i]);
+		lower[i] = std::min(geneList[i]->minimum, geneList[i]->maximum);
+		upper[i] = std::max(geneList[i]->minimum, geneList[i]->maximum);
+	}
+
+	Refinement refinement(*this);
+	refinement.SetIterationLimit(refinementIterations);
+	if (!refinement.Optimize(values.data(), numberOfGenes, lower.data(), upper.data()))
+	{
+		Debugger::GetInstance() << "Warning:  Refinement of best citizen failed" << Debugger::PriorityMedium;
+		return;
+	}
+
+	// Re-analyze the result, as the fitness differs from the least-squares objective
+	std::vector<double> goalValueBuffer(GetGoalValueCount());
+	SetCarValues(0, values.data());
+	AnalyzeCars(1, false);
+	ExtractGoalValues(0, goalValueBuffer.data());
+
+	const double refinedFitness(ComputeFitness(goalValueBuffer.data()));
+	if (refinedFitness < GetBestFitness(currentGeneration))
+		refinedValues = values;
+
+	Debugger::GetInstance() << "Refinement (" << refinement.GetIterations() << " iterations)" << Debugger::PriorityVeryHigh;
+	Debugger::GetInstance() << "\tBest Fitness:     " <<
+		UnitConverter::GetInstance().FormatNumber(std::min(refinedFitness,
+		GetBestFitness(currentGeneration))) << Debugger::PriorityVeryHigh;
+}
+
+//==========================================================================
+// Class:			KinematicsGA::Refinement
+// Function:		GetResidualCount
+//
+// Description:		Returns the number of residuals (one per goal).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int KinematicsGA::Refinement::GetResidualCount() const
+{
+	return optimization.goalList.GetCount();
+}
+
+//==========================================================================
+// Class:			KinematicsGA::Refinement
+// Function:		ComputeResiduals
+//
+// Description:		Analyzes each set of gene values (as many at once as there
+//					are cars) and computes the goal errors.  Undefined outputs
+//					are given a large error.
+//
+// Input Arguments:
+//		parameterSets	= const double* (one value per gene for each set)
+//		setCount		= const unsigned int&
+//
+// Output Arguments:
+//		residuals		= double* (one per goal for each set)
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool KinematicsGA::Refinement::ComputeResiduals(const double *parameterSets,
+	const unsigned int &setCount, double *residuals)
+{
+	const unsigned int geneCount(optimization.geneList.GetCount());
+	const unsigned int goalCount(optimization.goalList.GetCount());
+	std::vector<double> values(optimization.GetGoalValueCount());
+
+	unsigned int first, i, j, chunkSize;
+	for (first = 0; first < setCount; first += chunkSize)
+	{
+		chunkSize = std::min(setCount - first, optimization.numberOfCars);
+		for (i = 0; i < chunkSize; i++)
+			optimization.SetCarValues(i, parameterSets + (first + i) * geneCount);
+
+		optimization.AnalyzeCars(chunkSize, false);
+
+		for (i = 0; i < chunkSize; i++)
+		{
+			optimization.ExtractGoalValues(i, values.data());
+			for (j = 0; j < goalCount; j++)
+			{
+				residuals[(first + i) * goalCount + j] = optimization.GetGoalError(values.data(), j);
+				if (VVASEMath::IsNaN(residuals[(first + i) * goalCount + j]))
+					residuals[(first + i) * goalCount + j] = 1e5;
+			}
+		}
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			KinematicsGA::Refinement
+// Function:		GetFiniteDifferenceStep
+//
+// Description:		Returns the step used to compute the derivatives.  The
+//					kinematics are solved iteratively, so the step must be
+//					large compared to the solver tolerance; a small fraction
+//					of the gene's range is used.
+//
+// Input Arguments:
+//		parameter	= const unsigned int& index of the gene
+//		value		= const double& (unused)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double KinematicsGA::Refinement::GetFiniteDifferenceStep(const unsigned int &parameter,
+	const double &/*value*/) const
+{
+	const double range(fabs(optimization.geneList[parameter]->maximum
+		- optimization.geneList[parameter]->minimum));
+	return std::max(1.0e-3 * range, 1.0e-6);
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		AddGene
+//
+// Description:		Adds a gene to the list to be optimized.
+//
+// Input Arguments:
+//		variable		= const Corner::Hardpoints& specifying to the value to be changed
+//		tiedTo			= const Corner::Hardpoints& specifying to a value that will always equal
+//						  Variable
+//		location		= const Corner::Location& specifying the associated corner
+//		direction		= const Vector::Axis& specifying the component of the hardpoint
+//						  to optimize
+//		minimum			= const double& minimum value for this gene
+//		maximum			= const double& maximum value for this gene
+//		numberOfValues	= const int& specifying the resolution for this gene (include the min and max,
+//						  must be at least 2)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::AddGene(const Corner::Hardpoints &hardpoint, const Corner::Hardpoints &tiedTo,
+						const Corner::Location &location, const Vector::Axis &direction,
+						const double &minimum, const double &maximum, const int &numberOfValues)
+{
+	Gene *newGene = new Gene;
+
+	newGene->hardpoint		= hardpoint;
+	newGene->tiedTo			= tiedTo;
+	newGene->location		= location;
+	newGene->direction		= direction;
+	newGene->minimum		= minimum;
+	newGene->maximum		= maximum;
+	newGene->numberOfValues	= numberOfValues;
+
+	geneList.Add(newGene);
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		AddGoal
+//
+// Description:		Adds a goal to the list of optimization criteria.
+//
+// Input Arguments:
+//		output				= const KinematicOutputs::OutputsComplete& specifying
+//							  the output to optimize
+//		desiredValue		= const double& specifying the desired value of the
+//							  output
+//		expectedDeviation	= const double& specifying the allowable range for
+//							  the value
+//		importance			= const double& specifying the relative importance
+//							  of this goal
+//		beforeInputs		= const Kinematics::Inputs& specifying the state
+//							  of the car
+//		afterInputs			= const Kinematics::Inputs& specifying the second state
+//							  of the car (if specified, the optimization is the
+//							  difference between the output at the first and
+//							  second state)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::AddGoal(const KinematicOutputs::OutputsComplete &output, const double &desiredValue,
+		const double &expectedDeviation, const double &importance, const Kinematics::Inputs &beforeInputs,
+		const Kinematics::Inputs &afterInputs)
+{
+	Goal *newGoal = new Goal;
+
+	newGoal->output				= output;
+	newGoal->desiredValue		= desiredValue;
+	newGoal->expectedDeviation	= expectedDeviation;
+	newGoal->importance			= importance;
+	newGoal->beforeInputs		= beforeInputs;
+	newGoal->afterInputs		= afterInputs;
+
+	goalList.Add(newGoal);
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		UpdateGene
+//
+// Description:		Updates the specified gene.
+//
+// Input Arguments:
+//		index			= const int& specifying the goal to update
+//		hardpoint		= const Corner::Hardpoints& specifying to the value to be changed
+//		tiedTo			= const Corner::Hardpoints& specifying to a value that will always equal
+//						  Variable
+//		location		= const Corner::Location& specifying the associated corner
+//		direction		= const Vector::Axis& specifying the component of the hardpoint
+//						  to optimize
+//		minimum			= const double& minimum value for this gene
+//		maximum			= const double& maximum value for this gene
+//		numberOfValues	= const int& specifying the resolution for this gene (include the min and max,
+//						  must be at least 2)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::UpdateGene(const int &index, const Corner::Hardpoints &hardpoint, const Corner::Hardpoints &tiedTo,
+						const Corner::Location &location, const Vector::Axis &direction,
+						const double &minimum, const double &maximum, const int &numberOfValues)
+{
+	geneList[index]->hardpoint		= hardpoint;
+	geneList[index]->tiedTo			= tiedTo;
+	geneList[index]->location		= location;
+	geneList[index]->direction		= direction;
+	geneList[index]->minimum		= minimum;
+	geneList[index]->maximum		= maximum;
+	geneList[index]->numberOfValues	= numberOfValues;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		UpdateGoal
+//
+// Description:		Updates the specified goal.
+//
+// Input Arguments:
+//		index				= const int& specifying the goal to update
+//		output				= const KinematicOutputs::OutputsComplete& specifying
+//							  the output to optimize
+//		desiredValue		= const double& specifying the desired value of the
+//							  output
+//		expectedDeviation	= const double& specifying the allowable range for
+//							  the value
+//		importance			= const double& specifying the relative importance
+//							  of this goal
+//		beforeInputs		= const Kinematics::Inputs& specifying the state
+//							  of the car
+//		afterInputs			= const Kinematics::Inputs& specifying the second state
+//							  of the car (if specified, the optimization is the
+//							  difference between the output at the first and
+//							  second state)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::UpdateGoal(const int &index, const KinematicOutputs::OutputsComplete &output, const double &desiredValue,
+		const double &expectedDeviation, const double &importance, const Kinematics::Inputs &beforeInputs,
+		const Kinematics::Inputs &afterInputs)
+{
+	goalList[index]->output				= output;
+	goalList[index]->desiredValue		= desiredValue;
+	goalList[index]->expectedDeviation	= expectedDeviation;
+	goalList[index]->importance			= importance;
+	goalList[index]->beforeInputs		= beforeInputs;
+	goalList[index]->afterInputs		= afterInputs;
+}
+
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		DetermineAllInputs
+//
+// Description:		Parses all of the available inputs and compiles a list of
+//					each set of input conditions so every input is represented
+//					exactly once.  Also builds the goal plan, which refers to
+//					the inputs by their index in this list.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::DetermineAllInputs()
+{
+	inputList.Clear();
+	goalPlan.resize(goalList.GetCount());
+
+	unsigned int i;
+	for (i = 0; i < goalList.GetCount(); i++)
+	{
+		GoalPlanEntry &entry(goalPlan[i]);
+		entry.output = goalList[i]->output;
+		entry.desiredValue = goalList[i]->desiredValue;
+		entry.scale = goalList[i]->importance / goalList[i]->expectedDeviation;
+		entry.beforeInput = AddInput(goalList[i]->beforeInputs);
+
+		// Only delta goals need the second set of inputs
+		if (goalList[i]->beforeInputs == goalList[i]->afterInputs)
+		{
+			entry.afterInput = entry.beforeInput;
+			entry.afterFactor = 0.0;
+			entry.beforeFactor = -1.0;
+		}
+		else
+		{
+			entry.afterInput = AddInput(goalList[i]->afterInputs);
+			entry.afterFactor = 1.0;
+			entry.beforeFactor = 1.0;
+		}
+	}
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		AddInput
+//
+// Description:		Adds the specified inputs to the input list, unless an
+//					identical set of inputs is already in the list.
+//
+// Input Arguments:
+//		inputs	= const Kinematics::Inputs&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, index of the inputs in the input list
+//
+//==========================================================================
+unsigned int KinematicsGA::AddInput(const Kinematics::Inputs &inputs)
+{
+	unsigned int i;
+	for (i = 0; i < inputList.GetCount(); i++)
+	{
+		if (inputs == *(inputList[i]))
+			return i;
+	}
+
+	// Since we're adding this to a managed list, the list takes ownership
+	Kinematics::Inputs *input = new Kinematics::Inputs;
+	*input = inputs;
+	inputList.Add(input);
+
+	return inputList.GetCount() - 1;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		UpdateResultingCar
+//
+// Description:		Updates the target car to match the best fit genome.
+//
+// Input Arguments:
+//		result	= Car&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::UpdateResultingCar(Car &result)
+{
+	wxMutexLocker lock(gsaMutex);
+	DebugLog::GetInstance()->Log(_T("KinematicsGA::UpdateResultingCar (locker)"));
+
+	// Use the best citizen from the final generation (or its refinement)
+	if (!refinedValues.empty())
+		SetCarValues(0, refinedValues.data());
+	else
+		SetCarGenome(0, GetBestGenome(generationLimit - 1));
+
+	wxMutexLocker carLock(result.GetMutex());
+	result = *originalCarArray[0];
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		WriteFileHeader
+//
+// Description:		Writes the file header to the specified output stream.
+//
+// Input Arguments:
+//		outFile	= std::ofstream* to write to
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsGA::WriteFileHeader(std::ofstream *outFile)
+{
+	FileHeaderInfo header;
+	header.fileVersion = currentFileVersion;
+	outFile->seekp(0);
+	outFile->write((char*)&header, sizeof(FileHeaderInfo));
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		ReadFileHeader
+//
+// Description:		Reads the file header information from the specified input stream.
+//
+// Input Arguments:
+//		inFile	= std::ifstream* to read from
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FileHeaderInfo containing the header information
+//
+//==========================================================================
+KinematicsGA::FileHeaderInfo KinematicsGA::ReadFileHeader(std::ifstream *inFile)
+{
+	// Set get pointer to the start of the file
+	inFile->seekg(0);
+
+	// Read the header struct
+	char buffer[sizeof(FileHeaderInfo)];
+	inFile->read((char*)buffer, sizeof(FileHeaderInfo));
+
+	return *reinterpret_cast<FileHeaderInfo*>(buffer);
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		Write
+//
+// Description:		Saves this object to file.
+//
+// Input Arguments:
+//		fileName	= wxString containing the path and file name to write to.
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//==========================================================================
+bool KinematicsGA::Write(wxString fileName)
+{
+	// Ensure exclusive access to this object
+	wxMutexLocker lock(gsaMutex);
+
+	// Open the specified file
+	std::ofstream outFile(fileName.mb_str(), ios::out | ios::binary);
+
+	// Make sure the file was opened OK
+	if (!outFile.is_open() || !outFile.good())
+		return false;
+
+	// Write the file header information
+	WriteFileHeader(&outFile);
+
+	// Write this object's data
+	outFile.write((char*)&populationSize, sizeof(int));
+	outFile.write((char*)&generationLimit, sizeof(int));
+	outFile.write((char*)&elitism, sizeof(double));
+	outFile.write((char*)&mutation, sizeof(double));
+	outFile.write((char*)&crossover, sizeof(int));
+
+	unsigned int i = geneList.GetCount();
+	outFile.write((char*)&i, sizeof(int));
+	for (i = 0; i < geneList.GetCount(); i++)
+		outFile.write((char*)geneList[i], sizeof(Gene));
+
+	i = goalList.GetCount();
+	outFile.write((char*)&i, sizeof(int));
+	for (i = 0; i < goalList.GetCount(); i++)
+		outFile.write((char*)goalList[i], sizeof(Goal));
+
+	// Close the file
+	outFile.close();
+
+	return true;
+}
+
+//==========================================================================
+// Class:			KinematicsGA
+// Function:		Read
+//
+// Description:		Loads this object from file.
+//
+// Input Arguments:
+//		fileName	= wxString containing path and file name to read from
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//==========================================================================
+bool KinematicsGA::Read(wxString fileName)
+{
+	wxMutexLocker lock(gsaMutex);
+
+	geneList.Clear();
+	goalList.Clear();
+
+	std::ifstream inFile(fileName.mb_str(), ios::in | ios::binary);
+	if (!inFile.is_open() || !inFile.good())
+		return false;
+
+	FileHeaderInfo header = ReadFileHeader(&inFile);
+
+	if (header.fileVersion != currentFileVersion)
+	{
+		Debugger::GetInstance() << "ERROR:  Incompatible file versions - could not open file!" << Debugger::PriorityHigh;
+		inFile.close();
+		return false;
+	}
+
+	// Read this object's data
+	inFile.read((char*)&populationSize, sizeof(int));
+	inFile.read((char*)&generationLimit, sizeof(int));
+	inFile.read((char*)&elitism, sizeof(double));
+	inFile.read((char*)&mutation, sizeof(double));
+	inFile.read((char*)&crossover, sizeof(int));
+
+	int tempCount, i;
+	Gene *tempGene;
+	inFile.read((char*)&tempCount, sizeof(int));
+	for (i = 0; i < tempCount; i++)
+	{
+		tempGene = new Gene;
+		inFile.read((char*)tempGene, sizeof(Gene));
+		geneList.Add(tempGene);
+	}
+
+	Goal *tempGoal;
+	inFile.read((char*)&tempCount, sizeof(int));
+	for (i = 0; i < tempCount; i++)
+	{
+		tempGoal = new Goal;
+		inFile.read((char*)tempGoal, sizeof(Goal));
+		goalList.Add(tempGoal);
+	}
+
+	inFile.close();
+
+	return true;
+}
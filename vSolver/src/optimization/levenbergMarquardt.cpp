@@ -0,0 +1,240 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  levenbergMarquardt.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Base class for bounded, continuous least-squares optimization using
+//				 the Levenberg-Marquardt algorithm.  The Jacobian is computed by forward
+//				 differences, with every perturbed parameter set passed to the derived
+//				 class in a single call so that they may be evaluated concurrently.
+// History:
+
+// Standard C++ headers
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+// VVASE headers
+#include "vSolver/optimization/levenbergMarquardt.h"
+#include "vMath/matrix.h"
+
+//==========================================================================
+// Class:			LevenbergMarquardt
+// Function:		LevenbergMarquardt
+//
+// Description:		Constructor for the LevenbergMarquardt class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+LevenbergMarquardt::LevenbergMarquardt()
+{
+	iterationLimit = 20;
+	tolerance = 1.0e-6;
+	sumOfSquares = 0.0;
+	iterations = 0;
+}
+
+//==========================================================================
+// Class:			LevenbergMarquardt
+// Function:		~LevenbergMarquardt
+//
+// Description:		Destructor for the LevenbergMarquardt class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+LevenbergMarquardt::~LevenbergMarquardt()
+{
+}
+
+//==========================================================================
+// Class:			LevenbergMarquardt
+// Function:		Optimize
+//
+// Description:		Minimizes the sum of the squared residuals, starting from
+//					the specified parameters.  Steps that leave the bounds are
+//					clipped.  Stops when the iteration limit is reached, when
+//					the relative improvement falls below the tolerance, or
+//					when no damping factor produces an improvement.
+//
+// Input Arguments:
+//		parameters		= double* containing the initial guess
+//		parameterCount	= const unsigned int&
+//		lower			= const double* lower bounds (may be NULL)
+//		upper			= const double* upper bounds (may be NULL)
+//
+// Output Arguments:
+//		parameters		= double* containing the best parameters found
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LevenbergMarquardt::Optimize(double *parameters, const unsigned int &parameterCount,
+	const double *lower, const double *upper)
+{
+	const unsigned int residualCount(GetResidualCount());
+	std::vector<double> residuals(residualCount), trialResiduals(residualCount);
+	std::vector<double> perturbed(parameterCount * parameterCount), trial(parameterCount);
+	std::vector<double> jacobianResiduals(parameterCount * residualCount), steps(parameterCount);
+
+	iterations = 0;
+	if (!ComputeResiduals(parameters, 1, residuals.data()))
+		return false;
+	sumOfSquares = GetSumOfSquares(residuals.data(), residualCount);
+
+	const unsigned int maximumDampingAttempts(10);
+	double lambda(1.0e-3), trialSumOfSquares;
+	unsigned int i, j, k, attempt;
+	Matrix jacobian(residualCount, parameterCount), hessian, gradient, step;
+	while (iterations < iterationLimit && sumOfSquares > 0.0)
+	{
+		// Each perturbed set is stepped away from the nearest bound
+		for (i = 0; i < parameterCount; i++)
+		{
+			std::copy(parameters, parameters + parameterCount, perturbed.begin() + i * parameterCount);
+			steps[i] = GetFiniteDifferenceStep(i, parameters[i]);
+			if (upper && parameters[i] + steps[i] > upper[i])
+				steps[i] = -steps[i];
+			perturbed[i * parameterCount + i] += steps[i];
+		}
+
+		if (!ComputeResiduals(perturbed.data(), parameterCount, jacobianResiduals.data()))
+			return false;
+
+		for (i = 0; i < residualCount; i++)
+		{
+			for (j = 0; j < parameterCount; j++)
+				jacobian(i, j) = (jacobianResiduals[j * residualCount + i] - residuals[i]) / steps[j];
+		}
+
+		hessian = jacobian.GetTranspose() * jacobian;
+		gradient = Matrix(parameterCount, 1);
+		for (j = 0; j < parameterCount; j++)
+		{
+			for (i = 0; i < residualCount; i++)
+				gradient(j, 0) -= jacobian(i, j) * residuals[i];
+		}
+
+		bool improved(false);
+		for (attempt = 0; attempt < maximumDampingAttempts && !improved; attempt++)
+		{
+			Matrix damped(hessian);
+			for (j = 0; j < parameterCount; j++)
+				damped(j, j) += lambda * (hessian(j, j) + 1.0e-12);
+
+			if (!damped.LeftDivide(gradient, step))
+				return false;
+
+			for (k = 0; k < parameterCount; k++)
+			{
+				trial[k] = parameters[k] + step(k, 0);
+				if (lower)
+					trial[k] = std::max(trial[k], lower[k]);
+				if (upper)
+					trial[k] = std::min(trial[k], upper[k]);
+			}
+
+			if (!ComputeResiduals(trial.data(), 1, trialResiduals.data()))
+				return false;
+			trialSumOfSquares = GetSumOfSquares(trialResiduals.data(), residualCount);
+
+			if (trialSumOfSquares < sumOfSquares)
+				improved = true;
+			else
+				lambda *= 10.0;
+		}
+
+		if (!improved)
+			break;
+
+		iterations++;
+		lambda = std::max(lambda * 0.1, 1.0e-12);
+
+		const bool converged(sumOfSquares - trialSumOfSquares <= tolerance * sumOfSquares);
+		std::copy(trial.begin(), trial.end(), parameters);
+		residuals.swap(trialResiduals);
+		sumOfSquares = trialSumOfSquares;
+
+		if (converged)
+			break;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			LevenbergMarquardt
+// Function:		GetFiniteDifferenceStep
+//
+// Description:		Returns the forward difference step for the specified
+//					parameter.  Derived classes whose residuals are computed
+//					iteratively should override this with a step that is large
+//					compared to the solver tolerance.
+//
+// Input Arguments:
+//		parameter	= const unsigned int& index of the parameter
+//		value		= const double& current value of the parameter
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double LevenbergMarquardt::GetFiniteDifferenceStep(const unsigned int &/*parameter*/,
+	const double &value) const
+{
+	return 1.0e-6 * std::max(fabs(value), 1.0);
+}
+
+//==========================================================================
+// Class:			LevenbergMarquardt
+// Function:		GetSumOfSquares
+//
+// Description:		Returns the sum of the squared residuals.
+//
+// Input Arguments:
+//		residuals	= const double*
+//		count		= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double LevenbergMarquardt::GetSumOfSquares(const double *residuals, const unsigned int &count)
+{
+	double sum(0.0);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		sum += residuals[i] * residuals[i];
+
+	return sum;
+}
@@ -0,0 +1,414 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  paretoRanking.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Fast non-dominated sorting and crowding distance (as used by NSGA-II).
+//				 Ranks a set of points by Pareto dominance over several objectives, so
+//				 that trade-offs between the objectives can be explored in a single
+//				 optimization.
+// History:
+
+// Standard C++ headers
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+// VVASE headers
+#include "vSolver/optimization/paretoRanking.h"
+#include "vUtilities/debugger.h"
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		Constant Declarations
+//
+// Description:		Constant declarations for ParetoRanking class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int ParetoRanking::minimumParallelCount = 128;
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		ParetoRanking
+//
+// Description:		Constructor for the ParetoRanking class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ParetoRanking::ParetoRanking()
+{
+	numberOfThreads = 1;
+	objectives = NULL;
+	count = 0;
+	objectiveCount = 0;
+}
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		SetNumberOfThreads
+//
+// Description:		Sets the number of threads among which the ranking is
+//					split.
+//
+// Input Arguments:
+//		numberOfThreads	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ParetoRanking::SetNumberOfThreads(const unsigned int &numberOfThreads)
+{
+	this->numberOfThreads = std::max(1u, numberOfThreads);
+}
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		Rank
+//
+// Description:		Sorts the points into non-dominated fronts and computes
+//					the crowding distance of each point within its front.
+//
+// Input Arguments:
+//		objectives		= const double* (count * objectiveCount long, row-major)
+//		count			= const unsigned int& number of points
+//		objectiveCount	= const unsigned int& number of objectives for each point
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ParetoRanking::Rank(const double *objectives, const unsigned int &count,
+	const unsigned int &objectiveCount)
+{
+	this->objectives = objectives;
+	this->count = count;
+	this->objectiveCount = objectiveCount;
+
+	dominationCounts.assign(count, 0);
+	dominatedPoints.assign(count, std::vector<unsigned int>());
+	ComputeDominanceInParallel();
+
+	// Peel off the fronts:  removing one front releases the points that were
+	// dominated only by points in that front
+	ranks.assign(count, 0);
+	fronts.clear();
+
+	std::vector<unsigned int> front, nextFront;
+	unsigned int i, j;
+	for (i = 0; i < count; i++)
+	{
+		if (dominationCounts[i] == 0)
+			front.push_back(i);
+	}
+
+	while (!front.empty())
+	{
+		fronts.push_back(front);
+		nextFront.clear();
+		for (i = 0; i < front.size(); i++)
+		{
+			for (j = 0; j < dominatedPoints[front[i]].size(); j++)
+			{
+				if (--dominationCounts[dominatedPoints[front[i]][j]] == 0)
+				{
+					ranks[dominatedPoints[front[i]][j]] = fronts.size();
+					nextFront.push_back(dominatedPoints[front[i]][j]);
+				}
+			}
+		}
+
+		front.swap(nextFront);
+	}
+
+	ComputeCrowding();
+	SortFronts();
+}
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		Dominates
+//
+// Description:		Checks to see if one point dominates another (no worse in
+//					every objective and better in at least one).
+//
+// Input Arguments:
+//		a				= const double*
+//		b				= const double*
+//		objectiveCount	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if a dominates b
+//
+//==========================================================================
+bool ParetoRanking::Dominates(const double *a, const double *b, const unsigned int &objectiveCount)
+{
+	bool better(false);
+	unsigned int i;
+	for (i = 0; i < objectiveCount; i++)
+	{
+		if (a[i] > b[i])
+			return false;
+		else if (a[i] < b[i])
+			better = true;
+	}
+
+	return better;
+}
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		ComputeDominanceInParallel
+//
+// Description:		Splits the points into contiguous blocks and compares each
+//					block against every point in its own thread (the calling
+//					thread performs the first block).  Each block writes to
+//					separate elements, so no locking is required.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ParetoRanking::ComputeDominanceInParallel()
+{
+	const unsigned int threadCount(std::min(numberOfThreads, count));
+	if (count < minimumParallelCount || threadCount < 2)
+	{
+		ComputeDominance(0, count);
+		return;
+	}
+
+	std::vector<RankingThread*> threads(threadCount, NULL);
+	unsigned int i;
+	for (i = 1; i < threadCount; i++)
+	{
+		threads[i] = new RankingThread(*this, i * count / threadCount, (i + 1) * count / threadCount);
+		if (threads[i]->Run() != wxTHREAD_NO_ERROR)
+		{
+			Debugger::GetInstance() << "Warning (ParetoRanking):  Failed to start thread" << Debugger::PriorityLow;
+			delete threads[i];
+			threads[i] = NULL;
+			ComputeDominance(i * count / threadCount, (i + 1) * count / threadCount);
+		}
+	}
+
+	ComputeDominance(0, count / threadCount);
+
+	for (i = 1; i < threadCount; i++)
+	{
+		if (!threads[i])
+			continue;
+
+		threads[i]->Wait();
+		delete threads[i];
+	}
+}
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		ComputeDominance
+//
+// Description:		Compares the specified points against every other point.
+//					Only the entries for the specified points are modified.
+//
+// Input Arguments:
+//		first	= const unsigned int& first point
+//		last	= const unsigned int& one past the last point
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ParetoRanking::ComputeDominance(const unsigned int &first, const unsigned int &last)
+{
+	unsigned int i, j;
+	for (i = first; i < last; i++)
+	{
+		for (j = 0; j < count; j++)
+		{
+			if (i == j)
+				continue;
+
+			if (Dominates(objectives + i * objectiveCount, objectives + j * objectiveCount, objectiveCount))
+				dominatedPoints[i].push_back(j);
+			else if (Dominates(objectives + j * objectiveCount, objectives + i * objectiveCount, objectiveCount))
+				dominationCounts[i]++;
+		}
+	}
+}
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		ComputeCrowding
+//
+// Description:		Computes the crowding distance of each point (the sum over
+//					the objectives of the normalized distance between its
+//					neighbors within its front).  The points at the ends of
+//					each front have infinite distance.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ParetoRanking::ComputeCrowding()
+{
+	crowdingDistances.assign(count, 0.0);
+
+	const double infinity(std::numeric_limits<double>::infinity());
+	std::vector<std::pair<double, unsigned int> > sorted;
+	double range;
+	unsigned int i, j, k;
+	for (i = 0; i < objectiveCount; i++)
+	{
+		for (j = 0; j < fronts.size(); j++)
+		{
+			sorted.clear();
+			for (k = 0; k < fronts[j].size(); k++)
+				sorted.push_back(std::make_pair(objectives[fronts[j][k] * objectiveCount + i], fronts[j][k]));
+			std::sort(sorted.begin(), sorted.end());
+
+			crowdingDistances[sorted.front().second] = infinity;
+			crowdingDistances[sorted.back().second] = infinity;
+
+			range = sorted.back().first - sorted.front().first;
+			if (range <= 0.0)
+				continue;
+
+			for (k = 1; k + 1 < sorted.size(); k++)
+				crowdingDistances[sorted[k].second] += (sorted[k + 1].first - sorted[k - 1].first) / range;
+		}
+	}
+}
+
+//==========================================================================
+// Class:			ParetoRanking
+// Function:		SortFronts
+//
+// Description:		Builds the order of preference:  front by front, and
+//					within each front from the most isolated point to the
+//					most crowded point.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ParetoRanking::SortFronts()
+{
+	order.clear();
+
+	std::vector<std::pair<double, unsigned int> > sorted;
+	unsigned int i, j;
+	for (i = 0; i < fronts.size(); i++)
+	{
+		sorted.clear();
+		for (j = 0; j < fronts[i].size(); j++)
+			sorted.push_back(std::make_pair(-crowdingDistances[fronts[i][j]], fronts[i][j]));
+		std::sort(sorted.begin(), sorted.end());
+
+		for (j = 0; j < sorted.size(); j++)
+			order.push_back(sorted[j].second);
+	}
+}
+
+//==========================================================================
+// Class:			ParetoRanking::RankingThread
+// Function:		RankingThread
+//
+// Description:		Constructor for the RankingThread class.  The thread must
+//					be started with Run(), waited on with Wait() and then
+//					deleted by the caller.
+//
+// Input Arguments:
+//		ranking	= ParetoRanking& for which the work is done
+//		first	= const unsigned int& first point
+//		last	= const unsigned int& one past the last point
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ParetoRanking::RankingThread::RankingThread(ParetoRanking &ranking,
+	const unsigned int &first, const unsigned int &last)
+	: wxThread(wxTHREAD_JOINABLE), ranking(ranking), first(first), last(last)
+{
+	wxThread::Create();
+}
+
+//==========================================================================
+// Class:			ParetoRanking::RankingThread
+// Function:		Entry
+//
+// Description:		Thread entry point.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ExitCode (NULL)
+//
+//==========================================================================
+ParetoRanking::RankingThread::ExitCode ParetoRanking::RankingThread::Entry()
+{
+	ranking.ComputeDominance(first, last);
+	return NULL;
+}
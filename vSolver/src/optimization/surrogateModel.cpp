@@ -0,0 +1,311 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  surrogateModel.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Radial basis function interpolant that approximates an expensive
+//				 function from previously evaluated samples.  Allows genetic algorithms
+//				 to rank candidates cheaply and analyze only the most promising ones.
+// History:
+
+// Standard C++ headers
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+// VVASE headers
+#include "vSolver/optimization/surrogateModel.h"
+#include "vMath/matrix.h"
+#include "vMath/carMath.h"
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		SurrogateModel
+//
+// Description:		Constructor for the SurrogateModel class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+SurrogateModel::SurrogateModel()
+{
+	inputCount = 0;
+	outputCount = 0;
+	sampleLimit = 0;
+	Clear();
+}
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		Initialize
+//
+// Description:		Clears the model and sets its dimensions.
+//
+// Input Arguments:
+//		inputCount	= const unsigned int& number of inputs for each sample
+//		outputCount	= const unsigned int& number of outputs for each sample
+//		sampleLimit	= const unsigned int& maximum number of samples to keep
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SurrogateModel::Initialize(const unsigned int &inputCount,
+	const unsigned int &outputCount, const unsigned int &sampleLimit)
+{
+	this->inputCount = inputCount;
+	this->outputCount = outputCount;
+	this->sampleLimit = sampleLimit;
+	Clear();
+}
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		Clear
+//
+// Description:		Removes all samples from the model.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SurrogateModel::Clear()
+{
+	sampleCount = 0;
+	nextSample = 0;
+	width = 1.0;
+	isFit = false;
+
+	sampleInputs.assign(sampleLimit * inputCount, 0.0);
+	sampleOutputs.assign(sampleLimit * outputCount, 0.0);
+	weights.clear();
+	outputMeans.assign(outputCount, 0.0);
+}
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		AddSample
+//
+// Description:		Adds an evaluated sample to the model.  The model must be
+//					re-fit before the new sample affects predictions.
+//
+// Input Arguments:
+//		inputs	= const double* (inputCount values)
+//		outputs	= const double* (outputCount values)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SurrogateModel::AddSample(const double *inputs, const double *outputs)
+{
+	if (sampleLimit == 0)
+		return;
+
+	// Failed evaluations would ruin the interpolant
+	unsigned int i;
+	for (i = 0; i < outputCount; i++)
+	{
+		if (!VVASEMath::IsValid<double>(outputs[i]))
+			return;
+	}
+
+	for (i = 0; i < inputCount; i++)
+		sampleInputs[nextSample * inputCount + i] = inputs[i];
+	for (i = 0; i < outputCount; i++)
+		sampleOutputs[nextSample * outputCount + i] = outputs[i];
+
+	nextSample = (nextSample + 1) % sampleLimit;
+	if (sampleCount < sampleLimit)
+		sampleCount++;
+}
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		Fit
+//
+// Description:		Solves for the radial basis function weights that
+//					interpolate the stored samples.  Gaussian kernels are
+//					used, with the width set to the mean distance between
+//					each sample and its nearest neighbor.  A small amount of
+//					regularization keeps the system well conditioned when
+//					samples are close together.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool SurrogateModel::Fit()
+{
+	isFit = false;
+	if (sampleCount == 0)
+		return false;
+
+	unsigned int i, j;
+	for (j = 0; j < outputCount; j++)
+	{
+		outputMeans[j] = 0.0;
+		for (i = 0; i < sampleCount; i++)
+			outputMeans[j] += sampleOutputs[i * outputCount + j];
+		outputMeans[j] /= sampleCount;
+	}
+
+	double nearest, distance, totalNearest(0.0);
+	unsigned int nearestCount(0);
+	for (i = 0; i < sampleCount; i++)
+	{
+		nearest = std::numeric_limits<double>::max();
+		for (j = 0; j < sampleCount; j++)
+		{
+			distance = GetSquaredDistance(&sampleInputs[i * inputCount], &sampleInputs[j * inputCount]);
+			if (j != i && distance > 0.0 && distance < nearest)
+				nearest = distance;
+		}
+
+		if (nearest < std::numeric_limits<double>::max())
+		{
+			totalNearest += sqrt(nearest);
+			nearestCount++;
+		}
+	}
+	width = nearestCount > 0 ? totalNearest / nearestCount : 1.0;
+
+	const double regularization(1.0e-6);
+	Matrix a(sampleCount, sampleCount), b(sampleCount, outputCount), x;
+	for (i = 0; i < sampleCount; i++)
+	{
+		for (j = 0; j < sampleCount; j++)
+			a(i, j) = Kernel(GetSquaredDistance(&sampleInputs[i * inputCount], &sampleInputs[j * inputCount]));
+		a(i, i) += regularization;
+
+		for (j = 0; j < outputCount; j++)
+			b(i, j) = sampleOutputs[i * outputCount + j] - outputMeans[j];
+	}
+
+	if (!a.LeftDivide(b, x))
+		return false;
+
+	weights.resize(sampleCount * outputCount);
+	for (i = 0; i < sampleCount; i++)
+	{
+		for (j = 0; j < outputCount; j++)
+			weights[i * outputCount + j] = x(i, j);
+	}
+
+	isFit = true;
+	return true;
+}
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		Predict
+//
+// Description:		Evaluates the model at the specified inputs.
+//
+// Input Arguments:
+//		inputs	= const double* (inputCount values)
+//
+// Output Arguments:
+//		outputs	= double* (outputCount values)
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SurrogateModel::Predict(const double *inputs, double *outputs) const
+{
+	assert(isFit);
+
+	unsigned int i, j;
+	for (j = 0; j < outputCount; j++)
+		outputs[j] = outputMeans[j];
+
+	double phi;
+	for (i = 0; i < weights.size() / outputCount; i++)
+	{
+		phi = Kernel(GetSquaredDistance(inputs, &sampleInputs[i * inputCount]));
+		for (j = 0; j < outputCount; j++)
+			outputs[j] += weights[i * outputCount + j] * phi;
+	}
+}
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		GetSquaredDistance
+//
+// Description:		Returns the squared Euclidean distance between two sets of
+//					inputs.
+//
+// Input Arguments:
+//		a	= const double*
+//		b	= const double*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double SurrogateModel::GetSquaredDistance(const double *a, const double *b) const
+{
+	double sum(0.0);
+	unsigned int i;
+	for (i = 0; i < inputCount; i++)
+		sum += (a[i] - b[i]) * (a[i] - b[i]);
+
+	return sum;
+}
+
+//==========================================================================
+// Class:			SurrogateModel
+// Function:		Kernel
+//
+// Description:		Gaussian radial basis function.
+//
+// Input Arguments:
+//		squaredDistance	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double SurrogateModel::Kernel(const double &squaredDistance) const
+{
+	return exp(-squaredDistance / (2.0 * width * width));
+}
@@ -27,6 +27,9 @@
 //	4/21/2009	- Removed threading (it's slower), K. Loux.
 //	11/1/2010	- Revised and completed installation ratio calculations, K. Loux.
 
+// Standard C++ headers
+#include <type_traits>
+
 // wxWidgets headers
 #include <wx/wx.h>
 
@@ -105,19 +108,54 @@ void KinematicOutputs::InitializeAllOutputs()
 		vectors[i].Set(VVASEMath::QNAN, VVASEMath::QNAN, VVASEMath::QNAN);
 }
 
+//==========================================================================
+// Class:			KinematicOutputs
+// Function:		GetCarProperties
+//
+// Description:		Collects the properties of the car (other than its
+//					suspension) that are used to compute the outputs.
+//
+// Input Arguments:
+//		car	= const Car&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		CarProperties
+//
+//==========================================================================
+KinematicOutputs::CarProperties KinematicOutputs::GetCarProperties(const Car &car)
+{
+	CarProperties properties;
+	properties.frontHalfShafts = car.HasFrontHalfShafts();
+	properties.rearHalfShafts = car.HasRearHalfShafts();
+	properties.frontBrakesInboard = car.brakes->frontBrakesInboard;
+	properties.rearBrakesInboard = car.brakes->rearBrakesInboard;
+	properties.frontWheelDrive = car.drivetrain->driveType == Drivetrain::DriveAllWheel ||
+		car.drivetrain->driveType == Drivetrain::DriveFrontWheel;
+	properties.rearWheelDrive = car.drivetrain->driveType == Drivetrain::DriveAllWheel ||
+		car.drivetrain->driveType == Drivetrain::DriveRearWheel;
+	properties.percentFrontBraking = car.brakes->percentFrontBraking;
+	properties.cgHeight = car.massProperties->totalCGHeight;
+
+	return properties;
+}
+
 //==========================================================================
 // Class:			KinematicOutputs
 // Function:		Update
 //
 // Description:		Takes all of the virtual measurements and saves them in
-//					Outputs.  Every member of Outputs is included here.
-//					Measurements are take on Current.
+//					Outputs, referencing the suspension and properties of the
+//					un-perturbed car.
 //
 // Input Arguments:
 //		original	= const Car*, pointing to object describing the car's
 //					  un-perturbed state
 //		current		= const Suspension*, pointing to object describing the new
 //					  state of the car
+//		mask		= const OutputMask& specifying the groups to compute
 //
 // Output Arguments:
 //		None
@@ -126,33 +164,256 @@ void KinematicOutputs::InitializeAllOutputs()
 //		None
 //
 //==========================================================================
-void KinematicOutputs::Update(const Car *original, const Suspension *current)
+void KinematicOutputs::Update(const Car *original, const Suspension *current, const OutputMask &mask)
 {
-	originalCar = original;// TODO:  Can we remove these at the class level?  Only used within UpdateCorner
-	currentSuspension = current;// TODO:  Can we remove these at the class level?  Only used within UpdateCorner
+	Update(original->suspension, GetCarProperties(*original), current, mask);
+}
 
+//==========================================================================
+// Class:			KinematicOutputs
+// Function:		Update
+//
+// Description:		Takes all of the virtual measurements and saves them in
+//					Outputs.  Only the groups of outputs in the mask are
+//					computed (others remain undefined); the mask must already
+//					include any dependencies (see AddDependencies()).
+//					Measurements are take on Current.
+//
+// Input Arguments:
+//		original	= const Suspension*, pointing to object describing the
+//					  car's un-perturbed state
+//		properties	= const CarProperties& of the un-perturbed car
+//		current		= const Suspension*, pointing to object describing the new
+//					  state of the car
+//		mask		= const OutputMask& specifying the groups to compute
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicOutputs::Update(const Suspension *original, const CarProperties &properties,
+	const Suspension *current, const OutputMask &mask)
+{
 	InitializeAllOutputs();
 
 	// Update each corner's outputs
-	UpdateCorner(&original->suspension->rightFront, &current->rightFront);
-	UpdateCorner(&original->suspension->leftFront, &current->leftFront);
-	UpdateCorner(&original->suspension->rightRear, &current->rightRear);
-	UpdateCorner(&original->suspension->leftRear, &current->leftRear);
+	UpdateCorner(&original->rightFront, &current->rightFront, original, properties, current, mask);
+	UpdateCorner(&original->leftFront, &current->leftFront, original, properties, current, mask);
+	UpdateCorner(&original->rightRear, &current->rightRear, original, properties, current, mask);
+	UpdateCorner(&original->leftRear, &current->leftRear, original, properties, current, mask);
+
+	if (mask & GroupNetSteer)
+		ComputeNetSteer();
+	if (mask & GroupNetScrub)
+		ComputeNetScrub();
+
+	if (mask & GroupARBTwist)
+	{
+		ComputeFrontARBTwist(original, current);
+		ComputeRearARBTwist(original, current);
+	}
+
+	if (mask & GroupRollCenters)
+	{
+		ComputeFrontRollCenter(current);
+		ComputeRearRollCenter(current);
+	}
+
+	if (mask & GroupPitchCenters)
+	{
+		ComputeLeftPitchCenter(current);
+		ComputeRightPitchCenter(current);
+	}
+
+	if (mask & GroupTrack)
+		ComputeTrack(current);
+	if (mask & GroupWheelbase)
+		ComputeWheelbase(current);
+}
+
+//==========================================================================
+// Class:			KinematicOutputs
+// Function:		AddDependencies
+//
+// Description:		Adds the groups that must be computed before the groups
+//					in the specified mask can be computed.
+//
+// Input Arguments:
+//		mask	= OutputMask
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		OutputMask including the dependencies
+//
+//==========================================================================
+KinematicOutputs::OutputMask KinematicOutputs::AddDependencies(OutputMask mask)
+{
+	if (mask & GroupNetSteer)
+		mask |= GroupCamberAndSteer;
+	if (mask & GroupNetScrub)
+		mask |= GroupScrub;
+	if (mask & (GroupInstallationRatios | GroupSwingArms | GroupRollCenters | GroupPitchCenters))
+		mask |= GroupInstantCenter;
+
+	return mask;
+}
+
+//==========================================================================
+// Class:			KinematicOutputs
+// Function:		GetOutputMask
+//
+// Description:		Returns the groups that must be computed to determine the
+//					specified output.
+//
+// Input Arguments:
+//		output	= const OutputsComplete&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		OutputMask (zero for outputs that are never computed)
+//
+//==========================================================================
+KinematicOutputs::OutputMask KinematicOutputs::GetOutputMask(const OutputsComplete &output)
+{
+	OutputMask mask(0);
+	if (output < StartDoubles)
+	{
+		// Every corner has the same layout
+		const int offset((output - StartRightFrontDoubles)
+			% (NumberOfCornerOutputDoubles + 3 * NumberOfCornerOutputVectors));
+		if (offset >= NumberOfCornerOutputDoubles)
+			mask = GroupInstantCenter;
+		else
+		{
+			switch ((CornerOutputsDouble)offset)
+			{
+			case Caster:
+				mask = GroupCaster;
+				break;
+
+			case Camber:
+			case Steer:
+				mask = GroupCamberAndSteer;
+				break;
+
+			case KPI:
+				mask = GroupKPI;
+				break;
+
+			case Spring:
+				mask = GroupSpring;
+				break;
+
+			case Damper:
+				mask = GroupDamper;
+				break;
+
+			case AxlePlunge:
+				mask = GroupAxlePlunge;
+				break;
+
+			case CasterTrail:
+				mask = GroupCasterTrail;
+				break;
+
+			case ScrubRadius:
+				mask = GroupScrubRadius;
+				break;
+
+			case Scrub:
+				mask = GroupScrub;
+				break;
+
+			case SpringInstallationRatio:
+			case DamperInstallationRatio:
+			case ARBInstallationRatio:
+				mask = GroupInstallationRatios;
+				break;
+
+			case SpindleLength:
+				mask = GroupSpindleLength;
+				break;
+
+			case SideViewSwingArmLength:
+			case FrontViewSwingArmLength:
+			case AntiBrakePitch:
+			case AntiDrivePitch:
+				mask = GroupSwingArms;
+				break;
+
+			default:
+				break;
+			}
+		}
+	}
+	else if (output <= EndDoubles)
+	{
+		switch ((OutputsDouble)(output - StartDoubles))
+		{
+		case FrontARBTwist:
+		case RearARBTwist:
+			mask = GroupARBTwist;
+			break;
 
-	ComputeNetSteer();
-	ComputeNetScrub();
+		case FrontNetSteer:
+		case RearNetSteer:
+			mask = GroupNetSteer;
+			break;
 
-	ComputeFrontARBTwist(original, current);
-	ComputeRearARBTwist(original, current);
+		case FrontNetScrub:
+		case RearNetScrub:
+			mask = GroupNetScrub;
+			break;
 
-	ComputeFrontRollCenter(current);
-	ComputeRearRollCenter(current);
+		case FrontTrackGround:
+		case RearTrackGround:
+		case FrontTrackHub:
+		case RearTrackHub:
+			mask = GroupTrack;
+			break;
 
-	ComputeLeftPitchCenter(current);
-	ComputeRightPitchCenter(current);
+		case RightWheelbaseGround:
+		case LeftWheelbaseGround:
+		case RightWheelbaseHub:
+		case LeftWheelbaseHub:
+			mask = GroupWheelbase;
+			break;
 
-	ComputeTrack(current);
-	ComputeWheelbase(current);
+		default:// Third springs and dampers are not computed
+			break;
+		}
+	}
+	else if (output <= EndVectors)
+	{
+		switch ((OutputsVector)((output - StartVectors) / 3))
+		{
+		case FrontKinematicRC:
+		case RearKinematicRC:
+		case FrontRollAxisDirection:
+		case RearRollAxisDirection:
+			mask = GroupRollCenters;
+			break;
+
+		case RightKinematicPC:
+		case LeftKinematicPC:
+		case RightPitchAxisDirection:
+		case LeftPitchAxisDirection:
+			mask = GroupPitchCenters;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	return AddDependencies(mask);
 }
 
 //==========================================================================
@@ -206,7 +467,7 @@ void KinematicOutputs::ComputeNetScrub()
 // Description:		Calls the method to compute front ARB twist.
 //
 // Input Arguments:
-//		original	= const Car*
+//		original	= const Suspension*
 //		current		= const Suspension*
 //
 // Output Arguments:
@@ -216,14 +477,14 @@ void KinematicOutputs::ComputeNetScrub()
 //		None
 //
 //==========================================================================
-void KinematicOutputs::ComputeFrontARBTwist(const Car *original, const Suspension *current)
+void KinematicOutputs::ComputeFrontARBTwist(const Suspension *original, const Suspension *current)
 {
-	doubles[FrontARBTwist] = ComputeARBTwist(original->suspension->leftFront,
-		original->suspension->rightFront, current->leftFront, current->rightFront, current->frontBarStyle,
-		original->suspension->hardpoints[Suspension::FrontBarMidPoint],
-		original->suspension->hardpoints[Suspension::FrontBarPivotAxis],
+	doubles[FrontARBTwist] = ComputeARBTwist(original->leftFront,
+		original->rightFront, current->leftFront, current->rightFront, current->frontBarStyle,
+		original->hardpoints[Suspension::FrontBarMidPoint],
+		original->hardpoints[Suspension::FrontBarPivotAxis],
 		current->hardpoints[Suspension::FrontBarMidPoint], current->hardpoints[Suspension::FrontBarPivotAxis],
-		original->suspension->frontBarSignGreaterThan);
+		original->frontBarSignGreaterThan);
 }
 
 //==========================================================================
@@ -233,7 +494,7 @@ void KinematicOutputs::ComputeFrontARBTwist(const Car *original, const Suspensio
 // Description:		Calls the method to compute front ARB twist.
 //
 // Input Arguments:
-//		original	= const Car*
+//		original	= const Suspension*
 //		current		= const Suspension*
 //
 // Output Arguments:
@@ -243,14 +504,14 @@ void KinematicOutputs::ComputeFrontARBTwist(const Car *original, const Suspensio
 //		None
 //
 //==========================================================================
-void KinematicOutputs::ComputeRearARBTwist(const Car *original, const Suspension *current)
+void KinematicOutputs::ComputeRearARBTwist(const Suspension *original, const Suspension *current)
 {
-	doubles[RearARBTwist] = ComputeARBTwist(original->suspension->leftRear,
-		original->suspension->rightRear, current->leftRear, current->rightRear, current->rearBarStyle,
-		original->suspension->hardpoints[Suspension::RearBarMidPoint],
-		original->suspension->hardpoints[Suspension::RearBarPivotAxis],
+	doubles[RearARBTwist] = ComputeARBTwist(original->leftRear,
+		original->rightRear, current->leftRear, current->rightRear, current->rearBarStyle,
+		original->hardpoints[Suspension::RearBarMidPoint],
+		original->hardpoints[Suspension::RearBarPivotAxis],
 		current->hardpoints[Suspension::RearBarMidPoint], current->hardpoints[Suspension::RearBarPivotAxis],
-		original->suspension->rearBarSignGreaterThan);
+		original->rearBarSignGreaterThan);
 }
 
 //==========================================================================
@@ -712,9 +973,13 @@ bool KinematicOutputs::ComputeKinematicCenter(const Corner &corner1, const Corne
 //					on the car.
 //
 // Input Arguments:
-//		originalCorner	= const Corner*, pointer to the un-perturbed state of the
-//						  corner
-//		currentCorner	= const Corner*, pointer to the current state of the corner
+//		originalCorner		= const Corner*, pointer to the un-perturbed state of the
+//							  corner
+//		currentCorner		= const Corner*, pointer to the current state of the corner
+//		originalSuspension	= const Suspension*, the un-perturbed suspension
+//		carProperties		= const CarProperties& of the un-perturbed car
+//		currentSuspension	= const Suspension*, the current suspension
+//		mask				= const OutputMask& specifying the groups to compute
 //
 // Output Arguments:
 //		None
@@ -723,7 +988,9 @@ bool KinematicOutputs::ComputeKinematicCenter(const Corner &corner1, const Corne
 //		None
 //
 //==========================================================================
-void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *currentCorner)
+void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *currentCorner,
+	const Suspension *originalSuspension, const CarProperties &carProperties,
+	const Suspension *currentSuspension, const OutputMask &mask)
 {
 	// Assign pointers to the corner outputs and our sign conventions
 	double *cornerDoubles;
@@ -763,20 +1030,33 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 		return;
 	}
 
-	ComputeCaster(*currentCorner, cornerDoubles);
-	ComputeKingPinInclincation(*currentCorner, sign, cornerDoubles);
-	ComputeCasterTrail(*currentCorner, cornerDoubles);
-	ComputeScrubRadius(*currentCorner, sign, cornerDoubles);
-	ComputeSpindleLength(*currentCorner, sign, cornerDoubles);
-	ComputeCamberAndSteer(*originalCorner, *currentCorner, sign, cornerDoubles);
-	ComputeSpringDisplacement(*originalCorner, *currentCorner, cornerDoubles);
-	ComputeDamperDisplacement(*originalCorner, *currentCorner, cornerDoubles);
-	ComputeScrub(*originalCorner, *currentCorner, sign, cornerDoubles);
-
-	if ((originalCar->HasFrontHalfShafts() && isAtFront) ||
-		(originalCar->HasRearHalfShafts() && !isAtFront))
+	if (mask & GroupCaster)
+		ComputeCaster(*currentCorner, cornerDoubles);
+	if (mask & GroupKPI)
+		ComputeKingPinInclincation(*currentCorner, sign, cornerDoubles);
+	if (mask & GroupCasterTrail)
+		ComputeCasterTrail(*currentCorner, cornerDoubles);
+	if (mask & GroupScrubRadius)
+		ComputeScrubRadius(*currentCorner, sign, cornerDoubles);
+	if (mask & GroupSpindleLength)
+		ComputeSpindleLength(*currentCorner, sign, cornerDoubles);
+	if (mask & GroupCamberAndSteer)
+		ComputeCamberAndSteer(*originalCorner, *currentCorner, sign, cornerDoubles);
+	if (mask & GroupSpring)
+		ComputeSpringDisplacement(*originalCorner, *currentCorner, cornerDoubles);
+	if (mask & GroupDamper)
+		ComputeDamperDisplacement(*originalCorner, *currentCorner, cornerDoubles);
+	if (mask & GroupScrub)
+		ComputeScrub(*originalCorner, *currentCorner, sign, cornerDoubles);
+
+	if ((mask & GroupAxlePlunge) && ((carProperties.frontHalfShafts && isAtFront) ||
+		(carProperties.rearHalfShafts && !isAtFront)))
 		ComputeAxlePlunge(*originalCorner, *currentCorner, cornerDoubles);
 
+	// Everything else depends on the instant center
+	if (!(mask & GroupInstantCenter))
+		return;
+
 	// Kinematic Instant Centers and Direction Vectors [in], [-]
 	//  The instant centers here will be defined as the point that lies both on the
 	//  instantaneous axis of rotation and on the plane that is perpendicular to the
@@ -842,7 +1122,8 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 	// This changes depending on what is actuating the shock/spring (outer in..else)
 	// and also with what the pushrod or spring/shock attach to on the outer suspension (inner
 	// if..else)
-	if (currentCorner->actuationType == Corner::ActuationPushPullrod)
+	const bool computeInstallationRatios((mask & GroupInstallationRatios) != 0);
+	if (computeInstallationRatios && currentCorner->actuationType == Corner::ActuationPushPullrod)
 	{
 		if (currentCorner->actuationAttachment == Corner::AttachmentLowerAArm)
 		{
@@ -1006,10 +1287,10 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 		// ARB link force
 		if (((originalCorner->location == Corner::LocationLeftFront ||
 			originalCorner->location == Corner::LocationRightFront) &&
-			originalCar->suspension->frontBarStyle != Suspension::SwayBarNone) ||
+			originalSuspension->frontBarStyle != Suspension::SwayBarNone) ||
 			((originalCorner->location == Corner::LocationLeftRear ||
 			originalCorner->location == Corner::LocationRightRear) &&
-			originalCar->suspension->rearBarStyle != Suspension::SwayBarNone))
+			originalSuspension->rearBarStyle != Suspension::SwayBarNone))
 		{
 			momentArm = currentCorner->hardpoints[Corner::OutboardBarLink] - VVASEMath::NearestPointOnAxis(
 				pointOnAxis, momentDirection, currentCorner->hardpoints[Corner::OutboardBarLink]);
@@ -1023,10 +1304,10 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 			// Different procedures for U-bars and T-bars
 			if (((originalCorner->location == Corner::LocationLeftFront ||
 				originalCorner->location == Corner::LocationRightFront) &&
-				originalCar->suspension->frontBarStyle == Suspension::SwayBarUBar) ||
+				originalSuspension->frontBarStyle == Suspension::SwayBarUBar) ||
 				((originalCorner->location == Corner::LocationLeftRear ||
 				originalCorner->location == Corner::LocationRightRear) &&
-				originalCar->suspension->rearBarStyle == Suspension::SwayBarUBar))
+				originalSuspension->rearBarStyle == Suspension::SwayBarUBar))
 			{
 				if (currentCorner->location == Corner::LocationLeftFront ||
 					currentCorner->location == Corner::LocationRightFront)
@@ -1039,10 +1320,10 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 			}
 			else if (((originalCorner->location == Corner::LocationLeftFront ||
 				originalCorner->location == Corner::LocationRightFront) &&
-				originalCar->suspension->frontBarStyle == Suspension::SwayBarTBar) ||
+				originalSuspension->frontBarStyle == Suspension::SwayBarTBar) ||
 				((originalCorner->location == Corner::LocationLeftRear ||
 				originalCorner->location == Corner::LocationRightRear) &&
-				originalCar->suspension->rearBarStyle == Suspension::SwayBarTBar))
+				originalSuspension->rearBarStyle == Suspension::SwayBarTBar))
 			{
 				Vector normal, pivot, oppositeInboard;
 				if (currentCorner->location == Corner::LocationLeftFront ||
@@ -1089,7 +1370,7 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 			cornerDoubles[ARBInstallationRatio] = 1.0 / torque.Length();
 		}
 	}
-	else if (currentCorner->actuationType == Corner::ActuationOutboardRockerArm)
+	else if (computeInstallationRatios && currentCorner->actuationType == Corner::ActuationOutboardRockerArm)
 	{
 		// This part is identical to the beginning of the previous section,
 		// but the spring/shock take the place of the pushrod, so the installation
@@ -1225,10 +1506,10 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 		// ARB link force
 		if (((originalCorner->location == Corner::LocationLeftFront ||
 			originalCorner->location == Corner::LocationRightFront) &&
-			originalCar->suspension->frontBarStyle != Suspension::SwayBarNone) ||
+			originalSuspension->frontBarStyle != Suspension::SwayBarNone) ||
 			((originalCorner->location == Corner::LocationLeftRear ||
 			originalCorner->location == Corner::LocationRightRear) &&
-			originalCar->suspension->rearBarStyle != Suspension::SwayBarNone))
+			originalSuspension->rearBarStyle != Suspension::SwayBarNone))
 		{
 			momentArm = currentCorner->hardpoints[Corner::OutboardBarLink] - VVASEMath::NearestPointOnAxis(
 				pointOnAxis, momentDirection, currentCorner->hardpoints[Corner::OutboardBarLink]);
@@ -1242,10 +1523,10 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 			// Different procedures for U-bars and T-bars
 			if (((originalCorner->location == Corner::LocationLeftFront ||
 				originalCorner->location == Corner::LocationRightFront) &&
-				originalCar->suspension->frontBarStyle == Suspension::SwayBarUBar) ||
+				originalSuspension->frontBarStyle == Suspension::SwayBarUBar) ||
 				((originalCorner->location == Corner::LocationLeftRear ||
 				originalCorner->location == Corner::LocationRightRear) &&
-				originalCar->suspension->rearBarStyle == Suspension::SwayBarUBar))
+				originalSuspension->rearBarStyle == Suspension::SwayBarUBar))
 			{
 				if (currentCorner->location == Corner::LocationLeftFront ||
 					currentCorner->location == Corner::LocationRightFront)
@@ -1258,10 +1539,10 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 			}
 			else if (((originalCorner->location == Corner::LocationLeftFront ||
 				originalCorner->location == Corner::LocationRightFront) &&
-				originalCar->suspension->frontBarStyle == Suspension::SwayBarTBar) ||
+				originalSuspension->frontBarStyle == Suspension::SwayBarTBar) ||
 				((originalCorner->location == Corner::LocationLeftRear ||
 				originalCorner->location == Corner::LocationRightRear) &&
-				originalCar->suspension->rearBarStyle == Suspension::SwayBarTBar))
+				originalSuspension->rearBarStyle == Suspension::SwayBarTBar))
 			{
 				Vector normal, pivot, oppositeInboard;
 				if (currentCorner->location == Corner::LocationLeftFront ||
@@ -1309,6 +1590,9 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 		}
 	}
 
+	if (!(mask & GroupSwingArms))
+		return;
+
 	// Side View Swing Arm Length [in]
 	// Find the plane that contains the wheel center and has the Y direction as a
 	// normal, and find the intersection of the Instant Axis and that plane. This
@@ -1346,7 +1630,7 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 		- currentSuspension->rightFront.hardpoints[Corner::ContactPatch].x
 		+ currentSuspension->leftRear.hardpoints[Corner::ContactPatch].x
 		- currentSuspension->leftFront.hardpoints[Corner::ContactPatch].x) / 2.0;
-	double cgHeight = originalCar->massProperties->totalCGHeight;
+	double cgHeight = carProperties.cgHeight;
 	double reactionPathAngleTangent;
 
 	// Determine if we are talking about anti-dive (front) or anti-lift (rear)
@@ -1354,7 +1638,7 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 	{
 		// Is the braking torque reacted directly by the chassis, or does it first
 		// travel through the control arms?
-		if (originalCar->brakes->frontBrakesInboard)
+		if (carProperties.frontBrakesInboard)
 		{
 			// Compute the tangent of the reaction path angle
 			reactionPathAngleTangent = (sideViewSwingArmHeight -
@@ -1362,7 +1646,7 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 
 			// Compute the anti-dive
 			cornerDoubles[AntiBrakePitch] = reactionPathAngleTangent * wheelbase / cgHeight
-				* originalCar->brakes->percentFrontBraking * 100.0;
+				* carProperties.percentFrontBraking * 100.0;
 		}
 		else// Outboard brakes
 		{
@@ -1371,14 +1655,14 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 
 			// Compute the anti-dive
 			cornerDoubles[AntiBrakePitch] = reactionPathAngleTangent / (cgHeight / wheelbase
-				* originalCar->brakes->percentFrontBraking) * 100.0;
+				* carProperties.percentFrontBraking) * 100.0;
 		}
 	}
 	else// Anti-lift (rear)
 	{
 		// Is the braking torque reacted directly by the chassis, or does it first
 		// travel through the control arms?
-		if (originalCar->brakes->rearBrakesInboard)
+		if (carProperties.rearBrakesInboard)
 		{
 			// Compute the tangent of the reaction path angle
 			reactionPathAngleTangent = (sideViewSwingArmHeight -
@@ -1386,7 +1670,7 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 
 			// Compute the anti-lift
 			cornerDoubles[AntiBrakePitch] = reactionPathAngleTangent * wheelbase / cgHeight
-				* (1.0 - originalCar->brakes->percentFrontBraking) * 100.0;
+				* (1.0 - carProperties.percentFrontBraking) * 100.0;
 		}
 		else// Outboard brakes
 		{
@@ -1395,7 +1679,7 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 
 			// Compute the anti-lift
 			cornerDoubles[AntiBrakePitch] = reactionPathAngleTangent / (cgHeight / wheelbase
-				* (1.0 - originalCar->brakes->percentFrontBraking)) * 100.0;
+				* (1.0 - carProperties.percentFrontBraking)) * 100.0;
 		}
 	}
 
@@ -1410,9 +1694,8 @@ void KinematicOutputs::UpdateCorner(const Corner *originalCorner, const Corner *
 	// exist.
 	// FIXME:  Do we need a % front traction for use with AWD?
 	// FIXME:  This will change with independent vs. solid axle suspensions (currently we assume independent)
-	if (originalCar->drivetrain->driveType == Drivetrain::DriveAllWheel ||
-		(originalCar->drivetrain->driveType == Drivetrain::DriveFrontWheel && isAtFront) ||
-		(originalCar->drivetrain->driveType == Drivetrain::DriveRearWheel && !isAtFront))
+	if ((carProperties.frontWheelDrive && isAtFront) ||
+		(carProperties.rearWheelDrive && !isAtFront))
 	{
 		// Compute the tangent of the reaction path angle
 		reactionPathAngleTangent = (sideViewSwingArmHeight -
@@ -2050,7 +2333,8 @@ wxString KinematicOutputs::GetVectorName(const OutputsVector &output)
 // Function:		GetOutputValue
 //
 // Description:		Returns the value of the output from the complete list of
-//					class outputs.
+//					class outputs.  Uses the precomputed offset table, so
+//					this is safe to call from inner loops.
 //
 // Input Arguments:
 //		output	= const &OutputsComplete specifying the output in which we are
@@ -2065,135 +2349,131 @@ wxString KinematicOutputs::GetVectorName(const OutputsVector &output)
 //==========================================================================
 double KinematicOutputs::GetOutputValue(const OutputsComplete &output) const
 {
-	double value;
-	Vector temp;
-	OutputsComplete newOutputIndex;
-
-	// Depending on the specified OUTPUTS_COMPLETE, choose which output to return
-	if (output <= EndRightFrontDoubles)
-		value = rightFront[output - StartRightFrontDoubles];
-	else if (output <= EndRightFrontVectors)
-	{
-		newOutputIndex = OutputsComplete(output - StartRightFrontVectors);
-		temp = rightFrontVectors[int(newOutputIndex / 3)];
-
-		// Choose the value based on the selected componenet
-		switch (newOutputIndex % 3)
-		{
-		case 0:
-			value = temp.x;
-			break;
-
-		case 1:
-			value = temp.y;
-			break;
-
-		case 2:
-		default:
-			value = temp.z;
-			break;
-		}
-	}
-	else if (output <= EndLeftFrontDoubles)
-		value = leftFront[output - StartLeftFrontDoubles];
-	else if (output <= EndLeftFrontVectors)
-	{
-		newOutputIndex = OutputsComplete(output - StartLeftFrontVectors);
-		temp = leftFrontVectors[int(newOutputIndex / 3)];
+	if (output < 0 || output >= NumberOfOutputScalars)
+		return 0.0;
 
-		// Choose the value based on the selected componenet
-		switch (newOutputIndex % 3)
-		{
-		case 0:
-			value = temp.x;
-			break;
-
-		case 1:
-			value = temp.y;
-			break;
-
-		case 2:
-		default:
-			value = temp.z;
-			break;
-		}
-	}
-	else if (output <= EndRightRearDoubles)
-		value = rightRear[output - StartRightRearDoubles];
-	else if (output <= EndRightRearVectors)
-	{
-		newOutputIndex = OutputsComplete(output - StartRightRearVectors);
-		temp = rightRearVectors[int(newOutputIndex / 3)];
-
-		// Choose the value based on the selected componenet
-		switch (newOutputIndex % 3)
-		{
-		case 0:
-			value = temp.x;
-			break;
-
-		case 1:
-			value = temp.y;
-			break;
+	return *reinterpret_cast<const double*>(reinterpret_cast<const char*>(this)
+		+ GetOutputOffsets().offsets[output]);
+}
 
-		case 2:
-		default:
-			value = temp.z;
-			break;
-		}
-	}
-	else if (output <= EndLeftRearDoubles)
-		value = leftRear[output - StartLeftRearDoubles];
-	else if (output <= EndLeftRearVectors)
-	{
-		newOutputIndex = OutputsComplete(output - StartLeftRearVectors);
-		temp = leftRearVectors[int(newOutputIndex / 3)];
+//==========================================================================
+// Class:			KinematicOutputs
+// Function:		GetOutputOffsets
+//
+// Description:		Returns the table of output offsets, which is built the
+//					first time it is needed (so it does not depend on the
+//					order in which static objects are initialized).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const OutputOffsetTable&
+//
+//==========================================================================
+const KinematicOutputs::OutputOffsetTable &KinematicOutputs::GetOutputOffsets()
+{
+	static const OutputOffsetTable outputOffsets;
+	return outputOffsets;
+}
 
-		// Choose the value based on the selected componenet
-		switch (newOutputIndex % 3)
-		{
-		case 0:
-			value = temp.x;
-			break;
+//==========================================================================
+// Class:			KinematicOutputs::OutputOffsetTable
+// Function:		OutputOffsetTable
+//
+// Description:		Constructor for OutputOffsetTable class.  Records the
+//					location of each output (relative to the start of a
+//					KinematicOutputs object) in OutputsComplete order.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+KinematicOutputs::OutputOffsetTable::OutputOffsetTable()
+{
+	// offsetof() is only defined for standard-layout classes
+	static_assert(std::is_standard_layout<KinematicOutputs>::value,
+		"KinematicOutputs must be standard-layout (all data members public)");
+	static_assert(std::is_standard_layout<Vector>::value, "Vector must be standard-layout");
+
+	AddDoubles(offsetof(KinematicOutputs, rightFront), NumberOfCornerOutputDoubles, StartRightFrontDoubles);
+	AddVectors(offsetof(KinematicOutputs, rightFrontVectors), NumberOfCornerOutputVectors, StartRightFrontVectors);
+	AddDoubles(offsetof(KinematicOutputs, leftFront), NumberOfCornerOutputDoubles, StartLeftFrontDoubles);
+	AddVectors(offsetof(KinematicOutputs, leftFrontVectors), NumberOfCornerOutputVectors, StartLeftFrontVectors);
+	AddDoubles(offsetof(KinematicOutputs, rightRear), NumberOfCornerOutputDoubles, StartRightRearDoubles);
+	AddVectors(offsetof(KinematicOutputs, rightRearVectors), NumberOfCornerOutputVectors, StartRightRearVectors);
+	AddDoubles(offsetof(KinematicOutputs, leftRear), NumberOfCornerOutputDoubles, StartLeftRearDoubles);
+	AddVectors(offsetof(KinematicOutputs, leftRearVectors), NumberOfCornerOutputVectors, StartLeftRearVectors);
+	AddDoubles(offsetof(KinematicOutputs, doubles), NumberOfOutputDoubles, StartDoubles);
+	AddVectors(offsetof(KinematicOutputs, vectors), NumberOfOutputVectors, StartVectors);
+}
 
-		case 1:
-			value = temp.y;
-			break;
+//==========================================================================
+// Class:			KinematicOutputs::OutputOffsetTable
+// Function:		AddDoubles
+//
+// Description:		Records the offsets of an array of double outputs.
+//
+// Input Arguments:
+//		arrayOffset	= const std::size_t& offset of the array within the object
+//		count		= const int& specifying the number of elements in the array
+//		start		= const int& specifying the OutputsComplete index of the
+//					  first element
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicOutputs::OutputOffsetTable::AddDoubles(const std::size_t &arrayOffset,
+	const int &count, const int &start)
+{
+	int i;
+	for (i = 0; i < count; i++)
+		offsets[start + i] = arrayOffset + i * sizeof(double);
+}
 
-		case 2:
-		default:
-			value = temp.z;
-			break;
-		}
-	}
-	else if (output <= EndDoubles)
-		value = doubles[output - StartDoubles];
-	else if (output <= EndVectors)
+//==========================================================================
+// Class:			KinematicOutputs::OutputOffsetTable
+// Function:		AddVectors
+//
+// Description:		Records the offsets of the components of an array of
+//					Vector outputs (x, y, z for each element).
+//
+// Input Arguments:
+//		arrayOffset	= const std::size_t& offset of the array within the object
+//		count		= const int& specifying the number of elements in the array
+//		start		= const int& specifying the OutputsComplete index of the
+//					  first element's x component
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicOutputs::OutputOffsetTable::AddVectors(const std::size_t &arrayOffset,
+	const int &count, const int &start)
+{
+	int i;
+	for (i = 0; i < count; i++)
 	{
-		newOutputIndex = OutputsComplete(output - StartVectors);
-		temp = vectors[int(newOutputIndex / 3)];
-
-		// Choose the value based on the selected componenet
-		switch (newOutputIndex % 3)
-		{
-		case 0:
-			value = temp.x;
-			break;
-
-		case 1:
-			value = temp.y;
-			break;
-
-		case 2:
-		default:
-			value = temp.z;
-			break;
-		}
+		offsets[start + 3 * i] = arrayOffset + i * sizeof(Vector) + offsetof(Vector, x);
+		offsets[start + 3 * i + 1] = arrayOffset + i * sizeof(Vector) + offsetof(Vector, y);
+		offsets[start + 3 * i + 2] = arrayOffset + i * sizeof(Vector) + offsetof(Vector, z);
 	}
-	else
-		value = 0.0;
-
-	return value;
 }
 
 //==========================================================================
@@ -25,6 +25,9 @@
 //	4/19/2009	- Added threading for SolveCorner(), K. Loux.
 //	4/21/2009	- Removed threading (it's slower), K. Loux.
 
+// Standard C++ headers
+#include <cassert>
+
 // wxWidgets headers
 #include <wx/wx.h>
 #include <wx/stopwatch.h>
@@ -40,9 +43,10 @@
 #include "vUtilities/wheelSetStructures.h"
 #include "vUtilities/debugLog.h"
 #include "vUtilities/debugger.h"
-#include "vMath/matrix.h"
+#include "vMath/fixedMatrix.h"
 #include "vRenderer/3dcar/debugShape.h"
 #include "vMath/geometryMath.h"
+#include "vSolver/threads/cornerThread.h"
 
 //==========================================================================
 // Class:			Kinematics
@@ -62,9 +66,14 @@
 //==========================================================================
 Kinematics::Kinematics()
 {
-	originalCar = NULL;
+	originalSuspension = NULL;
 	workingCar = NULL;
 	localSuspension = NULL;
+
+	parallelCorners = false;
+	warmStart = false;
+	outputMask = KinematicOutputs::GroupAll;
+	iterationCount = 0;
 }
 
 //==========================================================================
@@ -93,7 +102,6 @@ void Kinematics::UpdateKinematics(const Car* originalCar, Car* workingCar, wxStr
 
 	Debugger::GetInstance() << "UpdateKinematics() for " << name << Debugger::PriorityMedium;
 
-	this->originalCar = originalCar;// This one is for reference and won't be changed by this class
 	this->workingCar = workingCar;
 
 	// Ensure exclusive access to the car objects
@@ -108,20 +116,256 @@ void Kinematics::UpdateKinematics(const Car* originalCar, Car* workingCar, wxStr
 	// to other sub-systems are carried over into the working car.
 	*workingCar = *originalCar;
 
+	// This one is for reference and won't be changed by this class
+	originalSuspension = originalCar->suspension;
+	carProperties = KinematicOutputs::GetCarProperties(*originalCar);
+
 	// Now we copy the pointer to the working car's suspension to the class member
 	// This must be AFTER *WorkingCar = *OriginalCar, since this assignment is a deep copy
 	// and the address of the suspension will change!
 	localSuspension = workingCar->suspension;
 
+	Vector rotations;// (X = First, Y = Second, Z = Third)
+	Vector::Axis secondRotation;
+	iterationCount = 0;
+	if (!SolveSuspension(rotations, secondRotation))
+		return;
+
+	UpdateCGs(inputs.centerOfRotation, rotations, inputs.firstRotation,
+		secondRotation, inputs.heave, inputs.tireDeflections, workingCar);
+
+	outputs.Update(originalSuspension, carProperties, localSuspension, outputMask);
+	long totalTime = timer.Time();
+	Debugger::GetInstance() << "Finished UpdateKinematcs() for " << name
+		<< " in " << totalTime / 1000.0 << " sec" << Debugger::PriorityLow;// TODO:  Set stream precision for time
+}
+
+//==========================================================================
+// Class:			Kinematics
+// Function:		SolveSweep
+//
+// Description:		Solves the kinematics for a list of inputs against the
+//					same original car.  Only the suspension is copied for each
+//					point (instead of the entire car), and the original car is
+//					locked only long enough to take one copy of its suspension
+//					for the whole sweep (so several sweeps of the same car may
+//					run in parallel).  Intended for use when many points are solved
+//					for one car (i.e. Iteration).
+//					NOTE:  CG heights are not updated for each point, since
+//					no working car exists (KinematicOutputs does not use them).
+//
+//					With warm start enabled, the contact patch iteration for
+//					each point begins from the previous solutions, extrapolated
+//					along the direction of the sweep.  Should a solution land
+//					far from the prediction (i.e. the solver may have jumped to
+//					a different solution branch), the point is re-checked from
+//					the design position.
+//
+// Input Arguments:
+//		originalCar	= const Car& for reference only
+//		inputList	= const std::vector<Inputs>& containing the points to solve
+//
+// Output Arguments:
+//		outputList	= std::vector<KinematicOutputs>& containing one set of
+//					  outputs per entry in inputList
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Kinematics::SolveSweep(const Car& originalCar, const std::vector<Inputs>& inputList,
+	std::vector<KinematicOutputs>& outputList)
+{
+	wxStopWatch timer;
+	timer.Start();
+
+	outputList.resize(inputList.size());
+
+	// Only the suspension (and the few other properties used by the outputs) is
+	// copied; the rest of the car is not referenced by the solver
+	originalCar.GetMutex().Lock();
+	DebugLog::GetInstance()->Log(_T("Kinematics::SolveSweep (lock)"));
+	const Suspension referenceSuspension(*originalCar.suspension);
+	carProperties = KinematicOutputs::GetCarProperties(originalCar);
+	DebugLog::GetInstance()->Log(_T("Kinematics::SolveSweep (unlock)"));
+	originalCar.GetMutex().Unlock();
+
+	originalSuspension = &referenceSuspension;
+	workingCar = NULL;
+
+	// One working suspension is re-used for every point; it is re-assigned from
+	// the original for each point to avoid accumulating rounding errors
+	Suspension workingSuspension;
+	localSuspension = &workingSuspension;
+
+	// Lower ball joint heights for the last two points that were solved (for warm start)
+	const double minimumBranchTolerance(0.1);// [in]
+	const double branchToleranceFactor(3.0);
+	double previousZ[4], olderZ[4], stepRatio, step;
+	unsigned int historyCount(0);
+	CornerGuesses guesses;
+
+	Vector rotations;
+	Vector::Axis secondRotation;
+	bool solved;
+	unsigned int i, k;
+	iterationCount = 0;
+	for (i = 0; i < inputList.size(); i++)
+	{
+		inputs = inputList[i];
+		workingSuspension = referenceSuspension;
+
+		// The history is only meaningful if the rotations are about the same point and in the same order
+		if (historyCount > 0 && (inputs.centerOfRotation != inputList[i - 1].centerOfRotation ||
+			inputs.firstRotation != inputList[i - 1].firstRotation))
+			historyCount = 0;
+
+		if (!warmStart || historyCount == 0)
+			solved = SolveSuspension(rotations, secondRotation);
+		else
+		{
+			// Linear extrapolation if this step continues in the direction of the last step,
+			// otherwise start from the last solution
+			if (historyCount > 1)
+				stepRatio = ComputeStepRatio(inputList[i - 2], inputList[i - 1], inputs);
+			else
+				stepRatio = 0.0;
+
+			for (k = 0; k < 4; k++)
+			{
+				step = stepRatio * (previousZ[k] - olderZ[k]);
+				guesses.lowerBallJointZ[k] = previousZ[k] + step;
+				guesses.branchTolerance[k] = minimumBranchTolerance + branchToleranceFactor * fabs(step);
+			}
+
+			solved = SolveSuspension(rotations, secondRotation, &guesses);
+		}
+
+		// Failed points are left undefined (so they can be distinguished from valid
+		// points), and are not used as the starting point for the next point
+		if (!solved)
+		{
+			Debugger::GetInstance() << "ERROR (SolveSweep):  Failed to solve point " << (int)i
+				<< "; outputs are undefined" << Debugger::PriorityHigh;
+			outputList[i].InitializeAllOutputs();
+			historyCount = 0;
+			continue;
+		}
+
+		outputList[i].Update(originalSuspension, carProperties, localSuspension, outputMask);
+
+		for (k = 0; k < 4; k++)
+			olderZ[k] = previousZ[k];
+		previousZ[0] = localSuspension->rightFront.hardpoints[Corner::LowerBallJoint].z;
+		previousZ[1] = localSuspension->leftFront.hardpoints[Corner::LowerBallJoint].z;
+		previousZ[2] = localSuspension->rightRear.hardpoints[Corner::LowerBallJoint].z;
+		previousZ[3] = localSuspension->leftRear.hardpoints[Corner::LowerBallJoint].z;
+		if (historyCount < 2)
+			historyCount++;
+	}
+
+	originalSuspension = NULL;
+	localSuspension = NULL;
+
+	Debugger::GetInstance() << "Finished SolveSweep() for " << (int)inputList.size()
+		<< " points in " << timer.Time() / 1000.0 << " sec (" << (int)iterationCount
+		<< " iterations)" << Debugger::PriorityLow;
+}
+
+//==========================================================================
+// Class:			Kinematics
+// Function:		ComputeStepRatio
+//
+// Description:		Compares the step from second to third with the step from
+//					first to second.  If the steps are in the same direction
+//					(as they are in a sweep), returns the ratio of their
+//					lengths; otherwise returns zero.  Only pitch, roll, heave,
+//					rack travel and tire deflections are considered.
+//
+// Input Arguments:
+//		first	= const Inputs&
+//		second	= const Inputs&
+//		third	= const Inputs&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double, length of the second step divided by length of the first step
+//
+//==========================================================================
+double Kinematics::ComputeStepRatio(const Inputs &first, const Inputs &second, const Inputs &third)
+{
+	const unsigned int count(8);
+	const double lastStep[count] = {
+		second.pitch - first.pitch,
+		second.roll - first.roll,
+		second.heave - first.heave,
+		second.rackTravel - first.rackTravel,
+		second.tireDeflections.rightFront - first.tireDeflections.rightFront,
+		second.tireDeflections.leftFront - first.tireDeflections.leftFront,
+		second.tireDeflections.rightRear - first.tireDeflections.rightRear,
+		second.tireDeflections.leftRear - first.tireDeflections.leftRear };
+	const double nextStep[count] = {
+		third.pitch - second.pitch,
+		third.roll - second.roll,
+		third.heave - second.heave,
+		third.rackTravel - second.rackTravel,
+		third.tireDeflections.rightFront - second.tireDeflections.rightFront,
+		third.tireDeflections.leftFront - second.tireDeflections.leftFront,
+		third.tireDeflections.rightRear - second.tireDeflections.rightRear,
+		third.tireDeflections.leftRear - second.tireDeflections.leftRear };
+
+	double dot(0.0), lastSquared(0.0), nextSquared(0.0);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		dot += lastStep[i] * nextStep[i];
+		lastSquared += lastStep[i] * lastStep[i];
+		nextSquared += nextStep[i] * nextStep[i];
+	}
+
+	// Require the steps to be (nearly) parallel; the units are mixed, so the
+	// angle between steps in different directions has no real meaning
+	const double parallelTolerance(1.0e-6);
+	if (lastSquared == 0.0 || dot <= 0.0 ||
+		dot * dot < (1.0 - parallelTolerance) * lastSquared * nextSquared)
+		return 0.0;
+
+	return dot / lastSquared;
+}
+
+//==========================================================================
+// Class:			Kinematics
+// Function:		SolveSuspension
+//
+// Description:		Moves localSuspension to meet the current values of pitch,
+//					roll, heave and steer.  localSuspension must be a copy of
+//					originalSuspension when this is called.
+//
+// Input Arguments:
+//		guesses	= const CornerGuesses*, initial lower ball joint heights for
+//				  warm starting, or NULL to start from the design position
+//
+// Output Arguments:
+//		rotations		= Vector& containing the Euler rotations applied to the
+//						  sprung mass (X = First, Y = Second, Z = Third)
+//		secondRotation	= Vector::Axis& describing the second axis of rotation
+//
+// Return Value:
+//		bool, true for success, false for error(s)
+//
+//==========================================================================
+bool Kinematics::SolveSuspension(Vector &rotations, Vector::Axis &secondRotation,
+	const CornerGuesses *guesses)
+{
 	// Rotate the steering wheel
 	MoveSteeringRack(inputs.rackTravel);
 
 	// FIXME:  As it is right now, this section is not compatible with monoshocks
 
-	Vector rotations;// (X = First, Y = Second, Z = Third)
-	Vector::Axis secondRotation;
-
 	// Determine the order to perform the Euler rotations
+	// (X = First, Y = Second, Z = Third)
 	if (inputs.firstRotation == Vector::AxisX)// Do roll first, then pitch
 	{
 		secondRotation = Vector::AxisY;
@@ -134,8 +378,8 @@ void Kinematics::UpdateKinematics(const Car* originalCar, Car* workingCar, wxStr
 	}
 	else
 	{
-		Debugger::GetInstance() << "ERROR (UpdateKinematics):  Unable to determine order of Euler rotations" << Debugger::PriorityHigh;
-		return;
+		Debugger::GetInstance() << "ERROR (SolveSuspension):  Unable to determine order of Euler rotations" << Debugger::PriorityHigh;
+		return false;
 	}
 
 	// Solve the chassis-mounted points for left-right common items (3rd springs/dampers, sway bars)
@@ -225,13 +469,30 @@ void Kinematics::UpdateKinematics(const Car* originalCar, Car* workingCar, wxStr
 		localSuspension->hardpoints[Suspension::RearThirdDamperInboard].z += inputs.heave;
 	}
 
-	if (!SolveCorner(localSuspension->rightFront, originalCar->suspension->rightFront, rotations, secondRotation, inputs.tireDeflections.rightFront))
+	// The corners are independent of each other up to this point, so they are solved together
+	Corner *corners[4] = { &localSuspension->rightFront, &localSuspension->leftFront,
+		&localSuspension->rightRear, &localSuspension->leftRear };
+	const Corner *originalCorners[4] = { &originalSuspension->rightFront, &originalSuspension->leftFront,
+		&originalSuspension->rightRear, &originalSuspension->leftRear };
+	const double tireDeflections[4] = { inputs.tireDeflections.rightFront, inputs.tireDeflections.leftFront,
+		inputs.tireDeflections.rightRear, inputs.tireDeflections.leftRear };
+	const double *lowerBallJointGuesses(guesses ? guesses->lowerBallJointZ : NULL);
+	const double *branchTolerances(guesses ? guesses->branchTolerance : NULL);
+	bool success[4];
+	if (parallelCorners)
+		iterationCount += SolveCornersInParallel(corners, originalCorners, tireDeflections, rotations,
+			secondRotation, lowerBallJointGuesses, branchTolerances, success);
+	else
+		iterationCount += SolveCorners(corners, originalCorners, tireDeflections, 4, rotations,
+			secondRotation, lowerBallJointGuesses, branchTolerances, success);
+
+	if (!success[0])
 		Debugger::GetInstance() << "ERROR:  Problem solving right front corner!  Increase debug level for more information." <<	Debugger::PriorityHigh;
-	if (!SolveCorner(localSuspension->leftFront, originalCar->suspension->leftFront, rotations, secondRotation, inputs.tireDeflections.leftFront))
+	if (!success[1])
 		Debugger::GetInstance() << "ERROR:  Problem solving left front corner!  Increase debug level for more information." << Debugger::PriorityHigh;
-	if (!SolveCorner(localSuspension->rightRear, originalCar->suspension->rightRear, rotations, secondRotation, inputs.tireDeflections.rightRear))
+	if (!success[2])
 		Debugger::GetInstance() << "ERROR:  Problem solving right rear corner!  Increase debug level for more information." << Debugger::PriorityHigh;
-	if (!SolveCorner(localSuspension->leftRear, originalCar->suspension->leftRear, rotations, secondRotation, inputs.tireDeflections.leftRear))
+	if (!success[3])
 		Debugger::GetInstance() << "ERROR:  Problem solving left rear corner!  Increase debug level for more information." << Debugger::PriorityHigh;
 
 	// Some things need to be solved AFTER all other corners
@@ -242,12 +503,12 @@ void Kinematics::UpdateKinematics(const Car* originalCar, Car* workingCar, wxStr
 			localSuspension->rightFront.hardpoints[Corner::OutboardBarLink],
 			localSuspension->hardpoints[Suspension::FrontBarMidPoint],
 			localSuspension->hardpoints[Suspension::FrontBarPivotAxis],
-			originalCar->suspension->leftFront.hardpoints[Corner::OutboardBarLink],
-			originalCar->suspension->rightFront.hardpoints[Corner::OutboardBarLink],
-			originalCar->suspension->hardpoints[Suspension::FrontBarMidPoint],
-			originalCar->suspension->hardpoints[Suspension::FrontBarPivotAxis],
-			originalCar->suspension->leftFront.hardpoints[Corner::InboardBarLink],
-			originalCar->suspension->rightFront.hardpoints[Corner::InboardBarLink],
+			originalSuspension->leftFront.hardpoints[Corner::OutboardBarLink],
+			originalSuspension->rightFront.hardpoints[Corner::OutboardBarLink],
+			originalSuspension->hardpoints[Suspension::FrontBarMidPoint],
+			originalSuspension->hardpoints[Suspension::FrontBarPivotAxis],
+			originalSuspension->leftFront.hardpoints[Corner::InboardBarLink],
+			originalSuspension->rightFront.hardpoints[Corner::InboardBarLink],
 			localSuspension->leftFront.hardpoints[Corner::InboardBarLink],
 			localSuspension->rightFront.hardpoints[Corner::InboardBarLink]))
 			Debugger::GetInstance() << "ERROR:  Failed to solve for inboard T-bar (front)!" << Debugger::PriorityMedium;
@@ -260,59 +521,391 @@ void Kinematics::UpdateKinematics(const Car* originalCar, Car* workingCar, wxStr
 			localSuspension->rightRear.hardpoints[Corner::OutboardBarLink],
 			localSuspension->hardpoints[Suspension::RearBarMidPoint],
 			localSuspension->hardpoints[Suspension::RearBarPivotAxis],
-			originalCar->suspension->leftRear.hardpoints[Corner::OutboardBarLink],
-			originalCar->suspension->rightRear.hardpoints[Corner::OutboardBarLink],
-			originalCar->suspension->hardpoints[Suspension::RearBarMidPoint],
-			originalCar->suspension->hardpoints[Suspension::RearBarPivotAxis],
-			originalCar->suspension->leftRear.hardpoints[Corner::InboardBarLink],
-			originalCar->suspension->rightRear.hardpoints[Corner::InboardBarLink],
+			originalSuspension->leftRear.hardpoints[Corner::OutboardBarLink],
+			originalSuspension->rightRear.hardpoints[Corner::OutboardBarLink],
+			originalSuspension->hardpoints[Suspension::RearBarMidPoint],
+			originalSuspension->hardpoints[Suspension::RearBarPivotAxis],
+			originalSuspension->leftRear.hardpoints[Corner::InboardBarLink],
+			originalSuspension->rightRear.hardpoints[Corner::InboardBarLink],
 			localSuspension->leftRear.hardpoints[Corner::InboardBarLink],
 			localSuspension->rightRear.hardpoints[Corner::InboardBarLink]))
 			Debugger::GetInstance() << "ERROR:  Failed to solve for inboard T-bar (rear)!" << Debugger::PriorityMedium;
 	}
 
-	UpdateCGs(inputs.centerOfRotation, rotations, inputs.firstRotation,
-		secondRotation, inputs.heave, inputs.tireDeflections, workingCar);
-
-	outputs.Update(originalCar, localSuspension);
-	long totalTime = timer.Time();
-	Debugger::GetInstance() << "Finished UpdateKinematcs() for " << name
-		<< " in " << totalTime / 1000.0 << " sec" << Debugger::PriorityLow;// TODO:  Set stream precision for time
+	return true;
 }
 
 //==========================================================================
 // Class:			Kinematics
-// Function:		SolveCorner
+// Function:		SolveCorners
 //
 // Description:		This solves for the locations of all of the suspension
 //					nodes that exist at each corner of the car.  This includes
 //					Everything from the contact patch up to the damper and
-//					spring end-points.
+//					spring end-points.  The corners are independent of each
+//					other, so several corners are solved at once:  the points
+//					that are solved at each step of the contact patch iteration
+//					are solved for all of the corners together (one corner per
+//					lane - see GeometryMath::FindThreeSpheresIntersections()).
+//
+//					Without guesses, the lower ball joint height is bisected
+//					within 1 inch of the design position.  With guesses, secant
+//					steps are taken from the guess instead; corners that fail
+//					to converge quickly, or that converge further than the
+//					branch tolerance from the guess, are solved again from the
+//					design position.
 //
 // Input Arguments:
-//		originalCorner	= const Corner*, the un-perturbed locations of the
+//		corners			= Corner* const*, the corners of the car we are
+//						  manipulating
+//		originalCorners	= const Corner* const*, the un-perturbed locations of the
 //						  suspension hardpoints
-//		rotations		= const Vector* specifying the amount to rotate the chassis
+//		tireDeflections	= const double*, one per corner
+//		count			= const unsigned int& specifying the number of corners (no
+//						  more than GeometryMath::laneCount)
+//		rotations		= const Vector& specifying the amount to rotate the chassis
 //						  about each axis
-//		secondRotation	= const Vector::Axis* describing the second axis of rotation
+//		secondRotation	= const Vector::Axis& describing the second axis of rotation
 //						  (the first is an input quantity)
-//		tireDeflection	= const double&
+//		guesses			= const double*, one initial lower ball joint height per
+//						  corner (may be NULL)
+//		branchTolerances	= const double*, one per corner (ignored if guesses is NULL)
 //
 // Output Arguments:
-//		corner	= Corner*, the corner of the car we are manipulating
+//		success	= bool*, true for each corner that was solved without error(s)
 //
 // Return Value:
-//		bool, true for success, false for error(s)
+//		unsigned int, number of contact patch iterations (summed over the corners)
+//
+//==========================================================================
+unsigned int Kinematics::SolveCorners(Corner* const *corners, const Corner* const *originalCorners,
+	const double *tireDeflections, const unsigned int &count, const Vector &rotations,
+	const Vector::Axis &secondRotation, const double *guesses, const double *branchTolerances,
+	bool *success)
+{
+	assert(count <= GeometryMath::laneCount);
+
+	bool isAtFront[GeometryMath::laneCount];
+	unsigned int i, k;
+	for (k = 0; k < count; k++)
+	{
+		// Determine if this corner is at the front or the rear of the car
+		isAtFront[k] = corners[k]->location == Corner::LocationRightFront ||
+			corners[k]->location == Corner::LocationLeftFront;
+
+		MoveChassisPoints(*corners[k], rotations, secondRotation, isAtFront[k]);
+		success[k] = true;
+	}
+
+	// Solve outboard points and work in through the pushrods and bell cranks.
+	// We will iterate the z-location of the lower ball joint and the solution of
+	// the first three outboard points until the bottom of the tire is at z = 0.
+	// All corners are iterated together; each corner drops out of the iteration
+	// as soon as it has converged.
+	double upperLimit[GeometryMath::laneCount], lowerLimit[GeometryMath::laneCount];
+	double tolerance = 5.0e-8;
+	unsigned int limit = 100;
+	unsigned int warmLimit = 10;// Beyond this, the guess is not helping
+
+	// State of the iteration at each corner
+	unsigned int iteration[GeometryMath::laneCount];
+	bool converged[GeometryMath::laneCount];
+	bool isWarm[GeometryMath::laneCount];// false once bisecting from the design position
+	bool isChecking[GeometryMath::laneCount];// true while re-checking a possible branch jump
+	double previousZ[GeometryMath::laneCount], previousError[GeometryMath::laneCount];
+	double warmSolution[GeometryMath::laneCount];
+	double error;
+	unsigned int totalIterations(0);
+
+	// The corners that have not yet converged
+	Corner *activeCorners[GeometryMath::laneCount];
+	const Corner *activeOriginals[GeometryMath::laneCount];
+	unsigned int activeIndices[GeometryMath::laneCount];
+	unsigned int activeCount;
+	bool solved[GeometryMath::laneCount];
+	bool failed[GeometryMath::laneCount];
+
+	// NOTE:  Tire deflections here are assumed to be vertical.  For large wheel
+	// inclinations, this may introduce some error.
+
+	for (k = 0; k < count; k++)
+	{
+		iteration[k] = 0;
+		converged[k] = false;
+		isWarm[k] = guesses != NULL;
+		isChecking[k] = false;
+		if (isWarm[k])
+			corners[k]->hardpoints[Corner::LowerBallJoint].z = guesses[k];
+	}
+
+	while (true)
+	{
+		activeCount = 0;
+		for (k = 0; k < count; k++)
+		{
+			if (!converged[k] && iteration[k] < limit)
+			{
+				activeCorners[activeCount] = corners[k];
+				activeOriginals[activeCount] = originalCorners[k];
+				activeIndices[activeCount] = k;
+				activeCount++;
+			}
+		}
+
+		if (activeCount == 0)
+			break;
+
+		// Failures while warm starting are not reported; the corner is solved again from the design position
+		for (i = 0; i < activeCount; i++)
+		{
+			failed[i] = !SolveForXY(Corner::LowerBallJoint, Corner::LowerFrontTubMount,
+				Corner::LowerRearTubMount, *activeOriginals[i], *activeCorners[i]);
+			if (failed[i] && !isWarm[activeIndices[i]])
+			{
+				Debugger::GetInstance() << "ERROR:  Failed to solve for lower ball joint!" << Debugger::PriorityMedium;
+				success[activeIndices[i]] = false;
+			}
+		}
+
+		SolveForPoints(Corner::UpperBallJoint, Corner::LowerBallJoint,
+			Corner::UpperFrontTubMount, Corner::UpperRearTubMount, activeOriginals, activeCorners, activeCount, solved);
+		for (i = 0; i < activeCount; i++)
+		{
+			failed[i] = failed[i] || !solved[i];
+			if (!solved[i] && !isWarm[activeIndices[i]])
+			{
+				Debugger::GetInstance() << "ERROR:  Failed to solve for upper ball joint!" << Debugger::PriorityMedium;
+				success[activeIndices[i]] = false;
+			}
+		}
+
+		SolveForPoints(Corner::OutboardTieRod, Corner::LowerBallJoint,
+			Corner::UpperBallJoint, Corner::InboardTieRod, activeOriginals, activeCorners, activeCount, solved);
+		for (i = 0; i < activeCount; i++)
+		{
+			failed[i] = failed[i] || !solved[i];
+			if (!solved[i] && !isWarm[activeIndices[i]])
+			{
+				Debugger::GetInstance() << "ERROR:  Failed to solve for outboard tie rod!" << Debugger::PriorityMedium;
+				success[activeIndices[i]] = false;
+			}
+		}
+
+		SolveForPoints(Corner::WheelCenter, Corner::LowerBallJoint,
+			Corner::UpperBallJoint, Corner::OutboardTieRod, activeOriginals, activeCorners, activeCount, solved);
+		for (i = 0; i < activeCount; i++)
+		{
+			failed[i] = failed[i] || !solved[i];
+			if (!solved[i] && !isWarm[activeIndices[i]])
+			{
+				Debugger::GetInstance() << "ERROR:  Failed to solve for wheel center!" << Debugger::PriorityMedium;
+				success[activeIndices[i]] = false;
+			}
+		}
+
+		for (i = 0; i < activeCount; i++)
+		{
+			Corner &corner(*activeCorners[i]);
+			k = activeIndices[i];
+			double &z(corner.hardpoints[Corner::LowerBallJoint].z);
+
+			UpdateContactPatch(corner, *activeOriginals[i]);
+			iteration[k]++;
+			totalIterations++;
+
+			// With the origin on the ground, the error is equal to the Z location of the contact patch
+			// FIXME:  This is only true when using flat ground model!!!
+			error = corner.hardpoints[Corner::ContactPatch].z + tireDeflections[k];
+
+			if (isWarm[k] && !failed[i])
+			{
+				if (fabs(error) <= tolerance)
+				{
+					// A solution far from the prediction may be on a different branch than the
+					// previous points - check it against the solution from the design position
+					if (fabs(z - guesses[k]) > branchTolerances[k])
+					{
+						warmSolution[k] = z;
+						isChecking[k] = true;
+					}
+					else
+					{
+						converged[k] = true;
+						continue;
+					}
+				}
+				else if (iteration[k] < warmLimit)
+				{
+					// Secant step (the first step assumes that the contact patch moves with the ball joint)
+					double step;
+					if (iteration[k] == 1 || error == previousError[k])
+						step = -error;
+					else
+						step = -error * (z - previousZ[k]) / (error - previousError[k]);
+
+					// TODO:  Don't use magic 1" here
+					if (fabs(step) > 1.0)
+						step = step > 0.0 ? 1.0 : -1.0;
+
+					previousZ[k] = z;
+					previousError[k] = error;
+					z += step;
+					continue;
+				}
+			}
+
+			if (isWarm[k])
+			{
+				// Start over from the design position
+				isWarm[k] = false;
+				iteration[k] = 0;
+				z = originalCorners[k]->hardpoints[Corner::LowerBallJoint].z;
+				continue;
+			}
+
+			// Use a line search algorithm to adjust the height of the lower ball joint
+			// This could get hung up if the relationship between lower ball joint height and contact
+			// patch Z location is highly non-linear, but that would be an unusual (impossible?) case (extreme camber gain?)
+
+			// If this is the first iteration, initialize the limit variables
+			if (iteration[k] == 1)
+			{
+				// TODO:  Don't use magic 1" here
+				upperLimit[k] = z + 1.0;
+				lowerLimit[k] = z - 1.0;
+			}
+
+			// Make the adjustment in the guess
+			if (error > tolerance)
+				upperLimit[k] = z;
+			else if (error < -tolerance)
+				lowerLimit[k] = z;
+			else
+			{
+				converged[k] = true;
+				if (isChecking[k] && fabs(z - warmSolution[k]) > branchTolerances[k])
+					Debugger::GetInstance() << "Warning (SolveCorners):  Warm start jumped to a different solution branch; using the solution nearest the design position" << Debugger::PriorityMedium;
+			}
+			z = lowerLimit[k] + (upperLimit[k] - lowerLimit[k]) / 2.0;
+		}
+	}
+
+	for (k = 0; k < count; k++)
+	{
+		// Check to make sure we finished the loop because we were within the tolerance (and not
+		// because we hit the iteration limit)
+		if (!converged[k])
+		{
+			Debugger::GetInstance() << "Warning (SolveCorners):  Contact patch location did not converge" << Debugger::PriorityMedium;
+			success[k] = false;
+		}
+
+		if (!SolveActuation(*corners[k], *originalCorners[k], isAtFront[k]))
+			success[k] = false;
+	}
+
+	return totalIterations;
+}
+
+//==========================================================================
+// Class:			Kinematics
+// Function:		SolveCornersInParallel
+//
+// Description:		Solves each of the four corners on a separate thread (the
+//					last corner is solved on the calling thread).  Returns
+//					after all corners have been solved, so anything that
+//					depends on more than one corner may be solved afterwards.
+//					Should a thread fail to start, its corner is solved on the
+//					calling thread instead.
+//
+// Input Arguments:
+//		corners			= Corner* const* (must have size of 4), the corners of the
+//						  car we are manipulating
+//		originalCorners	= const Corner* const* (must have size of 4), the
+//						  un-perturbed locations of the suspension hardpoints
+//		tireDeflections	= const double* (must have size of 4)
+//		rotations		= const Vector& specifying the amount to rotate the chassis
+//						  about each axis
+//		secondRotation	= const Vector::Axis& describing the second axis of rotation
+//						  (the first is an input quantity)
+//		guesses			= const double* (must have size of 4, or be NULL), initial
+//						  lower ball joint heights
+//		branchTolerances	= const double* (must have size of 4, or be NULL)
+//
+// Output Arguments:
+//		success	= bool*, true for each corner that was solved without error(s)
+//
+// Return Value:
+//		unsigned int, number of contact patch iterations (summed over the corners)
 //
 //==========================================================================
-bool Kinematics::SolveCorner(Corner &corner, const Corner &originalCorner,
-	const Vector &rotations, const Vector::Axis &secondRotation, const double& tireDeflection)
+unsigned int Kinematics::SolveCornersInParallel(Corner* const *corners, const Corner* const *originalCorners,
+	const double *tireDeflections, const Vector &rotations, const Vector::Axis &secondRotation,
+	const double *guesses, const double *branchTolerances, bool *success)
 {
-	// Determine if this corner is at the front or the rear of the car
-	bool isAtFront = false;
-	if (corner.location == Corner::LocationRightFront || corner.location == Corner::LocationLeftFront)
-		isAtFront = true;
+	const unsigned int threadCount(3);
+	CornerThread *threads[threadCount];
+	unsigned int i, iterations(0);
+	for (i = 0; i < threadCount; i++)
+	{
+		threads[i] = new CornerThread(*this, *corners[i], *originalCorners[i],
+			tireDeflections[i], rotations, secondRotation,
+			guesses ? &guesses[i] : NULL, branchTolerances ? &branchTolerances[i] : NULL);
+		if (threads[i]->Run() != wxTHREAD_NO_ERROR)
+		{
+			Debugger::GetInstance() << "Warning (SolveCornersInParallel):  Failed to start thread" << Debugger::PriorityLow;
+			delete threads[i];
+			threads[i] = NULL;
+			iterations += SolveCorners(&corners[i], &originalCorners[i], &tireDeflections[i], 1,
+				rotations, secondRotation, guesses ? &guesses[i] : NULL,
+				branchTolerances ? &branchTolerances[i] : NULL, &success[i]);
+		}
+	}
+
+	iterations += SolveCorners(&corners[threadCount], &originalCorners[threadCount],
+		&tireDeflections[threadCount], 1, rotations, secondRotation,
+		guesses ? &guesses[threadCount] : NULL,
+		branchTolerances ? &branchTolerances[threadCount] : NULL, &success[threadCount]);
 
+	for (i = 0; i < threadCount; i++)
+	{
+		if (!threads[i])
+			continue;
+
+		threads[i]->Wait();
+		success[i] = threads[i]->GetSuccess();
+		iterations += threads[i]->GetIterations();
+		delete threads[i];
+	}
+
+	return iterations;
+}
+
+//==========================================================================
+// Class:			Kinematics
+// Function:		MoveChassisPoints
+//
+// Description:		Moves the body-fixed points of the specified corner with
+//					the sprung mass.
+//
+// Input Arguments:
+//		rotations		= const Vector& specifying the amount to rotate the chassis
+//						  about each axis
+//		secondRotation	= const Vector::Axis& describing the second axis of rotation
+//						  (the first is an input quantity)
+//		isAtFront		= const bool& indicating whether or not the corner is at
+//						  the front of the car
+//
+// Output Arguments:
+//		corner	= Corner&, the corner of the car we are manipulating
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Kinematics::MoveChassisPoints(Corner &corner, const Vector &rotations,
+	const Vector::Axis &secondRotation, const bool &isAtFront) const
+{
 	// First move all of the body-fixed points (rotations first)
 	corner.hardpoints[Corner::LowerFrontTubMount].Rotate(inputs.centerOfRotation,
 		rotations, inputs.firstRotation, secondRotation);
@@ -354,122 +947,89 @@ bool Kinematics::SolveCorner(Corner &corner, const Corner &originalCorner,
 	}
 
 	// Do the rotation and translation for the inboard half shafts at the same time
-	if ((originalCar->HasFrontHalfShafts() && isAtFront) ||
-		(originalCar->HasRearHalfShafts() && !isAtFront))
+	if ((carProperties.frontHalfShafts && isAtFront) ||
+		(carProperties.rearHalfShafts && !isAtFront))
 	{
 		corner.hardpoints[Corner::InboardHalfShaft].Rotate(inputs.centerOfRotation,
 			rotations, inputs.firstRotation, secondRotation);
 		corner.hardpoints[Corner::InboardHalfShaft].z += inputs.heave;
 	}
+}
 
-	bool success = true;
-
-	// Solve outboard points and work in through the pushrods and bell cranks.
-	// We will iterate the z-location of the lower ball joint and the solution of
-	// the first three outboard points until the bottom of the tire is at z = 0.
-	Vector wheelNormal;
-	Vector originalPlaneNormal;
-	Vector newPlaneNormal;
-	Vector wheelRotations;
-	double upperLimit(0.0), lowerLimit(0.0);// Initialized here to avoid MSVC++ compiler warning C4701
-	int iteration = 1;
-	double tolerance = 5.0e-8;
-	int limit = 100;
-
-	// NOTE:  Tire deflections here are assumed to be vertical.  For large wheel
-	// inclinations, this may introduce some error.
-
-	corner.hardpoints[Corner::ContactPatch].z = tolerance * 2;// Must be initialized to > Tolerance
-	while (iteration <= limit && fabs(corner.hardpoints[Corner::ContactPatch].z + tireDeflection) > tolerance)
-	{
-		if (!SolveForXY(Corner::LowerBallJoint, Corner::LowerFrontTubMount,
-			Corner::LowerRearTubMount, originalCorner, corner))
-		{
-			Debugger::GetInstance() << "ERROR:  Failed to solve for lower ball joint!" << Debugger::PriorityMedium;
-			success = false;
-		}
-
-		if (!SolveForPoint(Corner::UpperBallJoint, Corner::LowerBallJoint,
-			Corner::UpperFrontTubMount, Corner::UpperRearTubMount,originalCorner, corner))
-		{
-			Debugger::GetInstance() << "ERROR:  Failed to solve for upper ball joint!" << Debugger::PriorityMedium;
-			success = false;
-		}
-
-		if (!SolveForPoint(Corner::OutboardTieRod, Corner::LowerBallJoint,
-			Corner::UpperBallJoint, Corner::InboardTieRod, originalCorner, corner))
-		{
-			Debugger::GetInstance() << "ERROR:  Failed to solve for outboard tie rod!" << Debugger::PriorityMedium;
-			success = false;
-		}
-
-		if (!SolveForPoint(Corner::WheelCenter, Corner::LowerBallJoint,
-			Corner::UpperBallJoint, Corner::OutboardTieRod, originalCorner, corner))
-		{
-			Debugger::GetInstance() << "ERROR:  Failed to solve for wheel center!" << Debugger::PriorityMedium;
-			success = false;
-		}
-
-		originalPlaneNormal = VVASEMath::GetPlaneNormal(originalCorner.hardpoints[Corner::LowerBallJoint],
-			originalCorner.hardpoints[Corner::UpperBallJoint], originalCorner.hardpoints[Corner::OutboardTieRod]);
-		newPlaneNormal = VVASEMath::GetPlaneNormal(corner.hardpoints[Corner::LowerBallJoint],
-			corner.hardpoints[Corner::UpperBallJoint], corner.hardpoints[Corner::OutboardTieRod]);
-
-		// For some operations, if this is on the right-hand side of the car, the sign gets flipped
-		double sign = 1.0;
-		if (corner.location == Corner::LocationRightFront || corner.location == Corner::LocationRightRear)
-			sign *= -1.0;
-
-		// Determine what Euler angles I need to rotate OriginalPlaneNormal through to
-		// get NewPlaneNormal.  Do one angle at a time because order of rotations matters.
-		wheelRotations = originalPlaneNormal.AnglesTo(newPlaneNormal);
-		wheelNormal.Set(0.0, sign * 1.0, 0.0);
-		wheelNormal.Rotate(wheelRotations.z, Vector::AxisZ);
-		wheelNormal.Rotate(wheelRotations.x, Vector::AxisX);
-
-		// Add in the effects of camber and toe settings (contact patch location should not be affected
-		// by camber and toe settings - WheelCenter is calculated based on camber and toe, so we need to
-		// back that out in the contact patch solver to avoid making contact patch a function of camber
-		// and toe).
-		wheelNormal.Rotate(sign * originalCorner.staticCamber, Vector::AxisX);
-		wheelNormal.Rotate(sign * originalCorner.staticToe, Vector::AxisZ);
-
-		// Do the actual solving for the contact patch
-		SolveForContactPatch(corner.hardpoints[Corner::WheelCenter], wheelNormal,
-			originalCorner.hardpoints[Corner::ContactPatch].Distance(originalCorner.hardpoints[Corner::WheelCenter]),
-			corner.hardpoints[Corner::ContactPatch]);
-
-		// With the origin on the ground, the error is equal to the Z location of the contact patch
-		// FIXME:  This is only true when using flat ground model!!!
-		// Use a line search algorithm to adjust the height of the lower ball joint
-		// This could get hung up if the relationship between lower ball joint height and contact
-		// patch Z location is highly non-linear, but that would be an unusual (impossible?) case (extreme camber gain?)
-
-		// If this is the first iteration, initialize the limit variables
-		if (iteration == 1)
-		{
-			// TODO:  Don't use magic 1" here
-			upperLimit = corner.hardpoints[Corner::LowerBallJoint].z + 1.0;
-			lowerLimit = corner.hardpoints[Corner::LowerBallJoint].z - 1.0;
-		}
-
-		// Make the adjustment in the guess
-		if (corner.hardpoints[Corner::ContactPatch].z + tireDeflection > tolerance)
-			upperLimit = corner.hardpoints[Corner::LowerBallJoint].z;
-		else if (corner.hardpoints[Corner::ContactPatch].z + tireDeflection < -tolerance)
-			lowerLimit = corner.hardpoints[Corner::LowerBallJoint].z;
-		corner.hardpoints[Corner::LowerBallJoint].z = lowerLimit + (upperLimit - lowerLimit) / 2.0;
-
-		iteration++;
-	}
+//==========================================================================
+// Class:			Kinematics
+// Function:		UpdateContactPatch
+//
+// Description:		Solves for the contact patch location given the current
+//					locations of the outboard points of the corner.
+//
+// Input Arguments:
+//		originalCorner	= const Corner&, the un-perturbed locations of the
+//						  suspension hardpoints
+//
+// Output Arguments:
+//		corner	= Corner&, the corner of the car we are manipulating
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Kinematics::UpdateContactPatch(Corner &corner, const Corner &originalCorner)
+{
+	Vector originalPlaneNormal = VVASEMath::GetPlaneNormal(originalCorner.hardpoints[Corner::LowerBallJoint],
+		originalCorner.hardpoints[Corner::UpperBallJoint], originalCorner.hardpoints[Corner::OutboardTieRod]);
+	Vector newPlaneNormal = VVASEMath::GetPlaneNormal(corner.hardpoints[Corner::LowerBallJoint],
+		corner.hardpoints[Corner::UpperBallJoint], corner.hardpoints[Corner::OutboardTieRod]);
+
+	// For some operations, if this is on the right-hand side of the car, the sign gets flipped
+	double sign = 1.0;
+	if (corner.location == Corner::LocationRightFront || corner.location == Corner::LocationRightRear)
+		sign *= -1.0;
+
+	// Determine what Euler angles I need to rotate OriginalPlaneNormal through to
+	// get NewPlaneNormal.  Do one angle at a time because order of rotations matters.
+	Vector wheelRotations = originalPlaneNormal.AnglesTo(newPlaneNormal);
+	Vector wheelNormal(0.0, sign * 1.0, 0.0);
+	wheelNormal.Rotate(wheelRotations.z, Vector::AxisZ);
+	wheelNormal.Rotate(wheelRotations.x, Vector::AxisX);
+
+	// Add in the effects of camber and toe settings (contact patch location should not be affected
+	// by camber and toe settings - WheelCenter is calculated based on camber and toe, so we need to
+	// back that out in the contact patch solver to avoid making contact patch a function of camber
+	// and toe).
+	wheelNormal.Rotate(sign * originalCorner.staticCamber, Vector::AxisX);
+	wheelNormal.Rotate(sign * originalCorner.staticToe, Vector::AxisZ);
+
+	// Do the actual solving for the contact patch
+	SolveForContactPatch(corner.hardpoints[Corner::WheelCenter], wheelNormal,
+		originalCorner.hardpoints[Corner::ContactPatch].Distance(originalCorner.hardpoints[Corner::WheelCenter]),
+		corner.hardpoints[Corner::ContactPatch]);
+}
 
-	// Check to make sure we finished the loop because we were within the tolerance (and not
-	// because we hit the iteration limit)
-	if ((fabs(corner.hardpoints[Corner::ContactPatch].z + tireDeflection) > tolerance))
-	{
-		Debugger::GetInstance() << "Warning (SolveCorner):  Contact patch location did not converge" << Debugger::PriorityMedium;
-		success = false;
-	}
+//==========================================================================
+// Class:			Kinematics
+// Function:		SolveActuation
+//
+// Description:		Solves for the locations of the spring, damper, sway bar
+//					and half shaft points of the specified corner.  Must be
+//					called after the outboard points have been solved.
+//
+// Input Arguments:
+//		originalCorner	= const Corner&, the un-perturbed locations of the
+//						  suspension hardpoints
+//		isAtFront		= const bool& indicating whether or not the corner is at
+//						  the front of the car
+//
+// Output Arguments:
+//		corner	= Corner&, the corner of the car we are manipulating
+//
+// Return Value:
+//		bool, true for success, false for error(s)
+//
+//==========================================================================
+bool Kinematics::SolveActuation(Corner &corner, const Corner &originalCorner, const bool &isAtFront)
+{
+	bool success = true;
 
 	// Outboard spring/damper actuators
 	if (corner.actuationType == Corner::ActuationPushPullrod)
@@ -612,8 +1172,8 @@ bool Kinematics::SolveCorner(Corner &corner, const Corner &originalCorner,
 	}
 
 	// Half Shafts
-	if ((originalCar->HasFrontHalfShafts() && isAtFront) ||
-		(originalCar->HasRearHalfShafts() && !isAtFront))
+	if ((carProperties.frontHalfShafts && isAtFront) ||
+		(carProperties.rearHalfShafts && !isAtFront))
 	{
 		if (!SolveForPoint(Corner::OutboardHalfShaft, Corner::LowerBallJoint,
 			Corner::UpperBallJoint, Corner::OutboardTieRod, originalCorner, corner))
@@ -627,8 +1187,8 @@ bool Kinematics::SolveCorner(Corner &corner, const Corner &originalCorner,
 	if (localSuspension->frontBarStyle == Suspension::SwayBarUBar && isAtFront)
 	{
 		Vector originalBarMidpoint = 0.5 *
-			(originalCar->suspension->leftFront.hardpoints[Corner::BarArmAtPivot]
-			+ originalCar->suspension->rightFront.hardpoints[Corner::BarArmAtPivot]);
+			(originalSuspension->leftFront.hardpoints[Corner::BarArmAtPivot]
+			+ originalSuspension->rightFront.hardpoints[Corner::BarArmAtPivot]);
 		if (!SolveForPoint(corner.hardpoints[Corner::BarArmAtPivot],
 			corner.hardpoints[Corner::OutboardBarLink], localSuspension->hardpoints[Suspension::FrontBarMidPoint],
 			originalCorner.hardpoints[Corner::BarArmAtPivot], originalCorner.hardpoints[Corner::OutboardBarLink],
@@ -642,8 +1202,8 @@ bool Kinematics::SolveCorner(Corner &corner, const Corner &originalCorner,
 	else if (localSuspension->rearBarStyle == Suspension::SwayBarUBar && !isAtFront)
 	{
 		Vector originalBarMidpoint = 0.5 *
-			(originalCar->suspension->leftRear.hardpoints[Corner::BarArmAtPivot]
-			+ originalCar->suspension->rightRear.hardpoints[Corner::BarArmAtPivot]);
+			(originalSuspension->leftRear.hardpoints[Corner::BarArmAtPivot]
+			+ originalSuspension->rightRear.hardpoints[Corner::BarArmAtPivot]);
 		if (!SolveForPoint(corner.hardpoints[Corner::BarArmAtPivot],
 			corner.hardpoints[Corner::OutboardBarLink], localSuspension->hardpoints[Suspension::RearBarMidPoint],
 			originalCorner.hardpoints[Corner::BarArmAtPivot], originalCorner.hardpoints[Corner::OutboardBarLink],
@@ -765,12 +1325,143 @@ bool Kinematics::SolveForPoint(const Vector &center1, const Vector &center2,
 		return false;
 	}
 
-	// We now have two solutions.  To choose between them, we must examine the original
-	// location of the point and the original sphere centers.  The three sphere centers
-	// define a plane, and the the two solutions lie on opposite sides of the plane.
-	// The first step in identifying the correct solution is to determine which side of the
-	// original plane the original point was on, and which side of the new plane either one
-	// of the solutions is on.
+	current = ChooseIntersection(center1, center2, center3, originalCenter1,
+		originalCenter2, originalCenter3, original, intersections);
+
+	return true;
+}
+
+//==========================================================================
+// Class:			Kinematics
+// Function:		SolveForPoints
+//
+// Description:		Solves for the same point on several corners at once (one
+//					corner per lane).  Otherwise, this works the same way as
+//					SolveForPoint.  In the event of an error, the point for
+//					that corner is not changed.
+//
+// Input Arguments:
+//		target			= const Corner::Hardpoints& specifying the index of the point we are solving for
+//		reference1		= const Corner::Hardpoints& specifying the index of the point defining the first sphere
+//		reference2		= const Corner::Hardpoints& specifying the index of the point defining the second sphere
+//		reference3		= const Corner::Hardpoints& specifying the index of the point defining the third sphere
+//		originalCorners	= const Corner* const*
+//		count			= const unsigned int& specifying the number of corners (no
+//						  more than GeometryMath::laneCount)
+//
+// Output Arguments:
+//		currentCorners	= Corner* const*
+//		solved			= bool*, true for each corner that was solved successfully
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Kinematics::SolveForPoints(const Corner::Hardpoints &target, const Corner::Hardpoints& reference1,
+	const Corner::Hardpoints& reference2, const Corner::Hardpoints& reference3,
+	const Corner* const *originalCorners, Corner* const *currentCorners, const unsigned int &count,
+	bool *solved)
+{
+	assert(count <= GeometryMath::laneCount);
+
+	GeometryMath::SphereLanes s1;
+	GeometryMath::SphereLanes s2;
+	GeometryMath::SphereLanes s3;
+
+	// Unused lanes repeat the first corner so that every lane contains reasonable data
+	unsigned int k, source;
+	for (k = 0; k < GeometryMath::laneCount; k++)
+	{
+		source = k < count ? k : 0;
+		const Vector &original(originalCorners[source]->hardpoints[target]);
+		const Vector &center1(currentCorners[source]->hardpoints[reference1]);
+		const Vector &center2(currentCorners[source]->hardpoints[reference2]);
+		const Vector &center3(currentCorners[source]->hardpoints[reference3]);
+
+		s1.x[k] = center1.x;
+		s1.y[k] = center1.y;
+		s1.z[k] = center1.z;
+		s1.radius[k] = originalCorners[source]->hardpoints[reference1].Distance(original);
+		s2.x[k] = center2.x;
+		s2.y[k] = center2.y;
+		s2.z[k] = center2.z;
+		s2.radius[k] = originalCorners[source]->hardpoints[reference2].Distance(original);
+		s3.x[k] = center3.x;
+		s3.y[k] = center3.y;
+		s3.z[k] = center3.z;
+		s3.radius[k] = originalCorners[source]->hardpoints[reference3].Distance(original);
+	}
+
+	GeometryMath::VectorLanes laneIntersections[2];
+	bool found[GeometryMath::laneCount];
+	GeometryMath::FindThreeSpheresIntersections(s1, s2, s3, laneIntersections, found);
+
+	Vector intersections[2];
+	for (k = 0; k < count; k++)
+	{
+		solved[k] = false;
+		if (!found[k])
+		{
+			Debugger::GetInstance() << "Error (SolveForPoints):  Solution does not exist" << Debugger::PriorityLow;
+			continue;
+		}
+
+		intersections[0].Set(laneIntersections[0].x[k], laneIntersections[0].y[k], laneIntersections[0].z[k]);
+		intersections[1].Set(laneIntersections[1].x[k], laneIntersections[1].y[k], laneIntersections[1].z[k]);
+		if (intersections[0] != intersections[0] || intersections[1] != intersections[1])
+		{
+			Debugger::GetInstance() << "Error (SolveForPoints):  Invalid solution" << Debugger::PriorityLow;
+			continue;
+		}
+
+		currentCorners[k]->hardpoints[target] = ChooseIntersection(currentCorners[k]->hardpoints[reference1],
+			currentCorners[k]->hardpoints[reference2], currentCorners[k]->hardpoints[reference3],
+			originalCorners[k]->hardpoints[reference1], originalCorners[k]->hardpoints[reference2],
+			originalCorners[k]->hardpoints[reference3], originalCorners[k]->hardpoints[target], intersections);
+		solved[k] = true;
+	}
+}
+
+//==========================================================================
+// Class:			Kinematics
+// Function:		ChooseIntersection
+//
+// Description:		Chooses which of the two intersections of three spheres
+//					is the correct solution.  The three sphere centers
+//					define a plane, and the the two solutions lie on opposite
+//					sides of the plane; the correct solution is on the same
+//					side of the plane as the original point.
+//
+// Input Arguments:
+//		center1			= const Vector& specifying the center of the first sphere
+//		center2			= const Vector& specifying the center of the second sphere
+//		center3			= const Vector& specifying the center of the third sphere
+//		originalCenter1	= const Vector& specifying the original center of the
+//						  first sphere
+//		originalCenter2	= const Vector& specifying the original center of the
+//						  second sphere
+//		originalCenter3	= const Vector& specifying the original center of the
+//						  third sphere
+//		original		= const Vector& specifying the original location of the point
+//						  we are solving for
+//		intersections	= const Vector* (must have size of 2)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const Vector&, one of the intersections
+//		
+//==========================================================================
+const Vector& Kinematics::ChooseIntersection(const Vector &center1, const Vector &center2,
+	const Vector &center3, const Vector &originalCenter1,
+	const Vector &originalCenter2, const Vector &originalCenter3,
+	const Vector &original, const Vector *intersections)
+{
+	// To choose between the solutions, we must examine the original location of the
+	// point and the original sphere centers.  The first step in identifying the
+	// correct solution is to determine which side of the original plane the original
+	// point was on, and which side of the new plane either one of the solutions is on.
 
 	// Get the plane normals
 	Vector originalNormal = VVASEMath::GetPlaneNormal(originalCenter1, originalCenter2, originalCenter3);
@@ -787,11 +1478,9 @@ bool Kinematics::SolveForPoint(const Vector &center1, const Vector &center2,
 
 	// We can compare the sign of the original side with the new side to choose the correct solution
 	if ((newSide > 0 && originalSide > 0) || (newSide < 0 && originalSide < 0))
-		current = intersections[0];
-	else
-		current = intersections[1];
+		return intersections[0];
 
-	return true;
+	return intersections[1];
 }
 
 //==========================================================================
@@ -1294,11 +1983,15 @@ bool Kinematics::SolveInboardTBarPoints(const Vector &leftOutboard,
 	unsigned int i(0);
 	const unsigned int limit(100);
 	const double epsilon(1.0e-8);
-	Matrix error(3, 1, epsilon, epsilon, epsilon);
-	Matrix jacobian(3,3);
-	Matrix guess(3,1);// parameteric variables for the three points
+	FixedMatrix<3, 1> error;
+	FixedMatrix<3, 3> jacobian;
+	FixedMatrix<3, 1> guess;// parameteric variables for the three points
 	Vector left(0.0, 0.0, 0.0), right(0.0, 0.0, 0.0), center(0.0, 0.0, 0.0);
-	Matrix delta;
+	FixedMatrix<3, 1> delta;
+
+	error(0,0) = epsilon;
+	error(1,0) = epsilon;
+	error(2,0) = epsilon;
 
 	// Initialize parameteric variables such that result aligns as best
 	// as possible with original point locations
@@ -16,6 +16,8 @@
 
 // Standard C++ headers
 #include <cassert>
+#include <algorithm>
+#include <cmath>
 
 // Local headers
 #include "vSolver/physics/quasiStatic.h"
@@ -26,7 +28,8 @@
 #include "vCar/massProperties.h"
 #include "vCar/tireSet.h"
 #include "vCar/tire.h"
-#include "vMath/matrix.h"
+#include "vMath/fixedMatrix.h"
+#include "vMath/carMath.h"
 #include "vMath/vector.h"
 #include "vUtilities/debugger.h"
 
@@ -63,9 +66,13 @@ QuasiStatic::QuasiStatic()
 //		workingCar			= const Car*
 //		kinematicsInputs	= const Kinematics::Inputs&
 //		inputs				= const Inputs&
+//		initialGuess		= const QuasiStaticOutputs*, solution to a nearby state to
+//							  start from (NULL to start from the static state)
 //
 // Output Arguments:
-//		outputs				= QuasiStaticOutputs&
+//		outputs				= QuasiStaticOutputs& (undefined (QNAN) if no solution
+//							  could be found, including when the iteration limit
+//							  is reached)
 //
 // Return Value:
 //		Kinematics::Inputs
@@ -73,7 +80,7 @@ QuasiStatic::QuasiStatic()
 //==========================================================================
 Kinematics::Inputs QuasiStatic::Solve(const Car* originalCar, Car* workingCar,
 	const Kinematics::Inputs& kinematicsInputs, const Inputs& inputs,
-	QuasiStaticOutputs& outputs) const
+	QuasiStaticOutputs& outputs, const QuasiStaticOutputs* initialGuess) const
 {
 	Kinematics kinematics;
 	kinematics.SetCenterOfRotation(kinematicsInputs.centerOfRotation);
@@ -82,25 +89,34 @@ Kinematics::Inputs QuasiStatic::Solve(const Car* originalCar, Car* workingCar,
 
 	unsigned int i(0);
 	const unsigned int limit(100);
-	const double epsilon(1.0e-3);
 	const double maxError(1.0e-8);
-	Matrix error(13, 1), tempError;
-	Matrix guess(3, 1);// parameteric variables representing remaining kinematic state inputs
-	Matrix jacobian(error.GetNumberOfRows(), guess.GetNumberOfRows());
-	Matrix delta;
-
-	guess(0,0) = 0.0;
-	guess(1,0) = 0.0;
-	guess(2,0) = 0.0;
+	FixedMatrix<13, 1> error, previousError;
+	FixedMatrix<3, 1> guess;// parameteric variables representing remaining kinematic state inputs
+	FixedMatrix<13, 3> jacobian;
+	FixedMatrix<3, 1> delta;
 
 	error(0,0) = 2.0 * maxError;
 
 	WheelSet preLoad(ComputePreLoad(originalCar));
-	WheelSet wheelLoads(originalCar->massProperties->cornerWeights);// [lb]
-	wheelLoads.leftFront *= 32.174;
-	wheelLoads.rightFront *= 32.174;
-	wheelLoads.leftRear *= 32.174;
-	wheelLoads.rightRear *= 32.174;
+	WheelSet wheelLoads;// [lb]
+	if (initialGuess)
+	{
+		guess(0,0) = initialGuess->roll;
+		guess(1,0) = initialGuess->pitch;
+		guess(2,0) = initialGuess->heave;
+		wheelLoads = initialGuess->wheelLoads;
+	}
+	else
+	{
+		guess(0,0) = 0.0;
+		guess(1,0) = 0.0;
+		guess(2,0) = 0.0;
+		wheelLoads = originalCar->massProperties->cornerWeights;
+		wheelLoads.leftFront *= 32.174;
+		wheelLoads.rightFront *= 32.174;
+		wheelLoads.leftRear *= 32.174;
+		wheelLoads.rightRear *= 32.174;
+	}
 	WheelSet tireDeflections(ComputeTireDeflections(*originalCar->tires, wheelLoads));
 
 	// TODO:  Compute lateral and longitudinal forces at each corner
@@ -126,90 +142,91 @@ Kinematics::Inputs QuasiStatic::Solve(const Car* originalCar, Car* workingCar,
 	// ** Looking at MMM plots, I believe that with a proper tire model we could (and must) solve for steering angle as a function of Gx and Gy.
 	//    This is consistent with thoughts I am having about including a real tire model, which would require velocity and yaw velocity inputs.
 
+	// The jacobian is computed by finite differences only when necessary; between these
+	// evaluations, Broyden's method is used to update the jacobian from the change in
+	// the error, so most iterations require a single kinematics solution.  The Broyden
+	// update only accounts for changes in roll, pitch and heave, so it is not used
+	// across iterations where the tire deflections changed by more than this amount
+	const double maxDeflectionChange(1.0e-4);// [in]
+	bool updateJacobian(true), failed(false);
+	unsigned int solutionCount(0);
+	double stepSquared;
+	WheelSet previousDeflections;
 	while (i < limit && (error.GetNorm() > maxError ||
 		ComputeDeltaWheelSets(kinematics.GetTireDeflections(), tireDeflections) > maxError))
 	{
+		previousDeflections = kinematics.GetTireDeflections();
 		kinematics.SetRoll(guess(0,0));
 		kinematics.SetPitch(guess(1,0));
 		kinematics.SetHeave(guess(2,0));
 		kinematics.SetTireDeflections(tireDeflections);
 
 		kinematics.UpdateKinematics(originalCar, workingCar, wxString::Format("Quasi-Static, i = %u (error)", i));
+		solutionCount++;
 		wheelLoads = ComputeWheelLoads(originalCar, kinematics.GetOutputs(), preLoad);
 		tireDeflections = ComputeTireDeflections(*originalCar->tires, wheelLoads);
+		previousError = error;
 		error = ComputeError(workingCar, inputs.gx, inputs.gy, kinematics.GetOutputs(), preLoad);
 
-		kinematics.SetRoll(guess(0,0) + epsilon);
-		kinematics.UpdateKinematics(originalCar, workingCar, wxString::Format("Quasi-Static, i = %u (roll)", i));
-
-		tempError = ComputeError(workingCar, inputs.gx, inputs.gy, kinematics.GetOutputs(), preLoad);
-		jacobian(0,0) = (tempError(0,0) - error(0,0)) / epsilon;
-		jacobian(1,0) = (tempError(1,0) - error(1,0)) / epsilon;
-		jacobian(2,0) = (tempError(2,0) - error(2,0)) / epsilon;
-		jacobian(3,0) = (tempError(3,0) - error(3,0)) / epsilon;
-		jacobian(4,0) = (tempError(4,0) - error(4,0)) / epsilon;
-		jacobian(5,0) = (tempError(5,0) - error(5,0)) / epsilon;
-		jacobian(6,0) = (tempError(6,0) - error(6,0)) / epsilon;
-		jacobian(7,0) = (tempError(7,0) - error(7,0)) / epsilon;
-		jacobian(8,0) = (tempError(8,0) - error(8,0)) / epsilon;
-		jacobian(9,0) = (tempError(9,0) - error(9,0)) / epsilon;
-		jacobian(10,0) = (tempError(10,0) - error(10,0)) / epsilon;
-		jacobian(11,0) = (tempError(11,0) - error(11,0)) / epsilon;
-		jacobian(12,0) = (tempError(12,0) - error(12,0)) / epsilon;
+		// If the last step did not reduce the error (or the tire deflections moved too far
+		// for the Broyden update to be meaningful), the approximate jacobian is no longer good enough
+		if (i > 0 && (error.GetNorm() >= previousError.GetNorm() ||
+			ComputeDeltaWheelSets(kinematics.GetTireDeflections(), previousDeflections) > maxDeflectionChange))
+			updateJacobian = true;
 
-		kinematics.SetRoll(guess(0,0));
-		kinematics.SetPitch(guess(1,0) + epsilon);
-		kinematics.UpdateKinematics(originalCar, workingCar, wxString::Format("Quasi-Static, i = %u (pitch)", i));
-
-		tempError = ComputeError(workingCar, inputs.gx, inputs.gy, kinematics.GetOutputs(), preLoad);
-		jacobian(0,1) = (tempError(0,0) - error(0,0)) / epsilon;
-		jacobian(1,1) = (tempError(1,0) - error(1,0)) / epsilon;
-		jacobian(2,1) = (tempError(2,0) - error(2,0)) / epsilon;
-		jacobian(3,1) = (tempError(3,0) - error(3,0)) / epsilon;
-		jacobian(4,1) = (tempError(4,0) - error(4,0)) / epsilon;
-		jacobian(5,1) = (tempError(5,0) - error(5,0)) / epsilon;
-		jacobian(6,1) = (tempError(6,0) - error(6,0)) / epsilon;
-		jacobian(7,1) = (tempError(7,0) - error(7,0)) / epsilon;
-		jacobian(8,1) = (tempError(8,0) - error(8,0)) / epsilon;
-		jacobian(9,1) = (tempError(9,0) - error(9,0)) / epsilon;
-		jacobian(10,1) = (tempError(10,0) - error(10,0)) / epsilon;
-		jacobian(11,1) = (tempError(11,0) - error(11,0)) / epsilon;
-		jacobian(12,1) = (tempError(12,0) - error(12,0)) / epsilon;
-
-		kinematics.SetPitch(guess(1,0));
-		kinematics.SetHeave(guess(2,0) + epsilon);
-		kinematics.UpdateKinematics(originalCar, workingCar, wxString::Format("Quasi-Static, i = %u (heave)", i));
-
-		tempError = ComputeError(workingCar, inputs.gx, inputs.gy, kinematics.GetOutputs(), preLoad);
-		jacobian(0,2) = (tempError(0,0) - error(0,0)) / epsilon;
-		jacobian(1,2) = (tempError(1,0) - error(1,0)) / epsilon;
-		jacobian(2,2) = (tempError(2,0) - error(2,0)) / epsilon;
-		jacobian(3,2) = (tempError(3,0) - error(3,0)) / epsilon;
-		jacobian(4,2) = (tempError(4,0) - error(4,0)) / epsilon;
-		jacobian(5,2) = (tempError(5,0) - error(5,0)) / epsilon;
-		jacobian(6,2) = (tempError(6,0) - error(6,0)) / epsilon;
-		jacobian(7,2) = (tempError(7,0) - error(7,0)) / epsilon;
-		jacobian(8,2) = (tempError(8,0) - error(8,0)) / epsilon;
-		jacobian(9,2) = (tempError(9,0) - error(9,0)) / epsilon;
-		jacobian(10,2) = (tempError(10,0) - error(10,0)) / epsilon;
-		jacobian(11,2) = (tempError(11,0) - error(11,0)) / epsilon;
-		jacobian(12,2) = (tempError(12,0) - error(12,0)) / epsilon;
+		if (updateJacobian)
+		{
+			jacobian = ComputeJacobian(kinematics, originalCar, workingCar, guess, error, inputs, preLoad, i);
+			solutionCount += guess.GetNumberOfRows();
+			updateJacobian = false;
+		}
+		else
+		{
+			// Broyden's update (the step taken was -delta):
+			// J += (dError - J * step) * step' / (step' * step)
+			stepSquared = (delta.GetTranspose() * delta)(0,0);
+			if (stepSquared > 0.0)
+				jacobian -= (error - previousError + jacobian * delta) * delta.GetTranspose() / stepSquared;
+		}
 
 		// Compute next guess
 		if (!jacobian.LeftDivide(error, delta))
 		{
 			Debugger::GetInstance() << "Error:  Failed to invert jacobian" << Debugger::PriorityLow;
-			Debugger::GetInstance() << "Error:  Failed solve for quasi-static state" << Debugger::PriorityVeryHigh;
-			return kinematics.GetInputs();
+			failed = true;
+			break;
 		}
 		guess -= delta;
 
 		i++;
 	}
 
+	Debugger::GetInstance() << "Quasi-static solution required " << (int)solutionCount
+		<< " kinematics solutions (" << (int)i << " iterations)" << Debugger::PriorityLow;
+
+	// The last guess is not a solution if we stopped before converging (at the
+	// iteration limit, the final step was never checked), so it is not returned
 	if (i == limit)
+	{
 		Debugger::GetInstance() << "Warning:  Iteration limit reached (QuasiStatic::Solve)" << Debugger::PriorityMedium;
-	
+		failed = true;
+	}
+
+	if (failed)
+	{
+		Debugger::GetInstance() << "Error:  Failed solve for quasi-static state" << Debugger::PriorityVeryHigh;
+
+		outputs.wheelLoads.leftFront = VVASEMath::QNAN;
+		outputs.wheelLoads.rightFront = VVASEMath::QNAN;
+		outputs.wheelLoads.leftRear = VVASEMath::QNAN;
+		outputs.wheelLoads.rightRear = VVASEMath::QNAN;
+		outputs.roll = VVASEMath::QNAN;
+		outputs.pitch = VVASEMath::QNAN;
+		outputs.heave = VVASEMath::QNAN;
+
+		return kinematics.GetInputs();
+	}
+
 	outputs.wheelLoads = wheelLoads;
 	
 	outputs.roll = guess(0,0);
@@ -219,6 +236,70 @@ Kinematics::Inputs QuasiStatic::Solve(const Car* originalCar, Car* workingCar,
 	return kinematics.GetInputs();
 }
 
+//==========================================================================
+// Class:			QuasiStatic
+// Function:		ComputeJacobian
+//
+// Description:		Computes the jacobian of the error with respect to roll,
+//					pitch and heave using forward differences, with steps
+//					scaled by the magnitude of each state variable.  Requires
+//					one kinematics solution per state variable.  The
+//					kinematic state is restored to guess on return.
+//
+// Input Arguments:
+//		kinematics	= Kinematics& (tire deflections must already be set)
+//		originalCar	= const Car*
+//		workingCar	= Car*
+//		guess		= const FixedMatrix<3, 1>& containing roll, pitch and heave
+//		error		= const FixedMatrix<13, 1>& containing the error at guess
+//		inputs		= const Inputs&
+//		preLoad		= const WheelSet&
+//		iteration	= const unsigned int& (for debugging messages only)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FixedMatrix<13, 3>
+//
+//==========================================================================
+FixedMatrix<13, 3> QuasiStatic::ComputeJacobian(Kinematics& kinematics, const Car* originalCar,
+	Car* workingCar, const FixedMatrix<3, 1>& guess, const FixedMatrix<13, 1>& error, const Inputs& inputs,
+	const WheelSet& preLoad, const unsigned int& iteration) const
+{
+	// Steps are relative to the variable (with a floor for values near zero), but still
+	// large enough to stay clear of the kinematics solver's tolerance.  Forward (rather
+	// than central) differences are used because the error has a kink at zero pitch,
+	// which is where cold starts begin.
+	const double relativeStep(1.0e-5);
+	const char* names[] = { "roll", "pitch", "heave" };
+	FixedMatrix<13, 3> jacobian;
+	FixedMatrix<13, 1> perturbedError;
+	double step;
+
+	unsigned int i, j;
+	for (j = 0; j < guess.GetNumberOfRows(); j++)
+	{
+		step = relativeStep * std::max(fabs(guess(j,0)), 1.0);
+
+		kinematics.SetRoll(guess(0,0) + (j == 0 ? step : 0.0));
+		kinematics.SetPitch(guess(1,0) + (j == 1 ? step : 0.0));
+		kinematics.SetHeave(guess(2,0) + (j == 2 ? step : 0.0));
+		kinematics.UpdateKinematics(originalCar, workingCar,
+			wxString::Format("Quasi-Static, i = %u (%s)", iteration, names[j]));
+
+		perturbedError = ComputeError(workingCar, inputs.gx, inputs.gy, kinematics.GetOutputs(), preLoad);
+		for (i = 0; i < error.GetNumberOfRows(); i++)
+			jacobian(i,j) = (perturbedError(i,0) - error(i,0)) / step;
+	}
+
+	kinematics.SetRoll(guess(0,0));
+	kinematics.SetPitch(guess(1,0));
+	kinematics.SetHeave(guess(2,0));
+
+	return jacobian;
+}
+
 //==========================================================================
 // Class:			QuasiStatic
 // Function:		ComputeWheelLoads
@@ -394,17 +475,17 @@ WheelSet QuasiStatic::ComputePreLoad(const Car* originalCar) const
 //		None
 //
 // Return Value:
-//		Matrix
+//		FixedMatrix<13, 4>
 //
 //==========================================================================
-Matrix QuasiStatic::BuildSystemMatrix(const Car* workingCar) const
+FixedMatrix<13, 4> QuasiStatic::BuildSystemMatrix(const Car* workingCar) const
 {
 	// This is the "A" matrix in A * x = b
 	// x is the vector of vertical tire loads:
 	// x = [F_LF; F_RF; F_LR; F_RR]
 
 	const Suspension* s(workingCar->suspension);
-	Matrix m(13, 4);
+	FixedMatrix<13, 4> m;
 
 	// Sum of y-moments about left front wheel
 	m(0,0) = 0.0;
@@ -506,10 +587,10 @@ Matrix QuasiStatic::BuildSystemMatrix(const Car* workingCar) const
 //		None
 //
 // Return Value:
-//		Matrix
+//		FixedMatrix<13, 1>
 //
 //==========================================================================
-Matrix QuasiStatic::BuildRightHandMatrix(const Car* workingCar, const double& gx,
+FixedMatrix<13, 1> QuasiStatic::BuildRightHandMatrix(const Car* workingCar, const double& gx,
 	const double& gy, const KinematicOutputs& outputs, const WheelSet& preLoad) const
 {
 	// This is the "b" matrix in A * x = b
@@ -517,7 +598,7 @@ Matrix QuasiStatic::BuildRightHandMatrix(const Car* workingCar, const double& gx
 	const MassProperties* mp(workingCar->massProperties);
 	const Suspension* s(workingCar->suspension);
 	const double gravity(32.174);// [ft/sec^2]
-	Matrix m(13, 1);
+	FixedMatrix<13, 1> m;
 
 	// TODO:  Consider (vertical) motion of sprung mass CG?
 
@@ -640,15 +721,15 @@ Matrix QuasiStatic::BuildRightHandMatrix(const Car* workingCar, const double& gx
 //		None
 //
 // Return Value:
-//		Matrix
+//		FixedMatrix<13, 1>
 //
 //==========================================================================
-Matrix QuasiStatic::ComputeError(const Car* workingCar, const double& gx,
+FixedMatrix<13, 1> QuasiStatic::ComputeError(const Car* workingCar, const double& gx,
 	const double& gy, const KinematicOutputs& outputs, const WheelSet& preLoad) const
 {
-	Matrix A(BuildSystemMatrix(workingCar));
-	Matrix b(BuildRightHandMatrix(workingCar, gx, gy, outputs, preLoad));
-	Matrix x;
+	FixedMatrix<13, 4> A(BuildSystemMatrix(workingCar));
+	FixedMatrix<13, 1> b(BuildRightHandMatrix(workingCar, gx, gy, outputs, preLoad));
+	FixedMatrix<4, 1> x;
 
 	if (!A.LeftDivide(b, x))
 	{
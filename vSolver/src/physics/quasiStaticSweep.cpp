@@ -0,0 +1,396 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  quasiStaticSweep.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Quasi-static sweep object.  Solves the quasi-static vehicle attitude for
+//				 a set of accelerations (i.e. a g-g diagram), distributing the points
+//				 across the worker threads.
+// History:
+
+// Standard C++ headers
+#include <cassert>
+#include <cmath>
+
+// Local headers
+#include "vSolver/physics/quasiStaticSweep.h"
+#include "vSolver/physics/quasiStatic.h"
+#include "vSolver/physics/quasiStaticOutputs.h"
+#include "vSolver/threads/jobQueue.h"
+#include "vSolver/threads/threadJob.h"
+#include "vSolver/threads/quasiStaticSweepData.h"
+#include "vSolver/threads/inverseSemaphore.h"
+#include "vSolver/threads/kinematicsBatchData.h"
+#include "vCar/car.h"
+#include "vMath/carMath.h"
+#include "vUtilities/debugger.h"
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		QuasiStaticSweep
+//
+// Description:		Constructor for QuasiStaticSweep class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+QuasiStaticSweep::QuasiStaticSweep()
+{
+	originalCar = NULL;
+	rackTravel = 0.0;
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		SetGrid
+//
+// Description:		Defines the points as a rectangular grid.  Points are
+//					stored with gy varying fastest.
+//
+// Input Arguments:
+//		gxMin	= const double& [G]
+//		gxMax	= const double& [G]
+//		gxCount	= const unsigned int&, number of points along gx
+//		gyMin	= const double& [G]
+//		gyMax	= const double& [G]
+//		gyCount	= const unsigned int&, number of points along gy
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void QuasiStaticSweep::SetGrid(const double &gxMin, const double &gxMax, const unsigned int &gxCount,
+	const double &gyMin, const double &gyMax, const unsigned int &gyCount)
+{
+	gx.clear();
+	gy.clear();
+
+	unsigned int i, j;
+	for (i = 0; i < gxCount; i++)
+	{
+		for (j = 0; j < gyCount; j++)
+		{
+			gx.push_back(gxCount > 1 ? gxMin + (gxMax - gxMin) * i / (gxCount - 1) : gxMin);
+			gy.push_back(gyCount > 1 ? gyMin + (gyMax - gyMin) * j / (gyCount - 1) : gyMin);
+		}
+	}
+
+	AllocateResults();
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		SetPolar
+//
+// Description:		Defines the points as concentric circles about zero (the
+//					friction circle), plus one point at the origin.  Points are
+//					stored ring by ring, working outward.
+//
+// Input Arguments:
+//		maximumG		= const double&, radius of the outermost ring [G]
+//		radialCount		= const unsigned int&, number of rings
+//		angularCount	= const unsigned int&, number of points in each ring
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void QuasiStaticSweep::SetPolar(const double &maximumG, const unsigned int &radialCount,
+	const unsigned int &angularCount)
+{
+	gx.assign(1, 0.0);
+	gy.assign(1, 0.0);
+
+	double radius, angle;
+	unsigned int i, j;
+	for (i = 1; i <= radialCount; i++)
+	{
+		radius = maximumG * i / radialCount;
+		for (j = 0; j < angularCount; j++)
+		{
+			angle = 2.0 * VVASEMath::Pi * j / angularCount;
+			gx.push_back(radius * cos(angle));
+			gy.push_back(radius * sin(angle));
+		}
+	}
+
+	AllocateResults();
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		SetPoints
+//
+// Description:		Defines the points explicitly.  Points that are close to
+//					each other should also be close in the list, since each
+//					thread solves a contiguous part of the list.
+//
+// Input Arguments:
+//		gx	= const std::vector<double>& [G]
+//		gy	= const std::vector<double>& [G] (same size as gx)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void QuasiStaticSweep::SetPoints(const std::vector<double> &gx, const std::vector<double> &gy)
+{
+	assert(gx.size() == gy.size());
+
+	this->gx = gx;
+	this->gy = gy;
+
+	AllocateResults();
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		AllocateResults
+//
+// Description:		Sizes the result vectors to match the number of points.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void QuasiStaticSweep::AllocateResults()
+{
+	roll.assign(gx.size(), 0.0);
+	pitch.assign(gx.size(), 0.0);
+	heave.assign(gx.size(), 0.0);
+	leftFrontLoad.assign(gx.size(), 0.0);
+	rightFrontLoad.assign(gx.size(), 0.0);
+	leftRearLoad.assign(gx.size(), 0.0);
+	rightRearLoad.assign(gx.size(), 0.0);
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		Solve
+//
+// Description:		Solves every point.  The points are divided into
+//					contiguous ranges, and each range is solved as one job.
+//					Blocks until all of the jobs are complete.
+//
+// Input Arguments:
+//		queue				= JobQueue& to which the jobs are added
+//		threadCount			= const unsigned int&, number of threads serving the queue
+//		originalCar			= const Car&
+//		kinematicsInputs	= const Kinematics::Inputs& (for center of rotation and
+//							  order of rotations)
+//		rackTravel			= const double& [in]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void QuasiStaticSweep::Solve(JobQueue &queue, const unsigned int &threadCount,
+	const Car &originalCar, const Kinematics::Inputs &kinematicsInputs, const double &rackTravel)
+{
+	if (gx.size() == 0)
+		return;
+
+	this->originalCar = &originalCar;
+	this->kinematicsInputs = kinematicsInputs;
+	this->rackTravel = rackTravel;
+
+	// Same balance between job overhead and load balancing as for kinematics batches
+	const unsigned int rangeSize(KinematicsBatchData::ComputeBatchSize(gx.size(), threadCount));
+	InverseSemaphore completion;
+	completion.Set((gx.size() + rangeSize - 1) / rangeSize);
+
+	unsigned int start;
+	int jobIndex(0);
+	for (start = 0; start < gx.size(); start += rangeSize)
+	{
+		QuasiStaticSweepData *data = new QuasiStaticSweepData(this, start,
+			start + rangeSize < gx.size() ? start + rangeSize : gx.size());
+		data->completion = &completion;
+		queue.AddJob(ThreadJob(ThreadJob::CommandThreadQuasiStaticSweep, data,
+			_T("Quasi-Static Sweep"), jobIndex));
+		jobIndex++;
+	}
+
+	completion.Wait();
+
+	this->originalCar = NULL;
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		SolveRange
+//
+// Description:		Solves the specified points.  Each point is started from
+//					the solution to the nearest point that has already been
+//					solved successfully in this range (the first point is
+//					started from the static state).  Points that could not
+//					be solved (including those that did not converge) are
+//					retried from the static state, and are left undefined
+//					(QNAN) if that fails, too.
+//
+// Input Arguments:
+//		start	= const unsigned int&, first point to solve
+//		end		= const unsigned int&, one past the last point to solve
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void QuasiStaticSweep::SolveRange(const unsigned int &start, const unsigned int &end)
+{
+	assert(originalCar);
+
+	// Each range works from its own copy of the original car, so the ranges do not
+	// serialize on the original car's mutex while solving
+	originalCar->GetMutex().Lock();
+	const Car referenceCar(*originalCar);
+	Car workingCar(*originalCar);
+	originalCar->GetMutex().Unlock();
+
+	QuasiStatic quasiStatic;
+	QuasiStatic::Inputs inputs;
+	inputs.rackTravel = rackTravel;
+
+	QuasiStaticOutputs outputs, guess;
+	unsigned int i, nearest;
+	for (i = start; i < end; i++)
+	{
+		inputs.gx = gx[i];
+		inputs.gy = gy[i];
+
+		nearest = FindNearestSolved(start, i, i);
+		if (nearest < i)
+		{
+			guess.roll = roll[nearest];
+			guess.pitch = pitch[nearest];
+			guess.heave = heave[nearest];
+			guess.wheelLoads.leftFront = leftFrontLoad[nearest];
+			guess.wheelLoads.rightFront = rightFrontLoad[nearest];
+			guess.wheelLoads.leftRear = leftRearLoad[nearest];
+			guess.wheelLoads.rightRear = rightRearLoad[nearest];
+			quasiStatic.Solve(&referenceCar, &workingCar, kinematicsInputs, inputs, outputs, &guess);
+
+			// A poor starting point can lead the solver astray, so try again from the static state
+			if (!IsSolved(outputs))
+				quasiStatic.Solve(&referenceCar, &workingCar, kinematicsInputs, inputs, outputs);
+		}
+		else
+			quasiStatic.Solve(&referenceCar, &workingCar, kinematicsInputs, inputs, outputs);
+
+		// Solve() leaves the outputs undefined unless it converged, so failed points
+		// are never used as starting points for their neighbors
+		if (!IsSolved(outputs))
+			Debugger::GetInstance() << "ERROR (QuasiStaticSweep):  Failed to solve point " << (int)i
+				<< "; outputs are undefined" << Debugger::PriorityHigh;
+
+		roll[i] = outputs.roll;
+		pitch[i] = outputs.pitch;
+		heave[i] = outputs.heave;
+		leftFrontLoad[i] = outputs.wheelLoads.leftFront;
+		rightFrontLoad[i] = outputs.wheelLoads.rightFront;
+		leftRearLoad[i] = outputs.wheelLoads.leftRear;
+		rightRearLoad[i] = outputs.wheelLoads.rightRear;
+	}
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		IsSolved
+//
+// Description:		Checks whether the outputs describe a valid solution.
+//
+// Input Arguments:
+//		outputs	= const QuasiStaticOutputs&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the attitude is defined
+//
+//==========================================================================
+bool QuasiStaticSweep::IsSolved(const QuasiStaticOutputs &outputs)
+{
+	return VVASEMath::IsValid(outputs.roll) && VVASEMath::IsValid(outputs.pitch) &&
+		VVASEMath::IsValid(outputs.heave);
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweep
+// Function:		FindNearestSolved
+//
+// Description:		Finds the successfully solved point in [start, end) that is
+//					closest to the specified point (in terms of acceleration).
+//
+// Input Arguments:
+//		start	= const unsigned int&
+//		end		= const unsigned int&
+//		point	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, index of the nearest point, or end if there are no solved
+//		points in the range
+//
+//==========================================================================
+unsigned int QuasiStaticSweep::FindNearestSolved(const unsigned int &start,
+	const unsigned int &end, const unsigned int &point) const
+{
+	unsigned int i, nearest(end);
+	double distanceSquared, minimumDistanceSquared(0.0);
+
+	// Search backwards, since the most recent points are usually the closest
+	for (i = end; i > start; i--)
+	{
+		// Failed points are undefined and must not be used as starting points
+		if (VVASEMath::IsNaN(roll[i - 1]))
+			continue;
+
+		distanceSquared = (gx[i - 1] - gx[point]) * (gx[i - 1] - gx[point])
+			+ (gy[i - 1] - gy[point]) * (gy[i - 1] - gy[point]);
+		if (nearest == end || distanceSquared < minimumDistanceSquared)
+		{
+			nearest = i - 1;
+			minimumDistanceSquared = distanceSquared;
+		}
+	}
+
+	return nearest;
+}
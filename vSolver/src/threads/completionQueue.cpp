@@ -0,0 +1,114 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  completionQueue.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  This class is a synchronization object for multi-threaded applications.
+//				 Worker threads post a tag as each job completes, and the waiting thread
+//				 receives the tags in the order in which the jobs completed (unlike
+//				 InverseSemaphore, which only reports when all jobs are complete).
+// History:
+
+// Local headers
+#include "vSolver/threads/completionQueue.h"
+
+//==========================================================================
+// Class:			CompletionQueue
+// Function:		CompletionQueue
+//
+// Description:		Constructor for the CompletionQueue class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+CompletionQueue::CompletionQueue() : condition(mutex)
+{
+}
+
+//==========================================================================
+// Class:			CompletionQueue
+// Function:		Post
+//
+// Description:		Adds a tag to the queue and wakes the waiting thread.
+//
+// Input Arguments:
+//		tag	= const unsigned int& identifying the completed job
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void CompletionQueue::Post(const unsigned int &tag)
+{
+	wxMutexLocker lock(mutex);
+	tags.push_back(tag);
+	condition.Signal();
+}
+
+//==========================================================================
+// Class:			CompletionQueue
+// Function:		Wait
+//
+// Description:		Blocks until a tag is available, then removes it from
+//					the queue.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, the oldest tag in the queue
+//
+//==========================================================================
+unsigned int CompletionQueue::Wait()
+{
+	wxMutexLocker lock(mutex);
+	while (tags.empty())
+		condition.Wait();
+
+	unsigned int tag(tags.front());
+	tags.pop_front();
+
+	return tag;
+}
+
+//==========================================================================
+// Class:			CompletionQueue
+// Function:		GetCount
+//
+// Description:		Returns the number of tags waiting in the queue.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int CompletionQueue::GetCount()
+{
+	wxMutexLocker lock(mutex);
+	return tags.size();
+}
\ No newline at end of file
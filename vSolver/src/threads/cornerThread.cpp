@@ -0,0 +1,86 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  cornerThread.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class definition for the CornerThread class.  This is a
+//				 short-lived, joinable thread that solves one corner of the car on
+//				 behalf of a Kinematics object (see Kinematics::SetParallelCorners()).
+// History:
+
+// VVASE headers
+#include "vSolver/threads/cornerThread.h"
+#include "vSolver/physics/kinematics.h"
+
+//==========================================================================
+// Class:			CornerThread
+// Function:		CornerThread
+//
+// Description:		Constructor for the CornerThread class.  The thread must
+//					be started with Run(), waited on with Wait() and then
+//					deleted by the caller.
+//
+// Input Arguments:
+//		kinematics		= Kinematics& for which the corner is solved
+//		corner			= Corner& to be solved
+//		originalCorner	= const Corner&, the un-perturbed locations of the
+//						  suspension hardpoints
+//		tireDeflection	= const double&
+//		rotations		= const Vector& specifying the amount to rotate the chassis
+//						  about each axis
+//		secondRotation	= const Vector::Axis& describing the second axis of rotation
+//		guess			= const double*, initial lower ball joint height for warm
+//						  starting (NULL to start from the design position)
+//		branchTolerance	= const double* (ignored if guess is NULL)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+CornerThread::CornerThread(Kinematics &kinematics, Corner &corner, const Corner &originalCorner,
+	const double &tireDeflection, const Vector &rotations, const Vector::Axis &secondRotation,
+	const double *guess, const double *branchTolerance)
+	: wxThread(wxTHREAD_JOINABLE), kinematics(kinematics), corner(corner), originalCorner(originalCorner),
+	tireDeflection(tireDeflection), rotations(rotations), secondRotation(secondRotation),
+	guess(guess), branchTolerance(branchTolerance)
+{
+	success = false;
+	iterations = 0;
+	wxThread::Create();
+}
+
+//==========================================================================
+// Class:			CornerThread
+// Function:		Entry
+//
+// Description:		Thread entry point.  Solves the corner.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ExitCode (NULL)
+//
+//==========================================================================
+CornerThread::ExitCode CornerThread::Entry()
+{
+	Corner *corners[1] = { &corner };
+	const Corner *originalCorners[1] = { &originalCorner };
+	iterations = kinematics.SolveCorners(corners, originalCorners, &tireDeflection, 1,
+		rotations, secondRotation, guess, branchTolerance, &success);
+
+	return NULL;
+}
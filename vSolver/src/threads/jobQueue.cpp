@@ -13,6 +13,9 @@
 // Description:  Contains the class definition for the JobQueue class.  This queue
 //				 handles task priorities and is used to communicate from the main thread
 //				 to the worker threads (add tasks here to be completed by the workers).
+//				 Each worker thread owns a deque (with its own lock) for each priority;
+//				 jobs are handed to the workers' deques in turn, and worker threads
+//				 steal from other deques when their own is empty.
 // History:
 
 // VVASE headers
@@ -20,6 +23,24 @@
 #include "vSolver/threads/threadEvent.h"
 #include "vUtilities/debugLog.h"
 
+//==========================================================================
+// Class:			JobQueue
+// Function:		Constant Declarations
+//
+// Description:		Constant declarations for JobQueue class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int JobQueue::maximumWorkers = 256;
+
 //==========================================================================
 // Class:			JobQueue
 // Function:		JobQueue
@@ -28,6 +49,7 @@
 //
 // Input Arguments:
 //		_parent		= wxEventHandler* pointing to the main application object
+//					  (may be NULL when no events are to be reported)
 //
 // Output Arguments:
 //		None
@@ -36,15 +58,73 @@
 //		None
 //
 //==========================================================================
-JobQueue::JobQueue(wxEvtHandler *parent) : parent(parent)
+JobQueue::JobQueue(wxEvtHandler *parent) : parent(parent), nextWorker(0)
 {
+	int i;
+	for (i = 0; i < NumberOfPriorities; i++)
+		pendingCount[i] = 0;
+
+	// The first deque holds jobs that are added before any worker attaches (it
+	// is given to the first worker)
+	workers = new WorkerDeque*[maximumWorkers];
+	workers[0] = new WorkerDeque;
+	workerCount = 1;
+}
+
+//==========================================================================
+// Class:			JobQueue
+// Function:		~JobQueue
+//
+// Description:		Destructor for the JobQueue class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+JobQueue::~JobQueue()
+{
+	int i;
+	for (i = 0; i < workerCount; i++)
+		delete workers[i];
+
+	delete [] workers;
+}
+
+//==========================================================================
+// Class:			JobQueue::WorkerDeque
+// Function:		WorkerDeque
+//
+// Description:		Constructor for the WorkerDeque structure.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+JobQueue::WorkerDeque::WorkerDeque() : owners(0)
+{
+	int i;
+	for (i = 0; i < NumberOfPriorities; i++)
+		unclaimed[i] = 0;
 }
 
 //==========================================================================
 // Class:			JobQueue
 // Function:		AddJob
 //
-// Description:		Adds a job to the queue
+// Description:		Adds a job to the queue.  Jobs are handed to the deques
+//					that have an owner in turn.
 //
 // Input Arguments:
 //		job			= const ThreadJob& to be added to the queue
@@ -59,21 +139,38 @@ JobQueue::JobQueue(wxEvtHandler *parent) : parent(parent)
 //==========================================================================
 void JobQueue::AddJob(const ThreadJob& job, const JobPriority& priority)
 {
-	wxMutexLocker lock(mutexQueue);
-	DebugLog::GetInstance()->Log(_T("JobQueue::AddJob (locker)"));
+	const unsigned int count(workerCount);
+	const unsigned int first((unsigned int)wxAtomicInc(nextWorker) % count);
+	unsigned int i, target(first);
+	for (i = 0; i < count; i++)
+	{
+		if (workers[(first + i) % count]->owners > 0)
+		{
+			target = (first + i) % count;
+			break;
+		}
+	}
 
-	jobs.insert(std::pair<JobPriority, ThreadJob>(priority, job));
+	WorkerDeque &deque(*workers[target]);
+	deque.mutex.Lock();
+	DebugLog::GetInstance()->Log(_T("JobQueue::AddJob (lock)"));
+	deque.jobs[priority].push_back(job);
+	DebugLog::GetInstance()->Log(_T("JobQueue::AddJob (unlock)"));
+	deque.mutex.Unlock();
 
+	// The job must be in the deque before it can be claimed
+	wxAtomicInc(deque.unclaimed[priority]);
+	wxAtomicInc(pendingCount[priority]);
 	queueCount.Post();
 }
 
 //==========================================================================
 // Class:			JobQueue
-// Function:		Pop
+// Function:		AttachWorker
 //
-// Description:		Pulls the next job from the queue.  Prioritization happens
-//					in the std::map object, so prioritization is not seen
-//					in this function.
+// Description:		Gives the calling thread a deque of its own.  A deque
+//					without an owner (i.e. left by a thread that has exited)
+//					is re-used, along with any jobs it holds.
 //
 // Input Arguments:
 //		None
@@ -82,28 +179,184 @@ void JobQueue::AddJob(const ThreadJob& job, const JobPriority& priority)
 //		None
 //
 // Return Value:
-//		ThreadJob to be executed
+//		unsigned int identifying the thread's deque (pass to Pop())
 //
 //==========================================================================
-ThreadJob JobQueue::Pop()
+unsigned int JobQueue::AttachWorker()
 {
-	ThreadJob nextJob;
+	wxMutexLocker lock(registryMutex);
+	DebugLog::GetInstance()->Log(_T("JobQueue::AttachWorker (locker)"));
 
-	queueCount.Wait();
+	unsigned int i;
+	for (i = 0; i < (unsigned int)workerCount; i++)
+	{
+		if (workers[i]->owners == 0)
+		{
+			wxAtomicInc(workers[i]->owners);
+			return i;
+		}
+	}
 
-	wxMutexLocker lock(mutexQueue);
-	DebugLog::GetInstance()->Log(_T("JobQueue::Pop (lock)"));
+	// With more threads than deques, some threads must share
+	if (i == maximumWorkers)
+	{
+		i = (unsigned int)wxAtomicInc(nextWorker) % maximumWorkers;
+		wxAtomicInc(workers[i]->owners);
+		return i;
+	}
 
-	// Get the first job from the queue (prioritization occurs automatically)
-	nextJob = jobs.begin()->second;
+	workers[i] = new WorkerDeque;
+	wxAtomicInc(workers[i]->owners);
 
-	jobs.erase(jobs.begin());
+	// Only after the deque exists, since other threads read it without locking
+	wxAtomicInc(workerCount);
 
-	DebugLog::GetInstance()->Log(_T("JobQueue::Pop (unlock)"));
+	return i;
+}
+
+//==========================================================================
+// Class:			JobQueue
+// Function:		DetachWorker
+//
+// Description:		Releases the calling thread's deque.  Remaining jobs in
+//					the deque are stolen by the other threads.
+//
+// Input Arguments:
+//		worker	= const unsigned int& returned by AttachWorker()
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JobQueue::DetachWorker(const unsigned int &worker)
+{
+	wxMutexLocker lock(registryMutex);
+	DebugLog::GetInstance()->Log(_T("JobQueue::DetachWorker (locker)"));
+
+	wxAtomicDec(workers[worker]->owners);
+}
+
+//==========================================================================
+// Class:			JobQueue
+// Function:		Pop
+//
+// Description:		Pulls the next job from the queue.  A job is claimed
+//					before any lock is taken, so only a deque that holds a
+//					job for the calling thread is locked.
+//
+// Input Arguments:
+//		worker	= const unsigned int& returned by AttachWorker()
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ThreadJob to be executed
+//
+//==========================================================================
+ThreadJob JobQueue::Pop(const unsigned int &worker)
+{
+	// Once we get past the semaphore, at least one unclaimed job exists somewhere
+	queueCount.Wait();
+
+	// A claim fails only if, while the deques were being checked, another thread
+	// claimed the job that was found and the remaining job was added to a deque
+	// that had already been checked, or the job's priority had not yet been
+	// counted.  Another try is required only while other threads make progress.
+	JobPriority priority;
+	WorkerDeque *deque;
+	while ((deque = ClaimJob(worker, priority)) == NULL)
+		wxThread::Yield();
+
+	// The claim guarantees there is a job for us (not necessarily the one that was
+	// counted, but the oldest is taken regardless of which thread claimed it)
+	wxMutexLocker lock(deque->mutex);
+	DebugLog::GetInstance()->Log(_T("JobQueue::Pop (locker)"));
+
+	ThreadJob nextJob(deque->jobs[priority].front());
+	deque->jobs[priority].pop_front();
 
 	return nextJob;
 }
 
+//==========================================================================
+// Class:			JobQueue
+// Function:		ClaimJob
+//
+// Description:		Claims the highest priority job that is available.  For
+//					each priority with unclaimed jobs, the thread's own deque
+//					is checked first, then jobs are stolen from the other
+//					deques.  No locks are taken.
+//
+// Input Arguments:
+//		worker		= const unsigned int& identifying the calling thread's deque
+//
+// Output Arguments:
+//		priority	= JobPriority& of the claimed job
+//
+// Return Value:
+//		WorkerDeque* containing the claimed job, or NULL if no job was claimed
+//
+//==========================================================================
+JobQueue::WorkerDeque *JobQueue::ClaimJob(const unsigned int &worker, JobPriority &priority)
+{
+	const unsigned int count(workerCount);
+	unsigned int i;
+	int p;
+	for (p = 0; p < NumberOfPriorities; p++)
+	{
+		if (pendingCount[p] <= 0)
+			continue;
+
+		for (i = 0; i < count; i++)
+		{
+			WorkerDeque &deque(*workers[(worker + i) % count]);
+			if (Claim(deque, (JobPriority)p))
+			{
+				wxAtomicDec(pendingCount[p]);
+				priority = (JobPriority)p;
+				return &deque;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+//==========================================================================
+// Class:			JobQueue
+// Function:		Claim
+//
+// Description:		Claims one of the unclaimed jobs of the specified priority
+//					in the deque, if there are any.
+//
+// Input Arguments:
+//		deque		= WorkerDeque&
+//		priority	= const JobPriority&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if a job was claimed
+//
+//==========================================================================
+bool JobQueue::Claim(WorkerDeque &deque, const JobPriority &priority)
+{
+	if (deque.unclaimed[priority] <= 0)
+		return false;
+
+	if (wxAtomicDec(deque.unclaimed[priority]) >= 0)
+		return true;
+
+	// Another thread claimed the last job first
+	wxAtomicInc(deque.unclaimed[priority]);
+	return false;
+}
+
 //==========================================================================
 // Class:			JobQueue
 // Function:		Report
@@ -115,6 +368,8 @@ ThreadJob JobQueue::Pop()
 //		Message		= const wxString& containing string information
 //		ThreadI		= int representing the thread's ID
 //		ObjectID	= int representing the object's ID
+//		count		= unsigned int indicating the number of analyses completed
+//					  by the reporting job (retrieve with GetClientData())
 //
 // Output Arguments:
 //		None
@@ -123,15 +378,19 @@ ThreadJob JobQueue::Pop()
 //		None
 //
 //==========================================================================
-void JobQueue::Report(const ThreadJob::ThreadCommand& command, int threadId, int objectID)
+void JobQueue::Report(const ThreadJob::ThreadCommand& command, int threadId, int objectID,
+	unsigned int count)
 {
 	wxCommandEvent evt(EVT_THREAD, command);
 
 	evt.SetId(threadId);
 	evt.SetInt((int)command);
 	evt.SetExtraLong(objectID);
+	evt.SetClientData(wxUIntToPtr(count));
 
-	parent->AddPendingEvent(evt);
+	// Without an event handler (i.e. when running headless), there is no one to tell
+	if (parent)
+		parent->AddPendingEvent(evt);
 }
 
 //==========================================================================
@@ -152,8 +411,12 @@ void JobQueue::Report(const ThreadJob::ThreadCommand& command, int threadId, int
 //==========================================================================
 size_t JobQueue::PendingJobs()
 {
-	wxMutexLocker lock(mutexQueue);
-	DebugLog::GetInstance()->Log(_T("JobQueue::PendingJobs (locker)"));
+	int count(0), priority;
+	for (priority = 0; priority < NumberOfPriorities; priority++)
+		count += pendingCount[priority];
+
+	if (count < 0)
+		return 0;
 
-	return jobs.size();
+	return count;
 }
\ No newline at end of file
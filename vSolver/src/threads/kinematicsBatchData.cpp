@@ -0,0 +1,167 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  kinematicsBatchData.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class definition for the KinematicsBatchData class.  This
+//				 contains a contiguous slice of kinematics analyses to be completed by a
+//				 single job (and reported once, when the whole slice is done).
+// History:
+
+// VVASE headers
+#include "vSolver/threads/kinematicsBatchData.h"
+
+//==========================================================================
+// Class:			KinematicsBatchData
+// Function:		Constant Declarations
+//
+// Description:		Constant declarations for the KinematicsBatchData class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int KinematicsBatchData::batchesPerThread = 4;
+
+//==========================================================================
+// Class:			KinematicsBatchData
+// Function:		KinematicsBatchData
+//
+// Description:		Constructor for the KinematicsBatchData class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+KinematicsBatchData::KinematicsBatchData() : ThreadData()
+{
+	completion = NULL;
+	completionQueue = NULL;
+	completionTag = 0;
+	warmStart = false;
+	outputMask = KinematicOutputs::GroupAll;
+}
+
+//==========================================================================
+// Class:			KinematicsBatchData
+// Function:		~KinematicsBatchData
+//
+// Description:		Destructor for the KinematicsBatchData class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+KinematicsBatchData::~KinematicsBatchData()
+{
+}
+
+//==========================================================================
+// Class:			KinematicsBatchData
+// Function:		Add
+//
+// Description:		Adds an analysis to this batch.
+//
+// Input Arguments:
+//		originalCar		= const Car*
+//		kinematicInputs	= const Kinematics::Inputs&
+//		output			= KinematicOutputs* where the results are stored
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void KinematicsBatchData::Add(const Car *originalCar,
+	const Kinematics::Inputs &kinematicInputs, KinematicOutputs *output)
+{
+	originalCars.push_back(originalCar);
+	inputs.push_back(kinematicInputs);
+	outputs.push_back(output);
+}
+
+//==========================================================================
+// Class:			KinematicsBatchData
+// Function:		ComputeBatchSize
+//
+// Description:		Determines the number of analyses to include in each
+//					batch.  Large enough that queue and event overhead is
+//					small, but small enough that every thread gets several
+//					batches.
+//
+// Input Arguments:
+//		analysisCount	= const unsigned int&, total number of analyses
+//		threadCount		= const unsigned int&, number of worker threads
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, number of analyses per batch (at least one)
+//
+//==========================================================================
+unsigned int KinematicsBatchData::ComputeBatchSize(const unsigned int &analysisCount,
+	const unsigned int &threadCount)
+{
+	unsigned int batchCount = batchesPerThread;
+	if (threadCount > 0)
+		batchCount *= threadCount;
+
+	unsigned int size = (analysisCount + batchCount - 1) / batchCount;
+	if (size < 1)
+		return 1;
+
+	return size;
+}
+
+//==========================================================================
+// Class:			KinematicsBatchData
+// Function:		OkForCommand
+//
+// Description:		Checks to make sure this type of data is correct for the
+//					specified command.
+//
+// Input Arguments:
+//		command		= ThreadJob::ThreadCommand& to be checked
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+bool KinematicsBatchData::OkForCommand(ThreadJob::ThreadCommand &command)
+{
+	// Make sure the command is one of the expected types
+	return command == ThreadJob::CommandThreadKinematicsIteration ||
+		command == ThreadJob::CommandThreadKinematicsGA ||
+		command == ThreadJob::CommandThreadKinematicsRefinement;
+}
@@ -41,6 +41,7 @@ KinematicsData::KinematicsData(const Car *originalCar, Car *workingCar,
 	originalCar(originalCar), workingCar(workingCar),
 	kinematicInputs(kinematicInputs), output(output)
 {
+	parallelCorners = false;
 }
 
 //==========================================================================
@@ -83,7 +84,5 @@ KinematicsData::~KinematicsData()
 bool KinematicsData::OkForCommand(ThreadJob::ThreadCommand &command)
 {
 	// Make sure the command is one of the expected types
-	return command == ThreadJob::CommandThreadKinematicsNormal ||
-		command == ThreadJob::CommandThreadKinematicsIteration ||
-		command == ThreadJob::CommandThreadKinematicsGA;
+	return command == ThreadJob::CommandThreadKinematicsNormal;
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*===================================================================================
+                                    CarDesigner
+                         Copyright Kerry R. Loux 2008-2016
+
+     No requirement for distribution of wxWidgets libraries, source, or binaries.
+                             (http://www.wxwidgets.org/)
+
+===================================================================================*/
+
+// File:  quasiStaticSweepData.cpp
+// Created:  10/16/2026
+// Author:  K. Loux
+// Description:  Contains the class definition for the QuasiStaticSweepData class.  This
+//				 identifies a contiguous range of points of a QuasiStaticSweep to be
+//				 solved by a single job.
+// History:
+
+// VVASE headers
+#include "vSolver/threads/quasiStaticSweepData.h"
+
+//==========================================================================
+// Class:			QuasiStaticSweepData
+// Function:		QuasiStaticSweepData
+//
+// Description:		Constructor for the QuasiStaticSweepData class.
+//
+// Input Arguments:
+//		sweep	= QuasiStaticSweep* to be solved
+//		start	= const unsigned int&, first point to solve
+//		end		= const unsigned int&, one past the last point to solve
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+QuasiStaticSweepData::QuasiStaticSweepData(QuasiStaticSweep *sweep,
+	const unsigned int &start, const unsigned int &end)
+	: ThreadData(), sweep(sweep), start(start), end(end)
+{
+	completion = NULL;
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweepData
+// Function:		~QuasiStaticSweepData
+//
+// Description:		Destructor for the QuasiStaticSweepData class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+QuasiStaticSweepData::~QuasiStaticSweepData()
+{
+}
+
+//==========================================================================
+// Class:			QuasiStaticSweepData
+// Function:		OkForCommand
+//
+// Description:		Checks to make sure this type of data is correct for the
+//					specified command.
+//
+// Input Arguments:
+//		command		= ThreadJob::ThreadCommand& to be checked
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+bool QuasiStaticSweepData::OkForCommand(ThreadJob::ThreadCommand &command)
+{
+	return command == ThreadJob::CommandThreadQuasiStaticSweep;
+}
@@ -24,8 +24,13 @@
 #include "vSolver/threads/jobQueue.h"
 #include "vSolver/threads/threadJob.h"
 #include "vSolver/threads/kinematicsData.h"
+#include "vSolver/threads/kinematicsBatchData.h"
+#include "vSolver/threads/inverseSemaphore.h"
+#include "vSolver/threads/completionQueue.h"
 #include "vSolver/threads/optimizationData.h"
+#include "vSolver/threads/quasiStaticSweepData.h"
 #include "vSolver/physics/kinematics.h"
+#include "vSolver/physics/quasiStaticSweep.h"
 #include "vSolver/optimization/geneticAlgorithm.h"
 #include "vCar/car.h"
 #include "vUtilities/debugger.h"
@@ -41,6 +46,8 @@
 //		jobQueue	= JobQueue*, pointing to the queue from which this
 //					  thread will pull jobs
 //		id			= int representing this thread's ID number
+//		kind		= wxThreadKind; joinable threads must be waited on and
+//					  deleted by the creator
 //
 // Output Arguments:
 //		None
@@ -49,8 +56,8 @@
 //		None
 //
 //==========================================================================
-WorkerThread::WorkerThread(JobQueue* jobQueue, int id)
-							 : jobQueue(jobQueue), id(id)
+WorkerThread::WorkerThread(JobQueue* jobQueue, int id, wxThreadKind kind)
+							 : wxThread(kind), jobQueue(jobQueue), id(id), worker(0)
 {
 	assert(jobQueue);
 	wxThread::Create();
@@ -96,6 +103,9 @@ wxThread::ExitCode WorkerThread::Entry()
 {
 	ThreadJob::ThreadCommand error;
 
+	// Jobs are taken from our own deque first
+	worker = jobQueue->AttachWorker();
+
 	// Tell the main thread that we successfully started
 	jobQueue->Report(ThreadJob::CommandThreadStarted, id);
 
@@ -108,6 +118,7 @@ wxThread::ExitCode WorkerThread::Entry()
 	catch (ThreadJob::ThreadCommand& i)
 	{
 		error = i;
+		jobQueue->DetachWorker(worker);
 		jobQueue->Report(i, id);
 	}
 
@@ -134,7 +145,7 @@ void WorkerThread::OnJob()
 {
 	// Get a job from the queue
 	// If the queue is empty, this blocks the thread
-	ThreadJob job = jobQueue->Pop();
+	ThreadJob job = jobQueue->Pop(worker);
 
 	wxDateTime start;
 
@@ -144,11 +155,11 @@ void WorkerThread::OnJob()
 		throw ThreadJob::CommandThreadExit;
 
 	case ThreadJob::CommandThreadKinematicsNormal:
-	case ThreadJob::CommandThreadKinematicsIteration:
-	case ThreadJob::CommandThreadKinematicsGA:
 		// Do the kinematics calculations
 		DebugLog::GetInstance()->Log(_T("SetInputs - Start"), 1);
 		kinematicAnalysis.SetInputs(static_cast<KinematicsData*>(job.data)->kinematicInputs);
+		kinematicAnalysis.SetParallelCorners(static_cast<KinematicsData*>(job.data)->parallelCorners);
+		kinematicAnalysis.SetOutputMask(KinematicOutputs::GroupAll);
 		DebugLog::GetInstance()->Log(_T("SetInputs - End"), -1);
 		DebugLog::GetInstance()->Log(_T("UpdateKinematics - Start"), 1);
 		kinematicAnalysis.UpdateKinematics(static_cast<KinematicsData*>(job.data)->originalCar,
@@ -163,6 +174,36 @@ void WorkerThread::OnJob()
 	    jobQueue->Report(job.command, id, job.index);
 		break;
 
+	case ThreadJob::CommandThreadKinematicsIteration:
+	case ThreadJob::CommandThreadKinematicsGA:
+	case ThreadJob::CommandThreadKinematicsRefinement:
+		DebugLog::GetInstance()->Log(_T("SolveBatch - Start"), 1);
+		SolveBatch(*static_cast<KinematicsBatchData*>(job.data));
+		DebugLog::GetInstance()->Log(_T("SolveBatch - End"), -1);
+
+		if (static_cast<KinematicsBatchData*>(job.data)->completion)
+			static_cast<KinematicsBatchData*>(job.data)->completion->Post();
+		if (static_cast<KinematicsBatchData*>(job.data)->completionQueue)
+			static_cast<KinematicsBatchData*>(job.data)->completionQueue->Post(
+				static_cast<KinematicsBatchData*>(job.data)->completionTag);
+
+		jobQueue->Report(job.command, id, job.index,
+			static_cast<KinematicsBatchData*>(job.data)->GetCount());
+		break;
+
+	case ThreadJob::CommandThreadQuasiStaticSweep:
+		DebugLog::GetInstance()->Log(_T("SolveRange - Start"), 1);
+		static_cast<QuasiStaticSweepData*>(job.data)->sweep->SolveRange(
+			static_cast<QuasiStaticSweepData*>(job.data)->start,
+			static_cast<QuasiStaticSweepData*>(job.data)->end);
+		DebugLog::GetInstance()->Log(_T("SolveRange - End"), -1);
+
+		if (static_cast<QuasiStaticSweepData*>(job.data)->completion)
+			static_cast<QuasiStaticSweepData*>(job.data)->completion->Post();
+
+		jobQueue->Report(job.command, id, job.index);
+		break;
+
 	case ThreadJob::CommandThreadGeneticOptimization:
 		start = wxDateTime::UNow();
 
@@ -189,3 +230,47 @@ void WorkerThread::OnJob()
 		job.data = NULL;
 	}
 }
+
+//==========================================================================
+// Class:			WorkerThread
+// Function:		SolveBatch
+//
+// Description:		Solves all of the analyses in a batch.  Consecutive
+//					analyses that share an original car are solved with a
+//					single call to Kinematics::SolveSweep().
+//
+// Input Arguments:
+//		data	= const KinematicsBatchData&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void WorkerThread::SolveBatch(const KinematicsBatchData &data)
+{
+	// The batch already keeps every worker busy, so the corners are always
+	// solved on this thread (a previous single analysis may have enabled
+	// parallel corners on this object)
+	kinematicAnalysis.SetParallelCorners(false);
+	kinematicAnalysis.SetWarmStart(data.warmStart);
+	kinematicAnalysis.SetOutputMask(data.outputMask);
+
+	unsigned int start(0), end, i;
+	while (start < data.GetCount())
+	{
+		end = start + 1;
+		while (end < data.GetCount() && data.originalCars[end] == data.originalCars[start])
+			end++;
+
+		sweepInputs.assign(data.inputs.begin() + start, data.inputs.begin() + end);
+		kinematicAnalysis.SolveSweep(*data.originalCars[start], sweepInputs, sweepOutputs);
+
+		for (i = start; i < end; i++)
+			*data.outputs[i] = sweepOutputs[i - start];
+
+		start = end;
+	}
+}